@@ -168,3 +168,63 @@ TEST_F(TestAtomicStateReader, ParseDynamicAtomicState) {
     ASSERT_EQ(*o_force, 1.25);
   }
 }
+
+/**
+ * @brief Verify that a topology within the atoms configuration is parsed and
+ * attached to the atomic state, and that states without one are unbonded.
+ */
+TEST_F(TestAtomicStateReader, ParseTopology) {
+  ASSERT_EQ(static_atomic_state_a.topology(), nullptr);
+  ASSERT_EQ(dynamic_atomic_state_b.topology(), nullptr);
+
+  toml::table config = toml::parse(R"(
+    [Atoms.H]
+    positions = [[0.0, 0.0, 0.0], [0.0, 0.0, 1.0]]
+
+    [Atoms.O]
+    positions = [[1.0, 0.0, 0.0]]
+
+    [[Atoms.Topology.Bonds]]
+    k = 0.5
+    r0 = 1.0
+    atoms = [[0, 2], [1, 2]]
+
+    [[Atoms.Topology.Angles]]
+    k = 0.1
+    theta0 = 104.5
+    atoms = [[0, 2, 1]]
+    )"sv);
+  DynamicAtomicStateReader reader(atom_types);
+  DynamicAtomicState atomic_state =
+      reader.parse(*config["Atoms"].as_table());
+  auto topology = atomic_state.topology();
+  ASSERT_NE(topology, nullptr);
+  ASSERT_EQ(topology->bonds.size(), 2);
+  ASSERT_EQ(topology->angles.size(), 1);
+  ASSERT_EQ(topology->dihedrals.size(), 0);
+
+  AtomicStateReader static_reader(atom_types);
+  ASSERT_NE(static_reader.parse(*config["Atoms"].as_table()).topology(),
+            nullptr);
+}
+
+/**
+ * @brief Verify that a topology referring to atoms beyond those in the atomic
+ * state is refused.
+ */
+TEST_F(TestAtomicStateReader, TopologyOutOfRange) {
+  toml::table config = toml::parse(R"(
+    [Atoms.H]
+    positions = [[0.0, 0.0, 0.0], [0.0, 0.0, 1.0]]
+
+    [Atoms.O]
+    positions = [[1.0, 0.0, 0.0]]
+
+    [[Atoms.Topology.Bonds]]
+    k = 0.5
+    r0 = 1.0
+    atoms = [[0, 3]]
+    )"sv);
+  DynamicAtomicStateReader reader(atom_types);
+  ASSERT_THROW(reader.parse(*config["Atoms"].as_table()), std::runtime_error);
+}
@@ -0,0 +1,63 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <numbers>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+// Project Inclusions
+#include "tyche/atom/topology_reader.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+static constexpr std::string_view topology_toml = R"(
+    [[Topology.Bonds]]
+    k = 0.5
+    r0 = 1.5
+    atoms = [[3, 2], [0, 1], [1, 2]]
+
+    [[Topology.Bonds]]
+    k = 0.25
+    r0 = 1.0
+    atoms = [[0, 4]]
+
+    [[Topology.Angles]]
+    k = 0.1
+    theta0 = 90
+    atoms = [[2, 1, 0], [1, 2, 3]]
+
+    [[Topology.Dihedrals]]
+    k = 0.01
+    n = 3
+    phi0 = 180
+    atoms = [[0, 1, 2, 3]]
+    )"sv;
+
+TEST(TestTopologyReader, ParseTopology) {
+  spdlog::set_level(spdlog::level::off);
+
+  toml::table config = toml::parse(topology_toml);
+  TopologyReader reader;
+  auto topology = reader.parse(*config["Topology"].as_table());
+
+  // Terms should be oriented with the lower index first, then sorted
+  ASSERT_EQ(topology.bonds.size(), 4);
+  std::vector<std::size_t> first = {0, 0, 1, 2}, second = {1, 4, 2, 3};
+  std::vector<double> k = {0.5, 0.25, 0.5, 0.5};
+  ASSERT_EQ(topology.bonds.atoms(0), first);
+  ASSERT_EQ(topology.bonds.atoms(1), second);
+  ASSERT_EQ(topology.bonds.param(0), k);
+
+  ASSERT_EQ(topology.angles.size(), 2);
+  ASSERT_EQ(topology.angles.atoms(0)[0], 0);
+  ASSERT_EQ(topology.angles.atoms(2)[0], 2);
+  ASSERT_DOUBLE_EQ(topology.angles.param(1)[0], std::numbers::pi / 2);
+
+  ASSERT_EQ(topology.dihedrals.size(), 1);
+  ASSERT_EQ(topology.dihedrals.param(1)[0], 3);
+  ASSERT_DOUBLE_EQ(topology.dihedrals.param(2)[0], std::numbers::pi);
+
+  ASSERT_NO_THROW(topology.validate(5));
+  ASSERT_THROW(topology.validate(4), std::runtime_error);
+}
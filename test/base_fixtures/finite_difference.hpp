@@ -0,0 +1,86 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_TEST_BASE_FIXTURES_FINITE_DIFFERENCE_HPP
+#define __TYCHE_TEST_BASE_FIXTURES_FINITE_DIFFERENCE_HPP
+
+// C++ Standard Libraries
+#include <cmath>
+#include <vector>
+#include <algorithm>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Make sure forces are the negative gradient of the potential energy by
+ * comparing against central finite differences.
+ * @param state The atomic state whose forces to check.
+ * @param potential_fn Callable zeroing the forces of the state and returning
+ * its potential energy.
+ * @param atoms Indices of the atoms to displace.
+ * @param h The displacement along each dimension.
+ * @param tol Absolute tolerance on each component of the force.
+ */
+template <class PotentialFn>
+void expect_forces_match_finite_difference(
+    DynamicAtomicState& state, PotentialFn&& potential_fn,
+    const std::vector<std::size_t>& atoms, double h, double tol) {
+  potential_fn();
+  Tensor<double, 2> analytic(state.num_atoms(), 3);
+  std::copy(state.force(), state.force() + analytic.num_elements(),
+            analytic.begin());
+
+  for (std::size_t iatom : atoms) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      auto pos = state.pos(iatom) + idim;
+      double orig = *pos;
+      *pos = orig + h;
+      double pot_forward = potential_fn();
+      *pos = orig - h;
+      double pot_backward = potential_fn();
+      *pos = orig;
+      ASSERT_NEAR(analytic(iatom, idim),
+                  -(pot_forward - pot_backward) / (2 * h), tol);
+    }
+  }
+}
+
+/**
+ * @brief Make sure the virial, \sum_i r_i . f_i, is the negative derivative of
+ * the potential energy with respect to a uniform dilation of the system, by
+ * central finite differences. The atoms and cell are left dilated.
+ * @param state The atomic state whose virial to check.
+ * @param cell The cell confining the atomic state.
+ * @param potential_fn Callable zeroing the forces and virial of the state and
+ * returning its potential energy.
+ * @param rel_tol Tolerance relative to the magnitude of the virial.
+ * @param abs_tol Lower bound on the tolerance, for virials which vanish.
+ */
+template <class PotentialFn>
+void expect_virial_matches_dilation(DynamicAtomicState& state, CubicCell& cell,
+                                    PotentialFn&& potential_fn, double rel_tol,
+                                    double abs_tol = 0) {
+  potential_fn();
+  double virial = state.virial();
+
+  auto dilated = [&](double scale) {
+    Tensor<double, 2>::iterator pos = state.pos();
+    for (std::size_t idx = 0; idx < 3 * state.num_atoms(); ++idx) {
+      pos[idx] *= scale;
+    }
+    cell.scale(scale);
+    return potential_fn();
+  };
+  const double h = 1E-6;
+  double pot_forward = dilated(1 + h);
+  double pot_backward = dilated((1 - h) / (1 + h));
+  ASSERT_NEAR(virial, -(pot_forward - pot_backward) / (2 * h),
+              std::max(rel_tol * std::abs(virial), abs_tol));
+}
+
+#endif /* #ifndef __TYCHE_TEST_BASE_FIXTURES_FINITE_DIFFERENCE_HPP */
@@ -0,0 +1,115 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_TEST_BASE_FIXTURES_SILICON_CRYSTAL_HPP
+#define __TYCHE_TEST_BASE_FIXTURES_SILICON_CRYSTAL_HPP
+
+// C++ Standard Libraries
+#include <random>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/atom_type_reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Diamond-lattice Silicon crystal test fixture.
+ */
+class SiliconCrystal : public ::testing::Test {
+ public:
+  /**
+   * @brief Arrange Silicon atoms into a periodic diamond lattice.
+   * @param cells_per_dim The number of conventional unit cells along each
+   * dimension.
+   * @param noise Standard deviation of random displacements applied to each
+   * atom's lattice position, in Angstrom.
+   */
+  void SetUp(std::size_t cells_per_dim, double noise = 0) {
+    toml::table config = toml::parse(toml);
+    AtomTypeReader reader;
+    atom_types = reader.parse(*config["AtomTypes"].as_table());
+
+    cell = std::make_unique<CubicCell>(cells_per_dim * lattice_constant);
+
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution{0.0, noise};
+
+    constexpr double basis[8][3] = {
+        {0.00, 0.00, 0.00}, {0.00, 0.50, 0.50}, {0.50, 0.00, 0.50},
+        {0.50, 0.50, 0.00}, {0.25, 0.25, 0.25}, {0.25, 0.75, 0.75},
+        {0.75, 0.25, 0.75}, {0.75, 0.75, 0.25}};
+    std::size_t num_atoms = 8 * cells_per_dim * cells_per_dim * cells_per_dim;
+    std::vector<std::shared_ptr<AtomType>> types(num_atoms);
+    Tensor<double, 2> pos(num_atoms, 3);
+
+    std::size_t iatom = 0;
+    for (std::size_t ix = 0; ix < cells_per_dim; ++ix) {
+      for (std::size_t iy = 0; iy < cells_per_dim; ++iy) {
+        for (std::size_t iz = 0; iz < cells_per_dim; ++iz) {
+          for (const auto& site : basis) {
+            pos(iatom, 0) = (ix + site[0]) * lattice_constant;
+            pos(iatom, 1) = (iy + site[1]) * lattice_constant;
+            pos(iatom, 2) = (iz + site[2]) * lattice_constant;
+            if (noise > 0) {
+              for (std::size_t idim = 0; idim < 3; ++idim) {
+                pos(iatom, idim) += distribution(generator);
+              }
+            }
+            types[iatom] = atom_types["Si"];
+            ++iatom;
+          }
+        }
+      }
+    }
+    atomic_state = std::make_shared<DynamicAtomicState>();
+    atomic_state->add(std::move(types), std::move(pos));
+  }
+
+ protected:
+  std::unique_ptr<CubicCell> cell;
+  std::shared_ptr<DynamicAtomicState> atomic_state;
+  std::map<std::string, std::shared_ptr<AtomType>> atom_types;
+
+  static constexpr double lattice_constant = 5.431;
+
+  // Stillinger-Weber parameters are from Stillinger and Weber, Phys. Rev. B
+  // 31, 5262 (1985), and Tersoff parameters are the Si(B) set from Tersoff,
+  // Phys. Rev. B 37, 6991 (1988). Energies are converted from eV to internal
+  // units
+  static constexpr std::string_view toml = R"(
+    [AtomTypes.Si]
+    mass = 28.085
+    num_electrons = 14
+    nuclear_charge = 14
+    eps_sw = 0.020921027749490086
+    sigma_sw = 2.0951
+    a_sw = 1.8
+    lambda_sw = 21.0
+    gamma_sw = 1.2
+    costheta0_sw = -0.3333333333333333
+    A_sw = 7.049556277
+    B_sw = 0.6022245584
+    p_sw = 4.0
+    q_sw = 0.0
+    A_tersoff = 17.664630172838837
+    B_tersoff = 4.546220474567514
+    lambda1_tersoff = 2.4799
+    lambda2_tersoff = 1.7322
+    lambda3_tersoff = 0.0
+    beta_tersoff = 1.1E-6
+    n_tersoff = 0.78734
+    c_tersoff = 1.0039E5
+    d_tersoff = 16.217
+    h_tersoff = -0.59825
+    gamma_tersoff = 1.0
+    R_tersoff = 2.85
+    D_tersoff = 0.15
+  )"sv;
+};
+
+#endif /* #ifndef __TYCHE_TEST_BASE_FIXTURES_SILICON_CRYSTAL_HPP */
@@ -0,0 +1,152 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <random>
+#include <numeric>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/atom_type_reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/force/harmonic_bond.hpp"
+#include "tyche/force/harmonic_angle.hpp"
+#include "tyche/force/periodic_dihedral.hpp"
+#include "test/base_fixtures/finite_difference.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief A random walk polymer chain which wraps around a periodic cell, with
+ * a bond between each consecutive pair of atoms, an angle for each triple and
+ * a dihedral for each quadruple.
+ */
+class TestBonded : public ::testing::Test {
+ public:
+  void SetUp() override {
+    spdlog::set_level(spdlog::level::off);
+    toml::table config = toml::parse(toml);
+    AtomTypeReader reader;
+    auto atom_types = reader.parse(*config["AtomTypes"].as_table());
+
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution{0.0, 1.0};
+    std::vector<std::shared_ptr<AtomType>> types(num_atoms, atom_types["C"]);
+    Tensor<double, 2> pos(num_atoms, 3);
+    double x = 0, y = 0, z = 0;
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      double dx = distribution(generator), dy = distribution(generator),
+             dz = distribution(generator);
+      double scale = 1.5 / std::sqrt(dx * dx + dy * dy + dz * dz);
+      x += scale * dx;
+      y += scale * dy;
+      z += scale * dz;
+      pos(iatom, 0) = x;
+      pos(iatom, 1) = y;
+      pos(iatom, 2) = z;
+      cell.pbc(pos(iatom, 0), pos(iatom, 1), pos(iatom, 2));
+    }
+    atomic_state = std::make_shared<DynamicAtomicState>();
+    atomic_state->add(std::move(types), std::move(pos));
+
+    auto topology = std::make_shared<Topology>();
+    for (std::size_t iatom = 0; iatom + 1 < num_atoms; ++iatom) {
+      topology->bonds.add({iatom + 1, iatom}, {0.3, 1.4});
+    }
+    for (std::size_t iatom = 0; iatom + 2 < num_atoms; ++iatom) {
+      topology->angles.add({iatom, iatom + 1, iatom + 2}, {0.2, 1.9});
+    }
+    for (std::size_t iatom = 0; iatom + 3 < num_atoms; ++iatom) {
+      topology->dihedrals.add({iatom, iatom + 1, iatom + 2, iatom + 3},
+                              {0.05, 1.0 + iatom % 3, 0.3 * (iatom % 2)});
+    }
+    topology->sort();
+    atomic_state->set_topology(topology);
+  }
+
+ protected:
+  static constexpr std::size_t num_atoms = 100;
+  std::shared_ptr<DynamicAtomicState> atomic_state;
+  CubicCell cell{10.0};
+
+  static constexpr std::string_view toml = R"(
+    [AtomTypes.C]
+    )"sv;
+
+  /**
+   * @brief Evaluate the potential energy of the chain.
+   * @param force The bonded force to evaluate.
+   * @return The potential energy.
+   */
+  double potential(Force& force) {
+    atomic_state->zero_forces();
+    return force.evaluate(*atomic_state, cell);
+  }
+
+  /**
+   * @brief Forces on every atom of the chain should match their finite
+   * differences.
+   * @param force The bonded force to check.
+   */
+  void finite_difference_forces(Force& force) {
+    std::vector<std::size_t> atoms(num_atoms);
+    std::iota(atoms.begin(), atoms.end(), 0);
+    expect_forces_match_finite_difference(
+        *atomic_state, [&]() { return potential(force); }, atoms, 1E-5, 1E-8);
+  }
+
+  /**
+   * @brief The virial of the chain should match its dilation derivative.
+   * Angles and dihedrals are invariant under dilation, so have no virial.
+   * @param force The bonded force to check.
+   */
+  void dilation_virial(Force& force) {
+    expect_virial_matches_dilation(*atomic_state, cell,
+                                   [&]() { return potential(force); }, 1E-6,
+                                   1E-8);
+  }
+};
+
+TEST_F(TestBonded, HarmonicBond) {
+  HarmonicBond force(atomic_state->topology());
+  finite_difference_forces(force);
+  dilation_virial(force);
+}
+
+TEST_F(TestBonded, HarmonicAngle) {
+  HarmonicAngle force(atomic_state->topology());
+  finite_difference_forces(force);
+  dilation_virial(force);
+}
+
+TEST_F(TestBonded, PeriodicDihedral) {
+  PeriodicDihedral force(atomic_state->topology());
+  finite_difference_forces(force);
+  dilation_virial(force);
+}
+
+/**
+ * @brief Trans configuration of a dihedral should have an angle of 180
+ * degrees.
+ */
+TEST_F(TestBonded, TransDihedral) {
+  Tensor<double, 2> pos(
+      std::vector<double>{0, 1, 0, 0, 0, 0, 1, 0, 0, 1, -1, 0}, 4, 3);
+  std::vector<std::shared_ptr<AtomType>> types(4, atomic_state->atom_type(0));
+  DynamicAtomicState state;
+  state.add(std::move(types), std::move(pos));
+  auto topology = std::make_shared<Topology>();
+  topology->dihedrals.add({0, 1, 2, 3}, {1.0, 1.0, 0.0});
+  state.set_topology(topology);
+
+  PeriodicDihedral force(state.topology());
+  ASSERT_NEAR(force.evaluate(state, cell), 0.0, 1E-12);
+}
+
+TEST_F(TestBonded, MissingTopology) {
+  ASSERT_THROW(HarmonicBond force(nullptr), std::runtime_error);
+}
@@ -0,0 +1,221 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <random>
+#include <string>
+#include <stdexcept>
+// Third-Party Libraries
+#include <omp.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/atom_type_reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/force/dissipative_particle_dynamics.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+#include "tyche/simulation/molecular_dynamics.hpp"
+#include "tyche/simulation/molecular_dynamics_builder.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Coarse-grained DPD fluid at the reduced density of 3 particles per
+ * cubed cutoff used by Groot and Warren, with a = 25 kT / r_c and
+ * gamma = 4.5 in reduced units.
+ */
+class TestDPD : public ::testing::Test {
+ public:
+  void SetUp() override {
+    toml::table config = toml::parse(toml);
+    AtomTypeReader reader;
+    atom_types = reader.parse(*config["AtomTypes"].as_table());
+
+    const std::size_t num_atoms = 200;
+    cell = std::make_unique<CubicCell>(
+        std::cbrt(num_atoms * cutoff * cutoff * cutoff / 3));
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> uniform(0, cell->length());
+    std::vector<std::shared_ptr<AtomType>> types(num_atoms, atom_types["Ar"]);
+    Tensor<double, 2> pos(num_atoms, 3);
+    for (std::size_t idx = 0; idx < 3 * num_atoms; ++idx) {
+      pos.begin()[idx] = uniform(generator);
+    }
+    atomic_state = std::make_shared<DynamicAtomicState>();
+    atomic_state->add(std::move(types), std::move(pos));
+    idx = {{atom_types["Ar"], 0}};
+  }
+
+ protected:
+  std::unique_ptr<CubicCell> cell;
+  std::shared_ptr<DynamicAtomicState> atomic_state;
+  std::map<std::string, std::shared_ptr<AtomType>> atom_types;
+  std::map<std::shared_ptr<AtomType>, std::size_t> idx;
+
+  static constexpr double cutoff = 5;
+  static constexpr double temperature = 300;
+  static constexpr double dt = 10;
+  // With kT = 2.494E-4 at 300K and mass 39.948, the reduced time unit is
+  // r_c sqrt(m / kT) = 2001 fs
+  static constexpr std::string_view toml = R"(
+    [AtomTypes.Ar]
+    a_dpd = 1.2472E-3
+    gamma_dpd = 0.08983
+    rc_dpd = 5.0
+  )"sv;
+};
+
+/**
+ * @brief Forces, including the random forces, are identical however many
+ * threads evaluate them, and conserve momentum.
+ */
+TEST_F(TestDPD, ThreadInvariance) {
+  Tensor<double, 2>::iterator vel = atomic_state->vel();
+  std::mt19937 generator(7);
+  std::normal_distribution<double> normal(0, 2.5E-3);
+  for (std::size_t i = 0; i < 3 * atomic_state->num_atoms(); ++i) {
+    vel[i] = normal(generator);
+  }
+
+  std::vector<std::vector<double>> forces;
+  for (int num_threads : {1, 4}) {
+    omp_set_num_threads(num_threads);
+    DissipativeParticleDynamics dpd(idx, temperature, 1234, 1.0);
+    dpd.set_dt(dt);
+    atomic_state->zero_forces();
+    dpd.evaluate(*atomic_state, *cell);
+    forces.emplace_back(atomic_state->force(),
+                        atomic_state->force() + 3 * atomic_state->num_atoms());
+  }
+  double net[3] = {0, 0, 0};
+  for (std::size_t i = 0; i < forces[0].size(); ++i) {
+    ASSERT_EQ(forces[0][i], forces[1][i]);
+    net[i % 3] += forces[0][i];
+  }
+  for (double component : net) ASSERT_NEAR(component, 0.0, 1E-15);
+}
+
+/**
+ * @brief Velocity Verlet with the DPD thermostat heats a fluid at rest to the
+ * target temperature.
+ */
+TEST_F(TestDPD, Thermalises) {
+  Forces forces;
+  forces.add(std::make_unique<DissipativeParticleDynamics>(idx, temperature,
+                                                           1234, 1.0));
+  VelocityVerlet integrator(dt, 0);
+  forces.set_dt(dt);
+  forces.evaluate(*atomic_state, *cell);
+  double average = 0;
+  const std::size_t num_equilibrate = 2000, num_sample = 2000;
+  for (std::size_t istep = 0; istep < num_equilibrate + num_sample; ++istep) {
+    integrator.step(*atomic_state, forces, *cell);
+    if (istep >= num_equilibrate) {
+      average += Thermostat::temperature(*atomic_state) / num_sample;
+    }
+  }
+  ASSERT_NEAR(average, temperature, 0.05 * temperature);
+}
+
+/**
+ * @brief Random forces are keyed on the step rather than on how many times
+ * forces were evaluated before it, so an extra evaluation outside of a step
+ * leaves the trajectory unchanged.
+ */
+TEST_F(TestDPD, KeyedOnStep) {
+  Tensor<double, 2>::iterator vel = atomic_state->vel();
+  std::mt19937 generator(7);
+  std::normal_distribution<double> normal(0, 2.5E-3);
+  for (std::size_t i = 0; i < 3 * atomic_state->num_atoms(); ++i) {
+    vel[i] = normal(generator);
+  }
+
+  std::vector<std::vector<double>> forces;
+  for (std::size_t num_extra : {0, 3}) {
+    DissipativeParticleDynamics dpd(idx, temperature, 1234, 1.0);
+    dpd.set_dt(dt);
+    for (std::size_t iextra = 0; iextra < num_extra; ++iextra) {
+      atomic_state->zero_forces();
+      dpd.evaluate(*atomic_state, *cell);
+    }
+    for (std::uint64_t step : {5, 6}) {
+      dpd.set_step(step);
+      atomic_state->zero_forces();
+      dpd.evaluate(*atomic_state, *cell);
+      forces.emplace_back(
+          atomic_state->force(),
+          atomic_state->force() + 3 * atomic_state->num_atoms());
+    }
+  }
+  ASSERT_EQ(forces[0], forces[2]);
+  ASSERT_EQ(forces[1], forces[3]);
+  ASSERT_NE(forces[0], forces[1]);
+}
+
+/**
+ * @brief Evaluating the random forces without a time increment to scale them
+ * by is refused.
+ */
+TEST_F(TestDPD, NeedsTimestep) {
+  DissipativeParticleDynamics dpd(idx, temperature, 1234, 1.0);
+  ASSERT_THROW(dpd.evaluate(*atomic_state, *cell), std::runtime_error);
+}
+
+/**
+ * @brief With the time increment adapting well below the largest, the random
+ * forces follow it, so the fluid still thermalises to the target temperature
+ * rather than that of the noise scaled to the largest.
+ */
+TEST_F(TestDPD, ThermalisesAdaptive) {
+  Forces forces;
+  forces.add(std::make_unique<DissipativeParticleDynamics>(idx, temperature,
+                                                           1234, 1.0));
+  VelocityVerlet integrator(dt, 0);
+  integrator.set_adaptive_timestep(dt / 4, dt, 0.01);
+  forces.set_dt(integrator.dt());
+  forces.evaluate(*atomic_state, *cell);
+  integrator.adapt_timestep(*atomic_state);
+  double average = 0, average_dt = 0;
+  const std::size_t num_equilibrate = 2000, num_sample = 2000;
+  for (std::size_t istep = 0; istep < num_equilibrate + num_sample; ++istep) {
+    forces.set_dt(integrator.dt());
+    integrator.step(*atomic_state, forces, *cell);
+    if (istep >= num_equilibrate) {
+      average += Thermostat::temperature(*atomic_state) / num_sample;
+      average_dt += integrator.dt() / num_sample;
+    }
+  }
+  ASSERT_LT(average_dt, 0.75 * dt);
+  ASSERT_NEAR(average, temperature, 0.05 * temperature);
+}
+
+/**
+ * @brief Fourth-order Velocity Verlet takes sub-steps of other increments than
+ * the step's, which the random forces can't be scaled to, so is refused.
+ */
+TEST_F(TestDPD, RefusesFourthOrder) {
+  Reader::Mapping integrator = {{"type", std::string("VelocityVerlet")},
+                                {"timestep", dt},
+                                {"num_steps", 10.0}};
+  Reader::Mapping dpd = {{"type", std::string("DPD")},
+                         {"temperature", temperature},
+                         {"seed", 1234.0}};
+  Reader::Mapping cubic = {{"type", std::string("Cubic")},
+                           {"length", cell->length()}};
+  ASSERT_NO_THROW(MolecularDynamics::create(atomic_state)
+                      .integrator(integrator)
+                      .force(dpd)
+                      .cell(cubic)
+                      .build());
+  integrator["scheme"] = std::string("Yoshida");
+  ASSERT_THROW(MolecularDynamics::create(atomic_state)
+                   .integrator(integrator)
+                   .force(dpd)
+                   .cell(cubic)
+                   .build(),
+               std::runtime_error);
+}
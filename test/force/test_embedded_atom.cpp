@@ -0,0 +1,106 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <fstream>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/force/embedded_atom.hpp"
+#include "tyche/force/embedded_atom_reader.hpp"
+#include "test/base_fixtures/argon_box.hpp"
+#include "test/base_fixtures/finite_difference.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Argon crystal interacting through a fictitious embedded-atom method
+ * potential, tabulated from smooth analytic functions.
+ */
+class TestEmbeddedAtomCrystal : public ArgonBox {
+ public:
+  /**
+   * @brief Write the potential tables to disk, read them back and initialise
+   * the crystal at roughly the density of solid Argon.
+   */
+  void SetUp() {
+    ArgonBox::SetUp(125, 1.6);
+    write_setfl();
+    EmbeddedAtomReader reader;
+    eam = std::make_unique<EmbeddedAtom>(reader.parse(path),
+                                         atomic_state->atom_type_idx(), 1.0);
+  }
+
+ protected:
+  std::unique_ptr<EmbeddedAtom> eam;
+  static constexpr double cutoff = 5.0;
+  static constexpr const char* path = "/tmp/test_embedded_atom.eam.alloy";
+
+  /**
+   * @brief Tabulate the potential in the setfl format.
+   */
+  void write_setfl() {
+    const std::size_t num_rho = 2000, num_r = 2000;
+    const double drho = 0.01, dr = cutoff / (num_r - 1);
+    std::ofstream ofs(path);
+    ofs << "Test\nTest\nTest\n1 Ar\n"
+        << num_rho << ' ' << drho << ' ' << num_r << ' ' << dr << ' '
+        << cutoff << '\n'
+        << "18 39.948 5.26 fcc\n";
+    ofs.precision(17);
+    for (std::size_t irho = 0; irho < num_rho; ++irho) {
+      ofs << -std::sqrt(1 + irho * drho) << '\n';
+    }
+    for (std::size_t ir = 0; ir < num_r; ++ir) {
+      ofs << 3 * std::pow(1 - ir * dr / cutoff, 4) << '\n';
+    }
+    for (std::size_t ir = 0; ir < num_r; ++ir) {
+      double r = ir * dr;
+      ofs << r * 0.5 * std::exp(-2 * (r - 3.5)) * std::pow(1 - r / cutoff, 4)
+          << '\n';
+    }
+  }
+
+  /**
+   * @brief Evaluate the potential energy of the crystal.
+   * @return The potential energy.
+   */
+  double potential() {
+    atomic_state->zero_forces();
+    return eam->evaluate(*atomic_state, *cell);
+  }
+};
+
+/**
+ * @brief Forces on the crystal should match their finite differences.
+ */
+TEST_F(TestEmbeddedAtomCrystal, FiniteDifferenceForces) {
+  expect_forces_match_finite_difference(*atomic_state,
+                                        [&]() { return potential(); },
+                                        {0, 17, 62, 124}, 1E-5, 1E-8);
+}
+
+/**
+ * @brief The virial of the crystal should match its dilation derivative.
+ */
+TEST_F(TestEmbeddedAtomCrystal, DilationVirial) {
+  expect_virial_matches_dilation(*atomic_state, *cell,
+                                 [&]() { return potential(); }, 1E-6);
+}
+
+/**
+ * @brief Internal forces must sum to zero.
+ */
+TEST_F(TestEmbeddedAtomCrystal, NoNetForce) {
+  potential();
+  for (std::size_t idim = 0; idim < 3; ++idim) {
+    double net = 0;
+    for (std::size_t iatom = 0; iatom < atomic_state->num_atoms(); ++iatom) {
+      net += atomic_state->force(iatom)[idim];
+    }
+    ASSERT_NEAR(net, 0.0, 1E-10);
+  }
+}
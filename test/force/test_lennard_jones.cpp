@@ -12,6 +12,7 @@
 #include "tyche/atom/atomic_state_reader.hpp"
 #include "tyche/force/lennard_jones.hpp"
 #include "test/force/test_lennard_jones.hpp"
+#include "test/base_fixtures/finite_difference.hpp"
 
 using namespace tyche;
 
@@ -34,3 +35,17 @@ TEST_F(TestLennardJonesEquilibrium, PotentialAndForce) {
   ASSERT_NEAR(forces[4], 0.0, 1E-14);
   ASSERT_NEAR(forces[5], 0.0, 1E-14);
 }
+
+/**
+ * @brief The virial of the crystal should match its dilation derivative.
+ */
+TEST_F(TestLennardJonesCrystal, Virial) {
+  SetUp(125, 1.784E-1);
+  expect_virial_matches_dilation(
+      *atomic_state, *cell,
+      [&]() {
+        atomic_state->zero_forces();
+        return lj->evaluate(*atomic_state, *cell);
+      },
+      1E-6);
+}
@@ -0,0 +1,174 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <random>
+#include <fstream>
+#include <cstdint>
+#include <filesystem>
+// Third-Party Libraries
+#include <omp.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/gemm.hpp"
+#include "tyche/force/neural_network.hpp"
+#include "tyche/force/neural_network_reader.hpp"
+#include "test/base_fixtures/silicon_crystal.hpp"
+#include "test/base_fixtures/finite_difference.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Neural network potential of a Silicon crystal, with a small model of
+ * random weights written to disk and read back in.
+ */
+class TestNeuralNetwork : public SiliconCrystal {
+ public:
+  /**
+   * @brief Initialise the crystal, and write and read back the model.
+   */
+  void SetUp() override {
+    SiliconCrystal::SetUp(3, 0.1);
+    path = std::filesystem::temp_directory_path() / "tyche_test_nnp.bin";
+    write_model();
+    NeuralNetworkReader reader;
+    force = std::make_unique<NeuralNetwork>(
+        reader.parse(path), atomic_state->atom_type_idx(), 1.0);
+  }
+
+  void TearDown() override { std::filesystem::remove(path); }
+
+ protected:
+  std::filesystem::path path;
+  std::unique_ptr<NeuralNetwork> force;
+
+  /**
+   * @brief Evaluate the potential energy of the crystal.
+   * @return The potential energy.
+   */
+  double potential() {
+    atomic_state->zero_forces();
+    return force->evaluate(*atomic_state, *cell);
+  }
+
+ private:
+  /**
+   * @brief Write a model of Silicon with four radial and four angular
+   * functions, and two hidden layers of random weights.
+   */
+  void write_model() {
+    std::ofstream ofs(path, std::ios::binary);
+    auto u32 = [&](std::uint32_t value) {
+      ofs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto f64 = [&](double value) {
+      ofs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    ofs.write("TYCHENNP", 8);
+    u32(1);
+    f64(4.0);
+    u32(1);
+    u32(2);
+    ofs.write("Si", 2);
+    u32(4);
+    for (double r_s : {0.0, 1.5, 2.5, 3.5}) {
+      u32(0);
+      f64(1.0);
+      f64(r_s);
+    }
+    u32(4);
+    for (double zeta : {1.0, 2.0}) {
+      for (double lambda : {-1.0, 1.0}) {
+        u32(0);
+        u32(0);
+        f64(0.05);
+        f64(zeta);
+        f64(lambda);
+      }
+    }
+    for (std::size_t q = 0; q < 8; ++q) f64(1.0);
+    for (std::size_t q = 0; q < 8; ++q) f64(0.5);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-1, 1);
+    const std::uint32_t widths[] = {8, 6, 5, 1};
+    const std::uint32_t activations[] = {1, 2, 0};
+    u32(3);
+    for (std::size_t ilayer = 0; ilayer < 3; ++ilayer) {
+      u32(widths[ilayer]);
+      u32(widths[ilayer + 1]);
+      u32(activations[ilayer]);
+      for (std::size_t w = 0; w < widths[ilayer] * widths[ilayer + 1]; ++w) {
+        f64(distribution(generator));
+      }
+      for (std::size_t b = 0; b < widths[ilayer + 1]; ++b) {
+        f64(distribution(generator));
+      }
+    }
+  }
+};
+
+/**
+ * @brief Both matrix multiplies should agree with a naive triple loop.
+ */
+TEST(TestGemm, MatchesNaive) {
+  const std::size_t m = 37, n = 5, k = 11;
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<double> distribution(-1, 1);
+  std::vector<double> a(m * k), b(k * n), bt(n * k), c(m * n), ct(m * n);
+  for (auto& x : a) x = distribution(generator);
+  for (auto& x : b) x = distribution(generator);
+  for (std::size_t p = 0; p < k; ++p) {
+    for (std::size_t j = 0; j < n; ++j) bt[j * k + p] = b[p * n + j];
+  }
+  gemm(m, n, k, a.data(), b.data(), c.data());
+  gemm_nt(m, n, k, a.data(), bt.data(), ct.data());
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      double expected = 0;
+      for (std::size_t p = 0; p < k; ++p) {
+        expected += a[i * k + p] * b[p * n + j];
+      }
+      ASSERT_NEAR(c[i * n + j], expected, 1E-12);
+      ASSERT_NEAR(ct[i * n + j], expected, 1E-12);
+    }
+  }
+}
+
+/**
+ * @brief Forces on the crystal should match their finite differences.
+ */
+TEST_F(TestNeuralNetwork, FiniteDifferenceForces) {
+  expect_forces_match_finite_difference(*atomic_state,
+                                        [&]() { return potential(); },
+                                        {0, 9, 100, 215}, 1E-5, 1E-8);
+}
+
+/**
+ * @brief The virial of the crystal should match its dilation derivative.
+ */
+TEST_F(TestNeuralNetwork, Virial) {
+  expect_virial_matches_dilation(*atomic_state, *cell,
+                                 [&]() { return potential(); }, 1E-6);
+}
+
+/**
+ * @brief Energy and forces shouldn't depend on the number of threads beyond
+ * round-off from the order of summation.
+ */
+TEST_F(TestNeuralNetwork, ThreadInvariance) {
+  omp_set_num_threads(1);
+  double serial = potential();
+  std::vector<double> serial_force(atomic_state->force(),
+                                   atomic_state->force() +
+                                       3 * atomic_state->num_atoms());
+  omp_set_num_threads(4);
+  double parallel = potential();
+  ASSERT_NEAR(parallel, serial, 1E-12 * std::abs(serial));
+  for (std::size_t idx = 0; idx < serial_force.size(); ++idx) {
+    ASSERT_NEAR(atomic_state->force()[idx], serial_force[idx], 1E-12);
+  }
+}
@@ -0,0 +1,148 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <random>
+#include <type_traits>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/atom_type_reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/force/buckingham.hpp"
+#include "tyche/force/morse.hpp"
+#include "tyche/force/born_mayer.hpp"
+#include "tyche/force/weeks_chandler_andersen.hpp"
+#include "test/base_fixtures/finite_difference.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Pair potential evaluation of a disordered simple cubic lattice of
+ * Argon-like atoms.
+ * @tparam Potential The pair potential to evaluate.
+ */
+template <class Potential>
+class TestPairPotential : public ::testing::Test {
+ public:
+  void SetUp() override {
+    toml::table config = toml::parse(toml);
+    AtomTypeReader reader;
+    atom_types = reader.parse(*config["AtomTypes"].as_table());
+
+    const std::size_t atoms_per_dim = 6;
+    const std::size_t num_atoms = atoms_per_dim * atoms_per_dim * atoms_per_dim;
+    cell = std::make_unique<CubicCell>(atoms_per_dim * spacing);
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution{0.0, 0.15};
+    std::vector<std::shared_ptr<AtomType>> types(num_atoms, atom_types["Ar"]);
+    Tensor<double, 2> pos(num_atoms, 3);
+    std::size_t iatom = 0;
+    for (std::size_t ix = 0; ix < atoms_per_dim; ++ix) {
+      for (std::size_t iy = 0; iy < atoms_per_dim; ++iy) {
+        for (std::size_t iz = 0; iz < atoms_per_dim; ++iz) {
+          pos(iatom, 0) = ix * spacing + distribution(generator);
+          pos(iatom, 1) = iy * spacing + distribution(generator);
+          pos(iatom, 2) = iz * spacing + distribution(generator);
+          ++iatom;
+        }
+      }
+    }
+    atomic_state = std::make_shared<DynamicAtomicState>();
+    atomic_state->add(std::move(types), std::move(pos));
+    force = make(atomic_state->atom_type_idx());
+  }
+
+ protected:
+  std::unique_ptr<CubicCell> cell;
+  std::shared_ptr<DynamicAtomicState> atomic_state;
+  std::map<std::string, std::shared_ptr<AtomType>> atom_types;
+  std::unique_ptr<Potential> force;
+
+  static constexpr double spacing = 3.8;
+  static constexpr double cutoff = 8.0;
+  // Parameters are chosen to give energies and forces of a similar scale to
+  // the Lennard-Jones potential of Argon, in internal units
+  static constexpr std::string_view toml = R"(
+    [AtomTypes.Ar]
+    sigma_lj = 3.405
+    eps_lj = 0.000119188
+    A_buckingham = 30.0
+    rho_buckingham = 0.3
+    C_buckingham = 0.746
+    D_morse = 0.000119188
+    alpha_morse = 1.6
+    r0_morse = 3.82
+    A_born_mayer = 30.0
+    rho_born_mayer = 0.3
+  )"sv;
+
+  /**
+   * @brief Construct the potential.
+   * @param idx Mapping from atom type to an index on [0,num_atom_types).
+   * @return The potential.
+   */
+  static std::unique_ptr<Potential> make(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& idx) {
+    if constexpr (std::is_same_v<Potential, WeeksChandlerAndersen>) {
+      return std::make_unique<Potential>(idx, 1.0);
+    } else {
+      return std::make_unique<Potential>(idx, cutoff, 1.0);
+    }
+  }
+
+  /**
+   * @brief Evaluate the potential energy of the atomic state.
+   * @return The potential energy.
+   */
+  double potential() {
+    atomic_state->zero_forces();
+    return force->evaluate(*atomic_state, *cell);
+  }
+};
+
+using PairPotentials =
+    ::testing::Types<Buckingham, Morse, BornMayer, WeeksChandlerAndersen>;
+TYPED_TEST_SUITE(TestPairPotential, PairPotentials);
+
+/**
+ * @brief Forces on the lattice should match their finite differences.
+ */
+TYPED_TEST(TestPairPotential, FiniteDifferenceForces) {
+  expect_forces_match_finite_difference(*this->atomic_state,
+                                        [&]() { return this->potential(); },
+                                        {0, 9, 100, 215}, 1E-5, 1E-10);
+}
+
+/**
+ * @brief The virial of the lattice should match its dilation derivative.
+ */
+TYPED_TEST(TestPairPotential, Virial) {
+  expect_virial_matches_dilation(*this->atomic_state, *this->cell,
+                                 [&]() { return this->potential(); }, 1E-6);
+}
+
+/**
+ * @brief Energies are shifted to vanish at the cutoff, so a dimer's energy is
+ * continuous as it's pulled apart across it.
+ */
+TYPED_TEST(TestPairPotential, ContinuousAtCutoff) {
+  auto type = this->atom_types["Ar"];
+  auto pair_cutoff = TypeParam::pair_cutoff(TypeParam::mix(*type, *type),
+                                            this->cutoff);
+  auto pot_at = [&](double r) {
+    Tensor<double, 2> pos(2, 3);
+    pos(1, 0) = r;
+    this->atomic_state = std::make_shared<DynamicAtomicState>();
+    this->atomic_state->add({type, type}, std::move(pos));
+    this->cell = std::make_unique<CubicCell>(4 * this->cutoff);
+    this->force = this->make(this->atomic_state->atom_type_idx());
+    return this->potential();
+  };
+  ASSERT_NEAR(pot_at(pair_cutoff * (1 - 1E-9)), 0, 1E-12);
+  ASSERT_EQ(pot_at(pair_cutoff * (1 + 1E-9)), 0);
+}
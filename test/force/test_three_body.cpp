@@ -0,0 +1,112 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/force/tersoff.hpp"
+#include "tyche/force/stillinger_weber.hpp"
+#include "test/base_fixtures/silicon_crystal.hpp"
+#include "test/base_fixtures/finite_difference.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Three-body force evaluation of a Silicon crystal.
+ * @tparam ThreeBodyForce The force to evaluate.
+ */
+template <class ThreeBodyForce>
+class TestThreeBody : public SiliconCrystal {
+ public:
+  /**
+   * @brief Initialise the crystal and the force.
+   * @param noise Standard deviation of random displacements from the lattice.
+   */
+  void SetUp(double noise) {
+    SiliconCrystal::SetUp(3, noise);
+    force =
+        std::make_unique<ThreeBodyForce>(atomic_state->atom_type_idx(), 1.0);
+  }
+
+  /**
+   * @brief Just need an override of the argumentless SetUp for gtest.
+   */
+  void SetUp() override {}
+
+ protected:
+  std::unique_ptr<ThreeBodyForce> force;
+
+  /**
+   * @brief Evaluate the potential energy of the crystal.
+   * @return The potential energy.
+   */
+  double potential() {
+    atomic_state->zero_forces();
+    return force->evaluate(*atomic_state, *cell);
+  }
+};
+
+class TestStillingerWeber : public TestThreeBody<StillingerWeber> {};
+class TestTersoff : public TestThreeBody<Tersoff> {};
+
+/**
+ * @brief Cohesive energy of the diamond lattice should match the value the
+ * potential was fitted to.
+ */
+TEST_F(TestStillingerWeber, CohesiveEnergy) {
+  SetUp(0);
+  double pot = potential() / atomic_state->num_atoms();
+  ASSERT_NEAR(pot / constants::ev_to_internal, -4.3366, 1E-4);
+}
+
+/**
+ * @brief Forces on the crystal should match their finite differences.
+ */
+TEST_F(TestStillingerWeber, FiniteDifferenceForces) {
+  SetUp(0.1);
+  expect_forces_match_finite_difference(*atomic_state,
+                                        [&]() { return potential(); },
+                                        {0, 9, 100, 215}, 1E-5, 1E-8);
+}
+
+/**
+ * @brief The virial of the crystal should match its dilation derivative.
+ */
+TEST_F(TestStillingerWeber, Virial) {
+  SetUp(0.1);
+  expect_virial_matches_dilation(*atomic_state, *cell,
+                                 [&]() { return potential(); }, 1E-6);
+}
+
+/**
+ * @brief Cohesive energy of the diamond lattice should match the value the
+ * potential was fitted to.
+ */
+TEST_F(TestTersoff, CohesiveEnergy) {
+  SetUp(0);
+  double pot = potential() / atomic_state->num_atoms();
+  ASSERT_NEAR(pot / constants::ev_to_internal, -4.6296, 1E-4);
+}
+
+/**
+ * @brief Forces on the crystal should match their finite differences.
+ */
+TEST_F(TestTersoff, FiniteDifferenceForces) {
+  SetUp(0.1);
+  expect_forces_match_finite_difference(*atomic_state,
+                                        [&]() { return potential(); },
+                                        {0, 9, 100, 215}, 1E-5, 1E-8);
+}
+
+/**
+ * @brief The virial of the crystal should match its dilation derivative.
+ */
+TEST_F(TestTersoff, Virial) {
+  SetUp(0.1);
+  expect_virial_matches_dilation(*atomic_state, *cell,
+                                 [&]() { return potential(); }, 1E-6);
+}
@@ -0,0 +1,90 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/system/barostat.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet_npt_berendsen.hpp"
+#include "tyche/integrate/velocity_verlet_npt_mtk.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Lennard-Jones Argon gas propagated at constant pressure. At this
+ * density and temperature the pressure is about 110 bar.
+ */
+class TestBarostatArgonGas : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.784E-1);
+    forces.add(std::move(lj));
+  }
+
+ protected:
+  Forces forces;
+  static constexpr double dt = 5;
+  static constexpr double temperature = 300;
+  static constexpr double t_relax = 200;
+  static constexpr double pressure = 150;
+  static constexpr double p_relax = 1000;
+};
+
+/**
+ * @brief The weak-coupling barostat compresses the gas until its average
+ * pressure matches the target.
+ */
+TEST_F(TestBarostatArgonGas, BerendsenRelaxesPressure) {
+  const std::size_t num_steps = 6000, num_equilibrate = 2000;
+  // Compressibility of an ideal gas, 1 / P
+  VelocityVerletNPTBerendsen berendsen(dt, num_steps, temperature, t_relax, 7,
+                                       pressure, p_relax, 1 / pressure);
+  berendsen.initialise(*atomic_state);
+  forces.evaluate(*atomic_state, *cell);
+  const double initial_volume = cell->volume();
+
+  double average = 0;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    berendsen.step(*atomic_state, forces, *cell);
+    if (istep >= num_equilibrate) {
+      average += Barostat::pressure(*atomic_state, *cell);
+    }
+  }
+  average /= num_steps - num_equilibrate;
+  ASSERT_LT(cell->volume(), initial_volume);
+  ASSERT_NEAR(average, pressure, 0.05 * pressure);
+}
+
+/**
+ * @brief The energy of the atoms plus that of the barostat and thermostat
+ * chain is conserved, whilst the pressure fluctuates about the target.
+ */
+TEST_F(TestBarostatArgonGas, MTKConservedEnergyAndPressure) {
+  const std::size_t num_steps = 6000, num_equilibrate = 2000;
+  VelocityVerletNPTMTK mtk(dt, num_steps, temperature, t_relax, 3, pressure,
+                           p_relax, 1);
+  mtk.initialise(*atomic_state);
+  double initial = forces.evaluate(*atomic_state, *cell) +
+                   atomic_state->kinetic() + mtk.barostat_energy(*cell);
+
+  double average = 0, max_drift = 0;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    mtk.step(*atomic_state, forces, *cell);
+    double pot = forces.evaluate(*atomic_state, *cell);
+    double conserved = pot + atomic_state->kinetic() +
+                       mtk.thermostat_energy() + mtk.barostat_energy(*cell);
+    max_drift = std::max(max_drift, std::abs(conserved - initial));
+    if (istep >= num_equilibrate) {
+      average += Barostat::pressure(*atomic_state, *cell);
+    }
+  }
+  average /= num_steps - num_equilibrate;
+  ASSERT_LT(max_drift, 1E-3 * std::abs(initial));
+  ASSERT_NEAR(average, pressure, 0.1 * pressure);
+}
@@ -0,0 +1,69 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_bussi.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Lennard-Jones Argon crystal propagated with stochastic velocity
+ * rescaling.
+ */
+class TestBussiArgonCrystal : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.784E-1);
+    forces.add(std::move(lj));
+  }
+
+ protected:
+  Forces forces;
+  static constexpr double dt = 5;
+  static constexpr double temperature = 300;
+  static constexpr double t_relax = 50;
+};
+
+/**
+ * @brief The energy of the atoms less that taken out by the thermostat is
+ * conserved, and the kinetic temperature has the mean and fluctuations of the
+ * canonical ensemble, where 3N - 3 degrees of freedom give a standard
+ * deviation of T \sqrt{2 / (3N - 3)}.
+ */
+TEST_F(TestBussiArgonCrystal, CanonicalTemperature) {
+  const std::size_t num_steps = 8000, num_equilibrate = 1000;
+  VelocityVerletNVTBussi bussi(dt, num_steps, temperature, t_relax, 42);
+  bussi.initialise(*atomic_state);
+  double initial = forces.evaluate(*atomic_state, *cell) +
+                   atomic_state->kinetic();
+
+  double sum = 0, sum_sq = 0, max_drift = 0;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    bussi.step(*atomic_state, forces, *cell);
+    double pot = forces.evaluate(*atomic_state, *cell);
+    double conserved =
+        pot + atomic_state->kinetic() + bussi.thermostat_energy();
+    max_drift = std::max(max_drift, std::abs(conserved - initial));
+    if (istep >= num_equilibrate) {
+      double t = Thermostat::temperature(*atomic_state);
+      sum += t;
+      sum_sq += t * t;
+    }
+  }
+  const std::size_t num_samples = num_steps - num_equilibrate;
+  double mean = sum / num_samples;
+  double std_dev = std::sqrt(sum_sq / num_samples - mean * mean);
+  double num_dof = 3 * atomic_state->num_atoms() - 3;
+  ASSERT_LT(max_drift, 1E-3 * std::abs(initial));
+  ASSERT_NEAR(mean, temperature, 0.03 * temperature);
+  ASSERT_NEAR(std_dev, temperature * std::sqrt(2 / num_dof),
+              0.2 * temperature * std::sqrt(2 / num_dof));
+}
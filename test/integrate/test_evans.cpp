@@ -0,0 +1,141 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_evans.hpp"
+#include "tyche/simulation/molecular_dynamics.hpp"
+#include "tyche/simulation/molecular_dynamics_builder.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Lennard-Jones Argon crystal propagated with the Evans thermostat.
+ */
+class TestEvansArgonCrystal : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.784E-1);
+    forces.add(std::move(lj));
+    path = std::filesystem::temp_directory_path() / "tyche_test_evans.therm";
+  }
+
+  void TearDown() override { std::filesystem::remove(path); }
+
+ protected:
+  Forces forces;
+  std::filesystem::path path;
+  static constexpr double dt = 5;
+  static constexpr double temperature = 300;
+  static constexpr std::size_t num_steps = 500;
+
+  /**
+   * @brief Take the Evans thermostat's step as two separate passes over the
+   * atoms either side of the Velocity Verlet step, each computing chi afresh
+   * and scaling the velocities by exp(-chi dt / 2).
+   * @param state The atomic state to propagate forwards.
+   */
+  void two_pass_step(DynamicAtomicState& state) {
+    const std::size_t num_atoms = state.num_atoms();
+    double* pos = std::to_address(state.pos());
+    double* vel = std::to_address(state.vel());
+    const double* force = std::to_address(state.force());
+    auto half_thermostat = [&]() {
+      double power = 0, mv2 = 0;
+      for (std::size_t idx = 0; idx < 3 * num_atoms; ++idx) {
+        power += vel[idx] * force[idx];
+        mv2 += state.mass()[idx / 3] * vel[idx] * vel[idx];
+      }
+      const double scale = std::exp(-power / mv2 * dt / 2);
+      for (std::size_t idx = 0; idx < 3 * num_atoms; ++idx) {
+        vel[idx] *= scale;
+      }
+    };
+    auto kick = [&]() {
+      for (std::size_t idx = 0; idx < 3 * num_atoms; ++idx) {
+        vel[idx] += dt / 2 * state.inv_mass()[idx / 3] * force[idx];
+      }
+    };
+
+    half_thermostat();
+    kick();
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+        pos[idim] += dt * vel[idim];
+      }
+      cell->pbc(pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]);
+    }
+    forces.evaluate(state, *cell);
+    kick();
+    half_thermostat();
+  }
+};
+
+/**
+ * @brief Fusing the thermostat into the kicks and deferring its closing
+ * half-step follows the same trajectory as taking each half-step in its own
+ * passes, whether or not it's flushed between steps.
+ */
+TEST_F(TestEvansArgonCrystal, FusedMatchesTwoPass) {
+  VelocityVerletNVTEvans evans(dt, num_steps, temperature, 42);
+  evans.initialise(*atomic_state);
+  auto reference = std::make_shared<DynamicAtomicState>(*atomic_state);
+  forces.evaluate(*atomic_state, *cell);
+  forces.evaluate(*reference, *cell);
+
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    evans.step(*atomic_state, forces, *cell);
+    if (istep == num_steps / 2) evans.flush(*atomic_state);
+    two_pass_step(*reference);
+  }
+  for (std::size_t idx = 0; idx < 3 * atomic_state->num_atoms(); ++idx) {
+    ASSERT_NEAR(atomic_state->pos()[idx], reference->pos()[idx], 1E-10);
+    ASSERT_NEAR(atomic_state->vel()[idx], reference->vel()[idx], 1E-12);
+  }
+}
+
+/**
+ * @brief Every step written by a molecular dynamics simulation reports the
+ * kinetic temperature held by the thermostat, even though its closing
+ * half-step is otherwise deferred to the next step.
+ */
+TEST_F(TestEvansArgonCrystal, WrittenAtTarget) {
+  Reader::Mapping integrator = {{"type", std::string("VelocityVerlet")},
+                                {"timestep", dt},
+                                {"num_steps", double(num_steps)},
+                                {"Control.ensemble", std::string("NVT")},
+                                {"Control.type", std::string("Evans")},
+                                {"Control.temperature", temperature},
+                                {"Control.seed", 42.0}};
+  auto simulation = MolecularDynamics::create(atomic_state)
+                        .integrator(integrator)
+                        .force({{"type", std::string("LennardJones")}})
+                        .cell({{"type", std::string("Cubic")},
+                               {"length", cell->length()}})
+                        .output({{"type", std::string("therm")},
+                                 {"frequency", 10.0},
+                                 {"path", path.string()}})
+                        .build();
+  simulation.run();
+
+  std::ifstream ifs(path);
+  std::string header;
+  std::getline(ifs, header);
+  std::size_t num_written = 0;
+  for (double step, time, temp; ifs >> step >> time >> temp;) {
+    ASSERT_NEAR(temp, temperature, 1E-3 * temperature);
+    ++num_written;
+  }
+  ASSERT_EQ(num_written, num_steps / 10);
+}
@@ -0,0 +1,120 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdexcept>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_hybrid_monte_carlo.hpp"
+#include "tyche/integrate/integrate_factory.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Lennard-Jones Argon crystal sampled by hybrid Monte Carlo.
+ */
+class TestHybridMonteCarloArgonCrystal : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.784E-1);
+    forces.add(std::move(lj));
+  }
+
+ protected:
+  Forces forces;
+  static constexpr double temperature = 300;
+  static constexpr std::size_t trajectory_steps = 10;
+};
+
+/**
+ * @brief With a time increment several times that which conserves energy in
+ * molecular dynamics, most trajectories are still accepted, and the kinetic
+ * temperature has the mean and fluctuations of the canonical ensemble, where
+ * the velocities drawn for all 3N degrees of freedom give a standard deviation
+ * of T \sqrt{2 / 3N}.
+ */
+TEST_F(TestHybridMonteCarloArgonCrystal, CanonicalTemperature) {
+  const std::size_t num_steps = 2000, num_equilibrate = 200;
+  VelocityVerletNVTHybridMonteCarlo hybrid(20, num_steps, temperature,
+                                           trajectory_steps, 42);
+  hybrid.initialise(*atomic_state);
+
+  double sum = 0, sum_sq = 0;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    hybrid.step(*atomic_state, forces, *cell);
+    if (istep >= num_equilibrate) {
+      double t = Thermostat::temperature(*atomic_state);
+      sum += t;
+      sum_sq += t * t;
+    }
+  }
+  const std::size_t num_samples = num_steps - num_equilibrate;
+  double mean = sum / num_samples;
+  double std_dev = std::sqrt(sum_sq / num_samples - mean * mean);
+  double num_dof = 3 * atomic_state->num_atoms();
+  double acceptance = double(hybrid.accepted()) / hybrid.current_step();
+  spdlog::info("Accepted {:.1f}% of trajectories.", 100 * acceptance);
+  ASSERT_GT(acceptance, 0.5);
+  ASSERT_LT(acceptance, 1);
+  ASSERT_NEAR(mean, temperature, 0.03 * temperature);
+  ASSERT_NEAR(std_dev, temperature * std::sqrt(2 / num_dof),
+              0.2 * temperature * std::sqrt(2 / num_dof));
+}
+
+/**
+ * @brief With a time increment so large that every trajectory blows up and is
+ * rejected, the positions, forces and potential energy are left exactly as
+ * they started.
+ */
+TEST_F(TestHybridMonteCarloArgonCrystal, RejectionRestores) {
+  VelocityVerletNVTHybridMonteCarlo hybrid(500, 10, temperature,
+                                           trajectory_steps, 42);
+  hybrid.initialise(*atomic_state);
+  const std::size_t size = 3 * atomic_state->num_atoms();
+  const double potential = forces.evaluate(*atomic_state, *cell);
+  std::vector<double> pos(atomic_state->pos(), atomic_state->pos() + size);
+  std::vector<double> force(atomic_state->force(),
+                            atomic_state->force() + size);
+  const double virial = atomic_state->virial();
+
+  for (std::size_t istep = 0; istep < 10; ++istep) {
+    hybrid.step(*atomic_state, forces, *cell);
+  }
+  ASSERT_EQ(hybrid.accepted(), 0);
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    ASSERT_EQ(atomic_state->pos()[idx], pos[idx]);
+    ASSERT_EQ(atomic_state->force()[idx], force[idx]);
+  }
+  ASSERT_EQ(atomic_state->virial(), virial);
+  // The forces were last evaluated along a rejected trajectory
+  ASSERT_EQ(hybrid.potential(forces), potential);
+}
+
+/**
+ * @brief Drawn velocities wouldn't satisfy constraints, so the factory refuses
+ * a topology with them rather than the first step.
+ */
+TEST_F(TestHybridMonteCarloArgonCrystal, RefusesConstraints) {
+  auto topology = std::make_shared<Topology>();
+  topology->constraints.add({0, 1}, {1.0});
+  topology->sort();
+  Reader::Mapping config = {
+      {"type", std::string("VelocityVerlet")},
+      {"timestep", 1.0},
+      {"num_steps", 10.0},
+      {"Control.ensemble", std::string("NVT")},
+      {"Control.type", std::string("HybridMonteCarlo")},
+      {"Control.temperature", temperature},
+      {"Control.trajectory_steps", double(trajectory_steps)},
+      {"Control.seed", 42.0}};
+  ASSERT_NO_THROW(IntegrateFactory::create(config));
+  ASSERT_THROW(IntegrateFactory::create(config, topology), std::runtime_error);
+}
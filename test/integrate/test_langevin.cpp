@@ -0,0 +1,74 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+// Third-Party Libraries
+#include <omp.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_langevin.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Lennard-Jones Argon crystal propagated with Langevin dynamics.
+ */
+class TestLangevinArgonCrystal : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.784E-1);
+    forces.add(std::move(lj));
+  }
+
+ protected:
+  Forces forces;
+  static constexpr double dt = 5;
+  static constexpr double temperature = 300;
+  static constexpr double t_relax = 200;
+};
+
+/**
+ * @brief Starting from rest, the kinetic temperature should relax to that of
+ * the heat bath and then fluctuate about it.
+ */
+TEST_F(TestLangevinArgonCrystal, Thermalises) {
+  const std::size_t num_steps = 4000, num_equilibrate = 1000;
+  VelocityVerletNVTLangevin langevin(dt, num_steps, temperature, t_relax, 42);
+  forces.evaluate(*atomic_state, *cell);
+  double average = 0;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    langevin.step(*atomic_state, forces, *cell);
+    if (istep >= num_equilibrate) {
+      average += Thermostat::temperature(*atomic_state);
+    }
+  }
+  average /= num_steps - num_equilibrate;
+  ASSERT_NEAR(average, temperature, 0.05 * temperature);
+}
+
+/**
+ * @brief Trajectories depend only on the seed, and not on the number of
+ * threads.
+ */
+TEST_F(TestLangevinArgonCrystal, ThreadInvariance) {
+  const std::size_t num_steps = 200;
+  std::vector<std::vector<double>> positions;
+  for (int num_threads : {1, 4}) {
+    omp_set_num_threads(num_threads);
+    auto state = std::make_shared<DynamicAtomicState>(*atomic_state);
+    VelocityVerletNVTLangevin langevin(dt, num_steps, temperature, t_relax, 7);
+    forces.evaluate(*state, *cell);
+    for (std::size_t istep = 0; istep < num_steps; ++istep) {
+      langevin.step(*state, forces, *cell);
+    }
+    positions.emplace_back(state->pos(), state->pos() + 3 * state->num_atoms());
+  }
+  for (std::size_t idx = 0; idx < positions[0].size(); ++idx) {
+    ASSERT_EQ(positions[0][idx], positions[1][idx]);
+  }
+}
@@ -0,0 +1,106 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <numbers>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/util/constants.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_nose_hoover.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Lennard-Jones Argon crystal propagated with a Nose-Hoover chain.
+ */
+class TestNoseHooverArgonCrystal : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.784E-1);
+    forces.add(std::move(lj));
+  }
+
+ protected:
+  Forces forces;
+  static constexpr double dt = 5;
+  static constexpr double temperature = 300;
+  static constexpr double t_relax = 200;
+  static constexpr std::size_t chain_length = 3;
+};
+
+/**
+ * @brief The energy of the atoms plus that of the thermostat chain is
+ * conserved, whilst the kinetic temperature fluctuates about the target.
+ */
+TEST_F(TestNoseHooverArgonCrystal, ConservedEnergyAndTemperature) {
+  const std::size_t num_steps = 4000, num_equilibrate = 1000;
+  VelocityVerletNVTNoseHoover nose_hoover(dt, num_steps, temperature, t_relax,
+                                          chain_length, 1);
+  nose_hoover.initialise(*atomic_state);
+  double initial = forces.evaluate(*atomic_state, *cell) +
+                   atomic_state->kinetic();
+
+  double average = 0, max_drift = 0;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    nose_hoover.step(*atomic_state, forces, *cell);
+    double pot = forces.evaluate(*atomic_state, *cell);
+    double conserved =
+        pot + atomic_state->kinetic() + nose_hoover.thermostat_energy();
+    max_drift = std::max(max_drift, std::abs(conserved - initial));
+    if (istep >= num_equilibrate) {
+      average += Thermostat::temperature(*atomic_state);
+    }
+  }
+  average /= num_steps - num_equilibrate;
+  ASSERT_LT(max_drift, 1E-3 * std::abs(initial));
+  ASSERT_NEAR(average, temperature, 0.05 * temperature);
+}
+
+/**
+ * @brief A single thermostat of mass N_f kT \tau^2 coupled to an ideal gas
+ * slightly off the target temperature makes the kinetic energy oscillate with
+ * period \sqrt{2} \pi \tau, where \tau is the relaxation time.
+ */
+TEST_F(TestNoseHooverArgonCrystal, OscillationPeriod) {
+  Forces ideal;
+  const double t_relax = 100, dt = 1;
+  const std::size_t num_steps = 1500;
+  VelocityVerletNVTNoseHoover nose_hoover(dt, num_steps, temperature, t_relax,
+                                          1, 1);
+  nose_hoover.initialise(*atomic_state);
+  // Start 5% above the target kinetic energy of the degrees of freedom
+  const double num_dof = 3 * atomic_state->num_atoms() - 3;
+  const double target = 0.5 * num_dof * constants::boltzmann *
+                        constants::joule_to_internal * temperature;
+  const double vscale = std::sqrt(1.05 * target / atomic_state->kinetic());
+  Tensor<double, 2>::iterator vel = atomic_state->vel();
+  for (std::size_t idx = 0; idx < 3 * atomic_state->num_atoms(); ++idx) {
+    vel[idx] *= vscale;
+  }
+  ideal.evaluate(*atomic_state, *cell);
+
+  // Times the kinetic energy falls through the target
+  std::vector<double> crossings;
+  double last = atomic_state->kinetic() - target;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    nose_hoover.step(*atomic_state, ideal, *cell);
+    const double deviation = atomic_state->kinetic() - target;
+    if (last > 0 && deviation <= 0) {
+      crossings.push_back(nose_hoover.time() -
+                          dt * deviation / (deviation - last));
+    }
+    last = deviation;
+  }
+  ASSERT_GE(crossings.size(), 2);
+  const double period = (crossings.back() - crossings.front()) /
+                        (crossings.size() - 1);
+  ASSERT_NEAR(period, std::sqrt(2) * std::numbers::pi * t_relax,
+              0.05 * t_relax);
+}
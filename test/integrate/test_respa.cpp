@@ -0,0 +1,135 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <string>
+#include <stdexcept>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/util/constants.hpp"
+#include "tyche/atom/topology.hpp"
+#include "tyche/force/harmonic_bond.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+#include "tyche/integrate/respa.hpp"
+#include "tyche/integrate/integrate_factory.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Lennard-Jones Argon crystal, with chains of neighbouring atoms held
+ * together by stiff harmonic bonds.
+ */
+class TestRespaArgonCrystal : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.784E-2);
+    const std::size_t chain_length = 5;
+    auto topology = std::make_shared<Topology>();
+    for (std::size_t iatom = 0; iatom < atomic_state->num_atoms(); ++iatom) {
+      if (iatom % chain_length == chain_length - 1) continue;
+      double dx = atomic_state->pos(iatom)[0] - atomic_state->pos(iatom + 1)[0];
+      double dy = atomic_state->pos(iatom)[1] - atomic_state->pos(iatom + 1)[1];
+      double dz = atomic_state->pos(iatom)[2] - atomic_state->pos(iatom + 1)[2];
+      cell->min_image(dx, dy, dz);
+      // Equilibrium bond length 10% from the initial one, so that the bonds
+      // start vibrating
+      double dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+      topology->bonds.add({iatom, iatom + 1}, {bond_k, 1.1 * dist});
+    }
+    topology->sort();
+    atomic_state->set_topology(topology);
+  }
+
+ protected:
+  //< Stiff bond, with a period an order of magnitude shorter than the
+  //< Lennard-Jones vibrations
+  static constexpr double bond_k = 10 * constants::ev_to_internal;
+  static constexpr double dt = 4;
+  static constexpr std::size_t inner_steps = 4;
+  static constexpr std::size_t num_steps = 500;
+};
+
+/**
+ * @brief With every force at the fast level and a single inner step, RESPA is
+ * Velocity Verlet.
+ */
+TEST_F(TestRespaArgonCrystal, SingleLevelIsVelocityVerlet) {
+  auto reference = std::make_shared<DynamicAtomicState>(*atomic_state);
+  Forces forces, reference_forces;
+  forces.add(std::make_unique<LennardJones>(atomic_state->atom_type_idx()));
+  forces.add(std::make_unique<HarmonicBond>(atomic_state->topology()));
+  reference_forces.add(
+      std::make_unique<LennardJones>(atomic_state->atom_type_idx()));
+  reference_forces.add(
+      std::make_unique<HarmonicBond>(atomic_state->topology()));
+
+  Respa respa(dt / inner_steps, num_steps, 1);
+  VelocityVerlet velocity_verlet(dt / inner_steps, num_steps);
+  forces.evaluate(*atomic_state, *cell);
+  reference_forces.evaluate(*reference, *cell);
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    respa.step(*atomic_state, forces, *cell);
+    velocity_verlet.step(*reference, reference_forces, *cell);
+  }
+  for (std::size_t idx = 0; idx < 3 * atomic_state->num_atoms(); ++idx) {
+    ASSERT_NEAR(atomic_state->pos()[idx], reference->pos()[idx], 1E-10);
+    ASSERT_NEAR(atomic_state->vel()[idx], reference->vel()[idx], 1E-10);
+    ASSERT_NEAR(atomic_state->force()[idx], reference->force()[idx], 1E-10);
+  }
+}
+
+/**
+ * @brief Evaluate the bonds at the inner timestep and Lennard-Jones at the
+ * outer timestep, and make sure that energy is conserved over a timestep at
+ * which plain Velocity Verlet would need the bonds at every step.
+ */
+TEST_F(TestRespaArgonCrystal, BondsFastLennardJonesSlow) {
+  Forces forces;
+  forces.add(std::make_unique<HarmonicBond>(atomic_state->topology()), 0);
+  forces.add(std::make_unique<LennardJones>(atomic_state->atom_type_idx()), 1);
+  ASSERT_EQ(forces.num_levels(), 2);
+
+  Respa respa(dt, num_steps, inner_steps);
+  double initial = forces.evaluate(*atomic_state, *cell);
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    respa.step(*atomic_state, forces, *cell);
+  }
+  std::vector<double> total_force(atomic_state->force(),
+                                  atomic_state->force() +
+                                      3 * atomic_state->num_atoms());
+  const double potential = respa.potential(forces);
+  double final = forces.evaluate(*atomic_state, *cell) +
+                 atomic_state->kinetic();
+  ASSERT_NEAR(final, initial, 1E-4 * std::abs(initial));
+
+  // Each level was last evaluated at the final positions, so the potential
+  // kept from those evaluations is that of evaluating them again
+  ASSERT_NEAR(potential + atomic_state->kinetic(), final,
+              1E-12 * std::abs(final));
+
+  // The atomic state holds the total force of both levels after each step
+  for (std::size_t idx = 0; idx < total_force.size(); ++idx) {
+    ASSERT_NEAR(total_force[idx], atomic_state->force()[idx], 1E-12);
+  }
+}
+
+/**
+ * @brief RESPA doesn't hold bonds at a fixed length, so is refused for a
+ * topology with constraints rather than integrating them unconstrained.
+ */
+TEST_F(TestRespaArgonCrystal, RefusesConstraints) {
+  auto topology = std::make_shared<Topology>(*atomic_state->topology());
+  topology->constraints.add({0, 1}, {1.0});
+  topology->sort();
+  Reader::Mapping config = {{"type", std::string("RESPA")},
+                            {"timestep", dt},
+                            {"num_steps", double(num_steps)},
+                            {"inner_steps", double(inner_steps)}};
+  ASSERT_NO_THROW(IntegrateFactory::create(config, atomic_state->topology()));
+  ASSERT_THROW(IntegrateFactory::create(config, topology), std::runtime_error);
+}
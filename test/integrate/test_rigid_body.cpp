@@ -0,0 +1,97 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <string>
+#include <vector>
+#include <stdexcept>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/integrate/test_integrate.hpp"
+#include "tyche/atom/topology.hpp"
+#include "tyche/integrate/rigid_body.hpp"
+#include "tyche/integrate/integrate_factory.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Specialisation of the TestIntegrateLennardJonesCrystal fixture using
+ * the rigid-body integrator.
+ */
+class TestRigidBodyArgonCrystal
+    : public TestIntegrateLennardJonesCrystal<RigidBody> {
+ protected:
+  /**
+   * @brief Distance between two atoms under the minimum image convention.
+   * @param iatom The first atom.
+   * @param jatom The second atom.
+   * @return The distance.
+   */
+  double distance(std::size_t iatom, std::size_t jatom) {
+    double dx = atomic_state->pos(iatom)[0] - atomic_state->pos(jatom)[0];
+    double dy = atomic_state->pos(iatom)[1] - atomic_state->pos(jatom)[1];
+    double dz = atomic_state->pos(iatom)[2] - atomic_state->pos(jatom)[2];
+    cell->min_image(dx, dy, dz);
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+};
+
+/**
+ * @brief Group neighbouring atoms of the Argon crystal into rigid triatomic
+ * bodies, leaving the remainder free, and make sure that energy is conserved
+ * and every body keeps its shape.
+ */
+TEST_F(TestRigidBodyArgonCrystal, RigidTriatomics) {
+  SetUp(125, 1.784E-2);
+  const std::size_t body_size = 3;
+  const std::size_t num_bodies = atomic_state->num_atoms() / body_size;
+  auto topology = std::make_shared<Topology>();
+  std::vector<double> initial_distances;
+  for (std::size_t ibody = 0; ibody < num_bodies; ++ibody) {
+    std::size_t iatom = body_size * ibody;
+    topology->rigid_bodies.add({iatom, iatom + 1, iatom + 2});
+    initial_distances.push_back(distance(iatom, iatom + 1));
+    initial_distances.push_back(distance(iatom, iatom + 2));
+    initial_distances.push_back(distance(iatom + 1, iatom + 2));
+  }
+  atomic_state->set_topology(topology);
+
+  double initial = forces->evaluate(*atomic_state, *cell);
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    integrator->step(*atomic_state, *forces, *cell);
+  }
+  double final = forces->evaluate(*atomic_state, *cell) +
+                 atomic_state->kinetic();
+  ASSERT_NEAR(final, initial, 1E-6 * std::abs(initial));
+
+  for (std::size_t ibody = 0; ibody < num_bodies; ++ibody) {
+    std::size_t iatom = body_size * ibody;
+    ASSERT_NEAR(distance(iatom, iatom + 1), initial_distances[3 * ibody],
+                1E-10);
+    ASSERT_NEAR(distance(iatom, iatom + 2), initial_distances[3 * ibody + 1],
+                1E-10);
+    ASSERT_NEAR(distance(iatom + 1, iatom + 2),
+                initial_distances[3 * ibody + 2], 1E-10);
+  }
+}
+
+/**
+ * @brief Rigid-body integrators don't hold distance constraints, so are
+ * refused for a topology with them rather than integrating them unconstrained.
+ */
+TEST_F(TestRigidBodyArgonCrystal, RefusesConstraints) {
+  SetUp(125, 1.784E-2);
+  auto topology = std::make_shared<Topology>();
+  topology->rigid_bodies.add({0, 1, 2});
+  topology->sort();
+  Reader::Mapping config = {{"type", std::string("RigidBody")},
+                            {"timestep", 1.0},
+                            {"num_steps", 10.0}};
+  ASSERT_NO_THROW(IntegrateFactory::create(config, topology));
+  topology->constraints.add({3, 4}, {1.0});
+  topology->sort();
+  ASSERT_THROW(IntegrateFactory::create(config, topology), std::runtime_error);
+}
@@ -8,6 +8,7 @@
 #include <spdlog/spdlog.h>
 // Project Inclusions
 #include "test/integrate/test_integrate.hpp"
+#include "tyche/system/thermostat.hpp"
 #include "tyche/integrate/velocity_verlet.hpp"
 #include "tyche/atom/atomic_state_writer.hpp"
 
@@ -42,3 +43,93 @@ TEST_F(TestVelocityVerletArgonDimer, StationaryEquilibrium) {
     ASSERT_NEAR(*atomic_state->vel(1), 0.0, 1E-15);
   }
 }
+
+/**
+ * @brief Hold chains of neighbouring atoms in the Argon crystal at fixed bond
+ * lengths, and make sure that the bond lengths are maintained, there's no
+ * relative velocity along any bond and energy is conserved.
+ */
+TEST_F(TestVelocityVerletArgonCrystal, ConstrainedChains) {
+  SetUp(125, 1.784E-2);
+  const std::size_t chain_length = 5;
+  auto topology = std::make_shared<Topology>();
+  for (std::size_t iatom = 0; iatom < atomic_state->num_atoms(); ++iatom) {
+    if (iatom % chain_length == chain_length - 1) continue;
+    double dx = atomic_state->pos(iatom)[0] - atomic_state->pos(iatom + 1)[0];
+    double dy = atomic_state->pos(iatom)[1] - atomic_state->pos(iatom + 1)[1];
+    double dz = atomic_state->pos(iatom)[2] - atomic_state->pos(iatom + 1)[2];
+    cell->min_image(dx, dy, dz);
+    topology->constraints.add({iatom, iatom + 1},
+                              {std::sqrt(dx * dx + dy * dy + dz * dz)});
+  }
+  topology->sort();
+  atomic_state->set_topology(topology);
+  const double tolerance = 1E-10;
+  integrator->set_constraints(
+      std::make_unique<Constraints>(atomic_state->topology(), tolerance, 100));
+
+  double initial = forces->evaluate(*atomic_state, *cell);
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    integrator->step(*atomic_state, *forces, *cell);
+  }
+  double final = forces->evaluate(*atomic_state, *cell) +
+                 atomic_state->kinetic();
+  ASSERT_NEAR(final, initial, 1E-6 * std::abs(initial));
+
+  const auto& constraints = topology->constraints;
+  for (std::size_t icon = 0; icon < constraints.size(); ++icon) {
+    auto pos_a = atomic_state->pos(constraints.atoms(0)[icon]);
+    auto pos_b = atomic_state->pos(constraints.atoms(1)[icon]);
+    auto vel_a = atomic_state->vel(constraints.atoms(0)[icon]);
+    auto vel_b = atomic_state->vel(constraints.atoms(1)[icon]);
+    double dx = pos_a[0] - pos_b[0], dy = pos_a[1] - pos_b[1],
+           dz = pos_a[2] - pos_b[2];
+    cell->min_image(dx, dy, dz);
+    double dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+    ASSERT_NEAR(dist, constraints.param(0)[icon], 2 * tolerance * dist);
+    double rv = dx * (vel_a[0] - vel_b[0]) + dy * (vel_a[1] - vel_b[1]) +
+                dz * (vel_a[2] - vel_b[2]);
+    ASSERT_NEAR(rv * dt, 0.0, tolerance * dist * dist);
+  }
+}
+
+/**
+ * @brief Adapt the timestep of the disordered, dense Argon crystal at 300K to
+ * the largest displacement, and make sure no atom moves further than it in a
+ * step, the timestep stays in bounds, the simulated time is the sum of the
+ * timesteps and energy is conserved.
+ */
+TEST_F(TestVelocityVerletArgonCrystal, AdaptiveTimestep) {
+  SetUp(125, 1.784E-1);
+  Thermostat(300, 42).initialise_velocities(*atomic_state);
+  const double dt_min = 1E-2, dt_max = 10, max_displacement = 1E-2;
+  integrator->set_adaptive_timestep(dt_min, dt_max, max_displacement);
+
+  double initial = forces->evaluate(*atomic_state, *cell) +
+                   atomic_state->kinetic();
+  integrator->adapt_timestep(*atomic_state);
+  const std::size_t num_atoms = atomic_state->num_atoms();
+  Tensor<double, 2> prev(num_atoms, 3);
+  double time = 0;
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    std::copy(atomic_state->pos(), atomic_state->pos() + 3 * num_atoms,
+              prev.begin());
+    double step_dt = integrator->dt();
+    ASSERT_GE(step_dt, dt_min);
+    ASSERT_LE(step_dt, dt_max);
+    integrator->step(*atomic_state, *forces, *cell);
+    time += step_dt;
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      double dx = atomic_state->pos(iatom)[0] - prev(iatom, 0);
+      double dy = atomic_state->pos(iatom)[1] - prev(iatom, 1);
+      double dz = atomic_state->pos(iatom)[2] - prev(iatom, 2);
+      cell->min_image(dx, dy, dz);
+      ASSERT_LE(std::sqrt(dx * dx + dy * dy + dz * dz),
+                max_displacement * (1 + 1E-12));
+    }
+  }
+  ASSERT_NEAR(integrator->time(), time, 1E-12 * time);
+  double final = forces->evaluate(*atomic_state, *cell) +
+                 atomic_state->kinetic();
+  ASSERT_NEAR(final, initial, 1E-4 * std::abs(initial));
+}
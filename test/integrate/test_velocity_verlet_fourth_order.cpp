@@ -0,0 +1,163 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/integrate/test_integrate.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+#include "tyche/integrate/velocity_verlet_fourth_order.hpp"
+#include "tyche/integrate/integrate_factory.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Specialisation of the TestIntegrateLennardJonesEquilibrium fixture
+ * using the fourth-order Velocity Verlet integrator.
+ */
+class TestVelocityVerletFourthOrderArgonDimer
+    : public TestIntegrateLennardJonesEquilibrium<VelocityVerletFourthOrder> {
+};
+
+/**
+ * @brief Specialisation of the TestIntegrateLennardJonesCrystal fixture using
+ * the fourth-order Velocity Verlet integrator, starting from the disordered,
+ * dense Argon crystal at 300K.
+ */
+class TestVelocityVerletFourthOrderArgonCrystal
+    : public TestIntegrateLennardJonesCrystal<VelocityVerletFourthOrder> {
+ public:
+  void SetUp() override {
+    TestIntegrateLennardJonesCrystal<VelocityVerletFourthOrder>::SetUp(
+        125, 1.784E-1);
+    Thermostat(300, 42).initialise_velocities(*atomic_state);
+  }
+
+ protected:
+  /**
+   * @brief Integrate the crystal from the start for some simulated time.
+   * @param integrator The integrator to use.
+   * @param time The simulated time, which must be a multiple of the time
+   * increment.
+   * @return The positions at the end, and the largest deviation from the
+   * initial total energy over all steps.
+   */
+  std::pair<std::vector<double>, double> run(Integrate& integrator,
+                                             double time) {
+    SetUp();
+    double initial = forces->evaluate(*atomic_state, *cell) +
+                     atomic_state->kinetic();
+    double deviation = 0;
+    const std::size_t num_steps = std::lround(time / integrator.dt());
+    for (std::size_t istep = 0; istep < num_steps; ++istep) {
+      integrator.step(*atomic_state, *forces, *cell);
+      // Forces are unchanged by evaluating them again at the same positions
+      const double energy = forces->evaluate(*atomic_state, *cell) +
+                            atomic_state->kinetic();
+      deviation = std::max(deviation, std::abs(energy - initial));
+    }
+    const std::size_t num_coords = 3 * atomic_state->num_atoms();
+    std::vector<double> pos(atomic_state->pos(),
+                            atomic_state->pos() + num_coords);
+    return {pos, deviation};
+  }
+
+  /**
+   * @brief Find the largest difference between two sets of positions.
+   * @param a The first positions.
+   * @param b The second positions.
+   * @return The largest difference of any coordinate.
+   */
+  double max_error(const std::vector<double>& a,
+                   const std::vector<double>& b) const {
+    double error = 0;
+    for (std::size_t idx = 0; idx < a.size(); ++idx) {
+      double dx = a[idx] - b[idx], dy = 0, dz = 0;
+      cell->min_image(dx, dy, dz);
+      error = std::max(error, std::abs(dx));
+    }
+    return error;
+  }
+};
+
+/**
+ * @brief Make sure the Argon dimer initialised at Lennard-Jones equilibrium
+ * doesn't deviate appreciably from start position, even though sub-steps
+ * step backwards.
+ */
+TEST_F(TestVelocityVerletFourthOrderArgonDimer, StationaryEquilibrium) {
+  forces->evaluate(*atomic_state, *cell);
+  for (std::size_t istep = 0; istep < num_steps; ++istep) {
+    integrator->step(*atomic_state, *forces, *cell);
+    ASSERT_NEAR(*atomic_state->pos(0), rij_min, 1E-15);
+    ASSERT_NEAR(*atomic_state->pos(1), 0.0, 1E-15);
+    ASSERT_NEAR(*atomic_state->vel(0), 0.0, 1E-15);
+    ASSERT_NEAR(*atomic_state->vel(1), 0.0, 1E-15);
+  }
+  ASSERT_DOUBLE_EQ(integrator->time(), num_steps * dt);
+}
+
+/**
+ * @brief Make sure halving the time increment cuts the error in the positions
+ * after a fixed time sixteenfold for both compositions, as befits fourth
+ * order, while Velocity Verlet only cuts it fourfold.
+ */
+TEST_F(TestVelocityVerletFourthOrderArgonCrystal, FourthOrderConvergence) {
+  const double time = 40;
+  using Scheme = VelocityVerletFourthOrder::Scheme;
+  VelocityVerletFourthOrder reference(0.1, 0, Scheme::Suzuki);
+  const auto exact = run(reference, time).first;
+  for (auto scheme : {Scheme::Yoshida, Scheme::Suzuki}) {
+    VelocityVerletFourthOrder coarse(4, 0, scheme), fine(2, 0, scheme);
+    const double ratio = max_error(run(coarse, time).first, exact) /
+                         max_error(run(fine, time).first, exact);
+    spdlog::info("Error ratio of {} on halving the timestep.", ratio);
+    ASSERT_GT(ratio, 12);
+  }
+  VelocityVerlet coarse(4, 0), fine(2, 0);
+  const double ratio = max_error(run(coarse, time).first, exact) /
+                       max_error(run(fine, time).first, exact);
+  ASSERT_LT(ratio, 6);
+}
+
+/**
+ * @brief Make sure that for the same number of force evaluations, the triple
+ * jump with three times the time increment conserves energy better than
+ * Velocity Verlet.
+ */
+TEST_F(TestVelocityVerletFourthOrderArgonCrystal, EnergyAtEqualCost) {
+  const double time = 600;
+  VelocityVerlet second(1, 0);
+  VelocityVerletFourthOrder fourth(3, 0);
+  const double second_deviation = run(second, time).second;
+  const double fourth_deviation = run(fourth, time).second;
+  spdlog::info("Largest energy deviation of {} for second order, {} for "
+               "fourth.",
+               second_deviation, fourth_deviation);
+  ASSERT_LT(fourth_deviation, second_deviation);
+  ASSERT_DOUBLE_EQ(fourth.time(), time);
+}
+
+/**
+ * @brief Compositions take sub-steps backwards, which SHAKE and RATTLE don't
+ * handle, so a topology with constraints is refused.
+ */
+TEST_F(TestVelocityVerletFourthOrderArgonCrystal, RefusesConstraints) {
+  auto topology = std::make_shared<Topology>();
+  topology->constraints.add({0, 1}, {1.0});
+  topology->sort();
+  Reader::Mapping config = {{"type", std::string("VelocityVerlet")},
+                            {"timestep", 1.0},
+                            {"num_steps", 10.0},
+                            {"scheme", std::string("Yoshida")}};
+  ASSERT_NO_THROW(IntegrateFactory::create(config));
+  ASSERT_THROW(IntegrateFactory::create(config, topology), std::runtime_error);
+}
@@ -19,7 +19,7 @@ using namespace std::string_view_literals;
 class TOMLData {
  public:
   Tensor<double, 2> matrix;
-  std::vector<std::any> strings, array_of_tables;
+  std::vector<std::any> strings, numbers, array_of_tables;
 };
 
 /**
@@ -37,6 +37,8 @@ class TOMLReaderImpl : public TOMLReader<TOMLData> {
     data.matrix = parse_matrix<double>(*config["matrix"].as_array());
     data.strings =
         std::any_cast<std::vector<std::any>>(parse_table(config)["strings"]);
+    data.numbers =
+        std::any_cast<std::vector<std::any>>(parse_table(config)["numbers"]);
     data.array_of_tables = std::any_cast<std::vector<std::any>>(
         parse_table(config)["array_of_tables"]);
     return data;
@@ -68,6 +70,7 @@ class TestTOMLReader : public ::testing::Test {
   strings = [
       'foo', 'bar', 'baz'
   ]
+  numbers = [300, 350.5]
   array_of_tables = [
       { a = 'hello', b = 1 },
       { c = 'world', d = 2.0 }
@@ -99,6 +102,16 @@ TEST_F(TestTOMLReader, ArrayParsing) {
   ASSERT_EQ(std::any_cast<std::string>(data.strings[2]), "baz");
 }
 
+/**
+ * @brief Verify that we can parse an array of numbers from the TOML, which are
+ * all coerced to double.
+ */
+TEST_F(TestTOMLReader, NumberArrayParsing) {
+  ASSERT_EQ(data.numbers.size(), 2);
+  ASSERT_EQ(std::any_cast<double>(data.numbers[0]), 300);
+  ASSERT_EQ(std::any_cast<double>(data.numbers[1]), 350.5);
+}
+
 /**
  * @brief Verify that we can parse an array of tables from the TOML.
  */
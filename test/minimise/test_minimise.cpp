@@ -0,0 +1,110 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <type_traits>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/force/test_lennard_jones.hpp"
+#include "tyche/minimise/fire.hpp"
+#include "tyche/minimise/conjugate_gradient.hpp"
+#include "tyche/minimise/lbfgs.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Minimisation of a disordered Lennard-Jones Argon crystal, dense
+ * enough that neighbours interact.
+ * @tparam Minimiser The minimiser to use, deriving from Minimise.
+ */
+template <class Minimiser>
+class TestMinimise : public TestLennardJonesCrystal {
+ public:
+  void SetUp() override {
+    TestLennardJonesCrystal::SetUp(125, 1.0);
+    forces = std::make_unique<Forces>();
+    forces->add(std::move(lj));
+  }
+
+ protected:
+  std::unique_ptr<Forces> forces;
+
+  static constexpr std::size_t max_steps = 1E4;
+  static constexpr double force_tolerance = 1E-8;
+
+  /**
+   * @brief Construct the minimiser.
+   * @param energy_tolerance Relative change in energy for convergence.
+   * @param force_tolerance Largest force for convergence.
+   * @return The minimiser.
+   */
+  static std::unique_ptr<Minimiser> make(double energy_tolerance,
+                                         double force_tolerance) {
+    if constexpr (std::is_same_v<Minimiser, Fire>) {
+      return std::make_unique<Fire>(max_steps, energy_tolerance,
+                                    force_tolerance, 10, 100);
+    } else if constexpr (std::is_same_v<Minimiser, Lbfgs>) {
+      return std::make_unique<Lbfgs>(max_steps, energy_tolerance,
+                                     force_tolerance, 0.1, 10);
+    } else {
+      return std::make_unique<Minimiser>(max_steps, energy_tolerance,
+                                         force_tolerance, 0.1);
+    }
+  }
+};
+
+using Minimisers = ::testing::Types<Fire, ConjugateGradient, Lbfgs>;
+TYPED_TEST_SUITE(TestMinimise, Minimisers);
+
+/**
+ * @brief Minimise until the largest force falls to the tolerance, making sure
+ * the line search minimisers never go uphill, and that the energy reported is
+ * that of the final structure.
+ */
+TYPED_TEST(TestMinimise, ForceTolerance) {
+  auto& state = *this->atomic_state;
+  auto minimiser = this->make(0, this->force_tolerance);
+  double initial = this->forces->evaluate(state, *this->cell);
+  minimiser->initialise(state, initial);
+  while (!minimiser->finished()) {
+    double previous = minimiser->energy();
+    minimiser->step(state, *this->forces, *this->cell);
+    if constexpr (!std::is_same_v<TypeParam, Fire>) {
+      ASSERT_LE(minimiser->energy(), previous);
+    }
+  }
+  spdlog::info("Converged in {} steps from {} to {}.",
+               minimiser->current_step(), initial, minimiser->energy());
+  ASSERT_TRUE(minimiser->converged());
+  ASSERT_LE(Minimise::max_force(state), this->force_tolerance);
+  ASSERT_LT(minimiser->energy(), initial);
+  ASSERT_NEAR(this->forces->evaluate(state, *this->cell), minimiser->energy(),
+              1E-12 * std::abs(minimiser->energy()));
+}
+
+/**
+ * @brief Minimise until the relative change in energy falls to the tolerance,
+ * which should leave the energy close to that at a tight force tolerance.
+ */
+TYPED_TEST(TestMinimise, EnergyTolerance) {
+  auto& state = *this->atomic_state;
+  Tensor<double, 2> start(state.num_atoms(), 3);
+  std::copy(state.pos(), state.pos() + start.num_elements(), start.begin());
+
+  auto minimise = [&](double energy_tolerance, double force_tolerance) {
+    std::copy(start.begin(), start.end(), state.pos());
+    auto minimiser = this->make(energy_tolerance, force_tolerance);
+    minimiser->initialise(state, this->forces->evaluate(state, *this->cell));
+    while (!minimiser->finished()) {
+      minimiser->step(state, *this->forces, *this->cell);
+    }
+    EXPECT_TRUE(minimiser->converged());
+    return minimiser->energy();
+  };
+  double reference = minimise(0, this->force_tolerance);
+  ASSERT_NEAR(minimise(1E-10, 0), reference, 1E-6 * std::abs(reference));
+}
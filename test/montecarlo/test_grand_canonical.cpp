@@ -0,0 +1,189 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/atom_type_reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/util/constants.hpp"
+#include "tyche/force/morse.hpp"
+#include "tyche/montecarlo/grand_canonical.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Grand canonical Monte Carlo of Argon-like atoms under a Morse
+ * potential, starting from a simple cubic lattice.
+ */
+class TestGrandCanonical : public ::testing::Test {
+ public:
+  void SetUp() override {
+    toml::table config = toml::parse(toml);
+    AtomTypeReader reader;
+    atom_types = reader.parse(*config["AtomTypes"].as_table());
+
+    const std::size_t num_atoms = atoms_per_dim * atoms_per_dim * atoms_per_dim;
+    cell = std::make_unique<CubicCell>(atoms_per_dim * spacing);
+    std::vector<std::shared_ptr<AtomType>> types(num_atoms, atom_types["Ar"]);
+    Tensor<double, 2> pos(num_atoms, 3);
+    std::size_t iatom = 0;
+    for (std::size_t ix = 0; ix < atoms_per_dim; ++ix) {
+      for (std::size_t iy = 0; iy < atoms_per_dim; ++iy) {
+        for (std::size_t iz = 0; iz < atoms_per_dim; ++iz) {
+          pos(iatom, 0) = (ix + 0.5) * spacing;
+          pos(iatom, 1) = (iy + 0.5) * spacing;
+          pos(iatom, 2) = (iz + 0.5) * spacing;
+          ++iatom;
+        }
+      }
+    }
+    atomic_state = std::make_shared<DynamicAtomicState>();
+    atomic_state->add(std::move(types), std::move(pos));
+  }
+
+ protected:
+  std::unique_ptr<CubicCell> cell;
+  std::shared_ptr<DynamicAtomicState> atomic_state;
+  std::map<std::string, std::shared_ptr<AtomType>> atom_types;
+
+  static constexpr std::size_t atoms_per_dim = 4;
+  static constexpr double spacing = 3.8;
+  static constexpr double cutoff = 6.0;
+  static constexpr double skin = 1.0;
+  static constexpr std::string_view toml = R"(
+    [AtomTypes.Ar]
+    sigma_lj = 3.405
+    eps_lj = 0.000119188
+    D_morse = 0.000119188
+    alpha_morse = 1.6
+    r0_morse = 3.82
+  )"sv;
+
+  /**
+   * @brief Construct the grand canonical moves of Argon under the Morse
+   * potential.
+   * @param temperature The temperature to sample at.
+   * @param fugacity The fugacity of the reservoir, in bar.
+   * @return The grand canonical moves.
+   */
+  std::unique_ptr<GrandCanonical> make_moves(double temperature,
+                                             double fugacity) const {
+    std::vector<std::unique_ptr<PairwiseForce>> forces;
+    forces.push_back(
+        std::make_unique<Morse>(atomic_state->atom_type_idx(), cutoff, skin));
+    return std::make_unique<GrandCanonical>(
+        std::move(forces), atom_types.at("Ar"), temperature, fugacity, 0.5,
+        42);
+  }
+
+  /**
+   * @brief Evaluate the potential energy of the atomic state from scratch.
+   * @return The potential energy.
+   */
+  double potential() const {
+    Morse morse(atomic_state->atom_type_idx(), cutoff, skin);
+    atomic_state->zero_forces();
+    return morse.evaluate(*atomic_state, *cell);
+  }
+};
+
+/**
+ * @brief Make sure inserting and removing atoms in place keeps the atom types,
+ * masses and positions of the remaining atoms, with the last atom taking a
+ * removed atom's place, and that storage grows geometrically.
+ */
+TEST_F(TestGrandCanonical, InsertRemoveAtoms) {
+  const std::size_t num_atoms = atomic_state->num_atoms();
+  const auto argon = atom_types["Ar"];
+  std::size_t reallocations = 0;
+  for (std::size_t iatom = 0; iatom < 1000; ++iatom) {
+    const auto* before = std::to_address(atomic_state->pos());
+    const double x = iatom;
+    ASSERT_EQ(atomic_state->insert_atom(argon, {x, 1, 2}), num_atoms + iatom);
+    if (std::to_address(atomic_state->pos()) != before) ++reallocations;
+  }
+  ASSERT_EQ(atomic_state->num_atoms(), num_atoms + 1000);
+  ASSERT_EQ(atomic_state->num_atoms(argon), num_atoms + 1000);
+  ASSERT_LE(reallocations, 8);
+
+  const std::size_t last = atomic_state->num_atoms() - 1;
+  const double x = atomic_state->pos(last)[0];
+  ASSERT_EQ(atomic_state->remove_atom(3), last);
+  ASSERT_EQ(atomic_state->num_atoms(), last);
+  ASSERT_EQ(atomic_state->num_atoms(argon), last);
+  ASSERT_DOUBLE_EQ(atomic_state->pos(3)[0], x);
+  ASSERT_DOUBLE_EQ(atomic_state->pos(3)[2], 2);
+  ASSERT_DOUBLE_EQ(atomic_state->mass()[3], argon->mass());
+  ASSERT_EQ(atomic_state->atom_type(3), argon);
+}
+
+/**
+ * @brief Make sure the energy tracked through accepted moves stays that of
+ * the atoms present, and that atoms are both inserted and removed.
+ */
+TEST_F(TestGrandCanonical, EnergyMatchesForces) {
+  auto moves = make_moves(100.0, 50.0);
+  moves->initialise(*atomic_state, *cell);
+  const double initial = potential();
+  ASSERT_NEAR(moves->energy(), initial, 1E-10 * std::abs(initial));
+  for (std::size_t isweep = 0; isweep < 50; ++isweep) {
+    moves->sweep(*atomic_state, *cell);
+  }
+  spdlog::info("{} atoms, energy from {} to {}.", moves->num_species(),
+               initial, moves->energy());
+  for (auto move : {GrandCanonical::Insert, GrandCanonical::Remove}) {
+    ASSERT_GT(moves->accepted(move), 0);
+  }
+  ASSERT_EQ(moves->num_species(), atomic_state->num_atoms());
+  const double final = potential();
+  ASSERT_NEAR(moves->energy(), final, 1E-9 * std::abs(final));
+}
+
+/**
+ * @brief Make sure a dilute gas settles at about the number of atoms of an
+ * ideal gas at the fugacity, \beta f V.
+ */
+TEST_F(TestGrandCanonical, DiluteGasIsIdeal) {
+  const double temperature = 300.0, fugacity = 20.0;
+  cell = std::make_unique<CubicCell>(60.0);
+  atomic_state = std::make_shared<DynamicAtomicState>();
+  atomic_state->add_atom_type(atom_types["Ar"]);
+  auto moves = make_moves(temperature, fugacity);
+  moves->initialise(*atomic_state, *cell);
+  ASSERT_EQ(moves->num_species(), 0);
+
+  const double kt =
+      constants::boltzmann * constants::joule_to_internal * temperature;
+  const double ideal = fugacity * constants::bar_to_internal / kt *
+                       cell->volume();
+  for (std::size_t isweep = 0; isweep < 200; ++isweep) {
+    moves->sweep(*atomic_state, *cell);
+  }
+  double sum = 0;
+  const std::size_t num_sweeps = 2000;
+  for (std::size_t isweep = 0; isweep < num_sweeps; ++isweep) {
+    moves->sweep(*atomic_state, *cell);
+    sum += moves->num_species();
+  }
+  spdlog::info("Mean of {} atoms, {} for an ideal gas.", sum / num_sweeps,
+               ideal);
+  ASSERT_NEAR(sum / num_sweeps, ideal, 0.05 * ideal);
+}
+
+/**
+ * @brief Make sure a species that isn't an atom type of the atomic state is
+ * refused, as the forces wouldn't know its parameters.
+ */
+TEST_F(TestGrandCanonical, SpeciesMustBeKnown) {
+  auto moves = make_moves(100.0, 1.0);
+  atomic_state = std::make_shared<DynamicAtomicState>();
+  ASSERT_THROW(moves->initialise(*atomic_state, *cell), std::runtime_error);
+}
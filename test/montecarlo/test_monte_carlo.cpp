@@ -0,0 +1,188 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+// Third-Party Libraries
+#include <omp.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/atom_type_reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/force/morse.hpp"
+#include "tyche/montecarlo/energy_cache.hpp"
+#include "tyche/montecarlo/displacement.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Monte Carlo of a disordered simple cubic lattice of Argon-like atoms
+ * under a Morse potential, by default in a cell wide enough for two domains of
+ * the checkerboard along each dimension.
+ */
+class TestMonteCarlo : public ::testing::Test {
+ public:
+  void SetUp() override { SetUp(8); }
+
+  /**
+   * @brief Initialise the lattice.
+   * @param atoms_per_dim The number of atoms along each dimension.
+   */
+  void SetUp(std::size_t atoms_per_dim) {
+    toml::table config = toml::parse(toml);
+    AtomTypeReader reader;
+    atom_types = reader.parse(*config["AtomTypes"].as_table());
+
+    const std::size_t num_atoms = atoms_per_dim * atoms_per_dim * atoms_per_dim;
+    cell = std::make_unique<CubicCell>(atoms_per_dim * spacing);
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution{0.0, 0.15};
+    std::vector<std::shared_ptr<AtomType>> types(num_atoms, atom_types["Ar"]);
+    Tensor<double, 2> pos(num_atoms, 3);
+    std::size_t iatom = 0;
+    for (std::size_t ix = 0; ix < atoms_per_dim; ++ix) {
+      for (std::size_t iy = 0; iy < atoms_per_dim; ++iy) {
+        for (std::size_t iz = 0; iz < atoms_per_dim; ++iz) {
+          pos(iatom, 0) = (ix + 0.5) * spacing + distribution(generator);
+          pos(iatom, 1) = (iy + 0.5) * spacing + distribution(generator);
+          pos(iatom, 2) = (iz + 0.5) * spacing + distribution(generator);
+          ++iatom;
+        }
+      }
+    }
+    atomic_state = std::make_shared<DynamicAtomicState>();
+    atomic_state->add(std::move(types), std::move(pos));
+  }
+
+ protected:
+  std::unique_ptr<CubicCell> cell;
+  std::shared_ptr<DynamicAtomicState> atomic_state;
+  std::map<std::string, std::shared_ptr<AtomType>> atom_types;
+
+  static constexpr double spacing = 3.8;
+  static constexpr double cutoff = 6.0;
+  static constexpr double skin = 1.0;
+  static constexpr double temperature = 100.0;
+  static constexpr std::string_view toml = R"(
+    [AtomTypes.Ar]
+    sigma_lj = 3.405
+    eps_lj = 0.000119188
+    D_morse = 0.000119188
+    alpha_morse = 1.6
+    r0_morse = 3.82
+  )"sv;
+
+  /**
+   * @brief Construct the energy cache of the Morse potential.
+   * @param max_step The largest half-width of displacements.
+   * @return The energy cache.
+   */
+  std::unique_ptr<EnergyCache> make_cache(double max_step) const {
+    std::vector<std::unique_ptr<PairwiseForce>> forces;
+    forces.push_back(
+        std::make_unique<Morse>(atomic_state->atom_type_idx(), cutoff, skin));
+    return std::make_unique<EnergyCache>(std::move(forces), skin, max_step);
+  }
+
+  /**
+   * @brief Evaluate the potential energy of the atomic state from scratch.
+   * @return The potential energy.
+   */
+  double potential() const {
+    Morse morse(atomic_state->atom_type_idx(), cutoff, skin);
+    atomic_state->zero_forces();
+    return morse.evaluate(*atomic_state, *cell);
+  }
+};
+
+/**
+ * @brief Make sure the energies cached through accepted moves stay those of
+ * the atoms' current positions, whether swept in order or in a checkerboard,
+ * and that atoms actually move.
+ */
+TEST_F(TestMonteCarlo, CacheMatchesForces) {
+  for (bool checkerboard : {false, true}) {
+    SetUp();
+    auto cache = make_cache(0.5);
+    Displacement moves(temperature, 0.2, 0.5, 0.5, 0, checkerboard, 42);
+    cache->compute(*atomic_state, *cell);
+    const double initial = potential();
+    ASSERT_NEAR(cache->total(), initial, 1E-10 * std::abs(initial));
+    for (std::size_t isweep = 0; isweep < 20; ++isweep) {
+      moves.sweep(*atomic_state, *cell, *cache);
+    }
+    spdlog::info("Accepted {} of {} moves, energy from {} to {}.",
+                 moves.accepted(), moves.attempted(), initial,
+                 cache->total());
+    ASSERT_GT(moves.accepted(), 0);
+    ASSERT_LT(moves.accepted(), moves.attempted());
+    const double final = potential();
+    ASSERT_NEAR(cache->total(), final, 1E-10 * std::abs(final));
+  }
+}
+
+/**
+ * @brief Make sure the half-width of displacements adjusts from a poor guess
+ * to accept moves at about the target rate, then holds.
+ */
+TEST_F(TestMonteCarlo, StepAdjusts) {
+  auto cache = make_cache(2.0);
+  Displacement moves(temperature, 2.0, 2.0, 0.4, 30, false, 42);
+  cache->compute(*atomic_state, *cell);
+  for (std::size_t isweep = 0; isweep < 30; ++isweep) {
+    moves.sweep(*atomic_state, *cell, *cache);
+  }
+  ASSERT_EQ(moves.attempted(), 0);
+  const double step = moves.step();
+  ASSERT_LT(step, 2.0);
+  for (std::size_t isweep = 0; isweep < 20; ++isweep) {
+    moves.sweep(*atomic_state, *cell, *cache);
+  }
+  ASSERT_EQ(moves.step(), step);
+  ASSERT_NEAR(double(moves.accepted()) / moves.attempted(), 0.4, 0.1);
+}
+
+/**
+ * @brief Make sure sweeping in a checkerboard gives the same trajectory
+ * however many threads share the domains, in a cell wide enough for each
+ * colour to have several domains to share.
+ */
+TEST_F(TestMonteCarlo, ThreadInvariance) {
+  std::vector<std::vector<double>> positions;
+  for (int num_threads : {1, 4}) {
+    SetUp(12);
+    omp_set_num_threads(num_threads);
+    auto cache = make_cache(0.5);
+    Displacement moves(temperature, 0.3, 0.5, 0.5, 0, true, 7);
+    cache->compute(*atomic_state, *cell);
+    for (std::size_t isweep = 0; isweep < 10; ++isweep) {
+      moves.sweep(*atomic_state, *cell, *cache);
+    }
+    // Otherwise each colour has a single domain, and the sweep is serial
+    ASSERT_GE(moves.num_domains(), 4);
+    positions.emplace_back(atomic_state->pos(),
+                           atomic_state->pos() + 3 * atomic_state->num_atoms());
+  }
+  for (std::size_t idx = 0; idx < positions[0].size(); ++idx) {
+    // Neighbours shared by domains of one colour may sum updates to their
+    // energies in either order, so allow for rounding
+    ASSERT_NEAR(positions[0][idx], positions[1][idx], 1E-10);
+  }
+}
+
+/**
+ * @brief Make sure a cell too narrow for two domains along each dimension is
+ * refused by the checkerboard.
+ */
+TEST_F(TestMonteCarlo, CheckerboardNeedsWideCell) {
+  cell = std::make_unique<CubicCell>(20.0);
+  auto cache = make_cache(0.5);
+  Displacement moves(temperature, 0.2, 0.5, 0.5, 0, true, 42);
+  ASSERT_THROW(moves.sweep(*atomic_state, *cell, *cache), std::runtime_error);
+}
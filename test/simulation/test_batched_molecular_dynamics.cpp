@@ -0,0 +1,213 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <vector>
+// Third-Party Libraries
+#include <toml++/toml.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/base_fixtures/argon_box.hpp"
+#include "tyche/simulation/simulation_reader.hpp"
+#include "tyche/simulation/batched_molecular_dynamics.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Test fixture for a batch of molecular dynamics replicas of the box of
+ * Argon, sweeping the temperature of the thermostat.
+ */
+class TestBatchedMolecularDynamics : public ArgonBox {
+ public:
+  void SetUp() override {
+    ArgonBox::SetUp(32, density * 10);
+    toml::table config = toml::parse(simulation_config);
+    config.at_path("Simulation.BatchedMolecularDynamics.Cell.length")
+        .ref<double>() = cell->length();
+    auto reader = SimulationReader(atomic_state);
+    simulation = reader.parse(*config["Simulation"].as_table());
+  }
+
+ protected:
+  std::unique_ptr<Simulation> simulation;
+
+  /**
+   * @brief Read the whole of a replica's thermodynamics output.
+   * @param ireplica The index of the replica.
+   * @return The contents of the output.
+   */
+  static std::string therm(std::size_t ireplica) {
+    std::ifstream ifs("/tmp/test_batched_molecular_dynamics." +
+                      std::to_string(ireplica) + ".therm");
+    std::stringstream contents;
+    contents << ifs.rdbuf();
+    return contents.str();
+  }
+
+  static constexpr std::string_view simulation_config = R"(
+    [Simulation.BatchedMolecularDynamics]
+    seed = 42
+    replicas = 3
+
+    [Simulation.BatchedMolecularDynamics.Sweep.Integrator.Control]
+    temperature = [100, 200, 300]
+
+    [Simulation.BatchedMolecularDynamics.Cell]
+    type = "Cubic"
+    length = 1.0
+
+    [Simulation.BatchedMolecularDynamics.Integrator]
+    type = "VelocityVerlet"
+    timestep = 1.0
+    num_steps = 1E3
+
+      [Simulation.BatchedMolecularDynamics.Integrator.Control]
+      ensemble = "NVT"
+      type = "Bussi"
+      temperature = 300
+      t_relax = 100
+
+    [[Simulation.BatchedMolecularDynamics.Outputs]]
+    type = "therm"
+    frequency = 100
+    path = "/tmp/test_batched_molecular_dynamics.therm"
+
+    [[Simulation.BatchedMolecularDynamics.Forces]]
+    type = "LennardJones"
+)"sv;
+};
+
+/**
+ * @brief Every replica should run and write to its own output, and with their
+ * own seeds and temperatures, no two should follow the same trajectory.
+ */
+TEST_F(TestBatchedMolecularDynamics, IndependentReplicas) {
+  auto& batch = dynamic_cast<BatchedMolecularDynamics&>(*simulation);
+  ASSERT_EQ(batch.num_replicas(), 3);
+  // The thermostat can't be interleaved, so each replica runs on a thread
+  ASSERT_FALSE(batch.interleaved());
+  batch.run();
+  for (std::size_t ireplica = 0; ireplica < 3; ++ireplica) {
+    ASSERT_FALSE(therm(ireplica).empty());
+    for (std::size_t jreplica = 0; jreplica < ireplica; ++jreplica) {
+      ASSERT_NE(therm(ireplica), therm(jreplica));
+    }
+  }
+}
+
+/**
+ * @brief Test fixture for a batch of microcanonical replicas of the box of
+ * Argon interacting through the WCA potential, sweeping the cell length, which
+ * are interleaved.
+ */
+class TestInterleavedMolecularDynamics : public ArgonBox {
+ public:
+  void SetUp() override { ArgonBox::SetUp(125, 1.0); }
+
+ protected:
+  /**
+   * @brief Parse a simulation of a copy of the atomic state, either the batch
+   * or a single replica of it.
+   * @param type The type of simulation.
+   * @param lengths The cell length of each replica.
+   * @return The simulation.
+   */
+  std::unique_ptr<Simulation> parse(const std::string& type,
+                                    const std::vector<double>& lengths) {
+    std::string text(simulation_config);
+    for (std::size_t pos; (pos = text.find("Replica")) != std::string::npos;) {
+      text.replace(pos, std::string_view("Replica").size(), type);
+    }
+    toml::table config = toml::parse(text);
+    auto& replica = *config.at_path("Simulation." + type).as_table();
+    if (lengths.size() == 1) {
+      replica["Cell"].as_table()->insert("length", lengths.front());
+    } else {
+      toml::array swept;
+      for (double length : lengths) swept.push_back(length);
+      replica.insert("replicas", static_cast<double>(lengths.size()));
+      replica.insert("Sweep", toml::table{{"Cell", toml::table{{"length",
+                                                                swept}}}});
+    }
+    auto reader =
+        SimulationReader(std::make_shared<DynamicAtomicState>(*atomic_state));
+    return reader.parse(*config["Simulation"].as_table());
+  }
+
+  /**
+   * @brief Read the values of a thermodynamics output, after its header.
+   * @param path The path of the output.
+   * @return The values, row by row.
+   */
+  static std::vector<double> therm(const std::string& path) {
+    std::ifstream ifs(path);
+    std::string header;
+    std::getline(ifs, header);
+    std::vector<double> values;
+    for (double value; ifs >> value;) values.push_back(value);
+    return values;
+  }
+
+  static constexpr std::string_view simulation_config = R"(
+    [Simulation.Replica]
+    seed = 42
+
+    [Simulation.Replica.Cell]
+    type = "Cubic"
+
+    [Simulation.Replica.Integrator]
+    type = "VelocityVerlet"
+    timestep = 2.0
+    num_steps = 400
+
+    [[Simulation.Replica.Outputs]]
+    type = "therm"
+    frequency = 50
+    path = "/tmp/test_interleaved_molecular_dynamics.therm"
+
+    [[Simulation.Replica.Forces]]
+    type = "WCA"
+)"sv;
+};
+
+/**
+ * @brief Interleaved replicas should follow the same trajectories as each
+ * replica run alone, up to the order in which forces are summed, and finish
+ * with the same potential energy and virial.
+ */
+TEST_F(TestInterleavedMolecularDynamics, MatchesReplicasRunAlone) {
+  const double length = cell->length();
+  const std::vector<double> lengths = {length, 1.01 * length, 1.02 * length};
+  auto simulation = parse("BatchedMolecularDynamics", lengths);
+  auto& batch = dynamic_cast<BatchedMolecularDynamics&>(*simulation);
+  ASSERT_TRUE(batch.interleaved());
+  batch.run();
+
+  for (std::size_t ireplica = 0; ireplica < lengths.size(); ++ireplica) {
+    auto alone = parse("MolecularDynamics", {lengths[ireplica]});
+    alone->run();
+    const auto& expected_md = dynamic_cast<MolecularDynamics&>(*alone);
+    const auto& actual_md = batch.replica(ireplica);
+    ASSERT_NEAR(actual_md.potential_energy(), expected_md.potential_energy(),
+                1E-6 * std::abs(expected_md.potential_energy()));
+    ASSERT_NE(actual_md.atomic_state().virial(), 0.0);
+    ASSERT_NEAR(actual_md.atomic_state().virial(),
+                expected_md.atomic_state().virial(),
+                1E-6 * std::abs(expected_md.atomic_state().virial()));
+
+    auto expected = therm("/tmp/test_interleaved_molecular_dynamics.therm");
+    auto actual = therm("/tmp/test_interleaved_molecular_dynamics." +
+                        std::to_string(ireplica) + ".therm");
+    ASSERT_EQ(actual.size(), expected.size());
+    ASSERT_FALSE(actual.empty());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+      ASSERT_NEAR(actual[i], expected[i], 1E-6 * std::abs(expected[i]));
+    }
+  }
+}
@@ -45,6 +45,9 @@ class TestMolecularDynamics : public ArgonBox {
   // Since we derive from ArgonBox, we already have an atomic state set-up, so
   // we don't need to specify that configuration here
   static constexpr std::string_view simulation_config = R"(
+    [Simulation.MolecularDynamics]
+    seed = 42
+
     [Simulation.MolecularDynamics.Cell]
     type = "Cubic"
     length = 1.0
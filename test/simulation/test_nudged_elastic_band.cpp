@@ -0,0 +1,175 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <algorithm>
+// Third-Party Libraries
+#include <omp.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/atom_type_reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/atom/atomic_state_reader.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/minimise/fire.hpp"
+#include "tyche/minimise/elastic_band.hpp"
+#include "tyche/simulation/nudged_elastic_band.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Two wells at (+-1, c, 0) joined by a curved valley along y = c x^2,
+ * with a saddle point at the origin a above the wells:
+ *
+ *      V = a (x^2 - 1)^2 + b (y - c x^2)^2 + b z^2
+ */
+class CurvedDoubleWell : public Force {
+ public:
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override {
+    double energy = 0;
+    for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+      const double x = state.pos(iatom)[0], y = state.pos(iatom)[1];
+      const double z = state.pos(iatom)[2];
+      const double well = x * x - 1, valley = y - c * x * x;
+      energy += a * well * well + b * valley * valley + b * z * z;
+      state.force(iatom)[0] -= 4 * a * x * well - 4 * b * c * x * valley;
+      state.force(iatom)[1] -= 2 * b * valley;
+      state.force(iatom)[2] -= 2 * b * z;
+    }
+    return energy;
+  }
+
+  static constexpr double a = 0.5, b = 1, c = 0.5;
+};
+
+/**
+ * @brief Path of a single Argon atom from one well to the other, starting on
+ * the straight line between them, which misses the valley.
+ */
+class TestNudgedElasticBand : public ::testing::Test {
+ public:
+  void SetUp() override {
+    toml::table config = toml::parse(toml);
+    AtomTypeReader atom_type_reader;
+    auto atom_types = atom_type_reader.parse(*config["AtomTypes"].as_table());
+    DynamicAtomicStateReader atomic_state_reader(atom_types);
+    atomic_state = std::make_shared<DynamicAtomicState>(
+        std::move(atomic_state_reader.parse(*config["Atoms"].as_table())));
+    cell = std::make_unique<UnboundedCell>();
+  }
+
+ protected:
+  std::shared_ptr<DynamicAtomicState> atomic_state;
+  std::unique_ptr<Cell> cell;
+
+  static constexpr std::size_t num_images = 8;
+  static constexpr double spring = 1;
+
+  /**
+   * @brief Construct the simulation.
+   * @param climb_after The number of steps after which the highest image
+   * climbs, if any.
+   * @return The simulation.
+   */
+  std::unique_ptr<NudgedElasticBand> make(
+      std::optional<std::size_t> climb_after) {
+    auto images = ElasticBand::interpolate(
+        *atomic_state, {1, CurvedDoubleWell::c, 0}, num_images, *cell);
+    std::vector<std::unique_ptr<Forces>> forces;
+    for (std::size_t image = 0; image < num_images; ++image) {
+      forces.push_back(std::make_unique<Forces>());
+      forces.back()->add(std::make_unique<CurvedDoubleWell>());
+    }
+    auto band = std::make_unique<ElasticBand>(std::move(images),
+                                              std::move(forces), spring);
+    auto fire = std::make_unique<Fire>(10000, 0, 1E-6, 10, 50);
+    return std::make_unique<NudgedElasticBand>(
+        std::move(band), std::make_unique<UnboundedCell>(), std::move(fire),
+        climb_after);
+  }
+
+  static constexpr std::string_view toml = R"(
+    [Atoms.Ar]
+    positions = [
+        [-1.00000000, 0.50000000, 0.00000000],
+    ]
+
+    [AtomTypes.Ar]
+    sigma_lj = 3.405
+    eps_lj = 0.000119188
+  )"sv;
+};
+
+/**
+ * @brief Without climbing, the end points stay put, the images fall from the
+ * straight line into the valley, and the springs space them evenly along it.
+ */
+TEST_F(TestNudgedElasticBand, ImagesSpacedEvenly) {
+  auto neb = make(std::nullopt);
+  neb->run();
+  ASSERT_TRUE(neb->minimiser().converged());
+  const auto& images = neb->band().images();
+  ASSERT_EQ(images.front()->pos(0)[0], -1);
+  ASSERT_EQ(images.back()->pos(0)[0], 1);
+
+  std::vector<double> spacing;
+  for (std::size_t image = 0; image < num_images; ++image) {
+    const double x = images[image]->pos(0)[0], y = images[image]->pos(0)[1];
+    if (image && image + 1 < num_images) ASSERT_LT(y, CurvedDoubleWell::c);
+    if (image) {
+      const double dx = x - images[image - 1]->pos(0)[0];
+      const double dy = y - images[image - 1]->pos(0)[1];
+      spacing.push_back(std::sqrt(dx * dx + dy * dy));
+    }
+  }
+  auto [shortest, longest] =
+      std::minmax_element(spacing.begin(), spacing.end());
+  ASSERT_NEAR(*shortest, *longest, 1E-2 * *longest);
+}
+
+/**
+ * @brief With an even number of images, none lies on the saddle point by
+ * symmetry, yet the climbing image finds it, and its energy the barrier.
+ */
+TEST_F(TestNudgedElasticBand, ClimbingImageFindsSaddle) {
+  auto neb = make(100);
+  neb->run();
+  ASSERT_TRUE(neb->minimiser().converged());
+  ASSERT_TRUE(neb->band().climbing());
+  const auto& climbing = neb->band().images()[neb->band().highest_image()];
+  for (std::size_t idim = 0; idim < 3; ++idim) {
+    ASSERT_NEAR(climbing->pos(0)[idim], 0, 1E-5);
+  }
+  const auto& energies = neb->band().energies();
+  ASSERT_NEAR(energies[neb->band().highest_image()] - energies.front(),
+              CurvedDoubleWell::a, 1E-8);
+}
+
+/**
+ * @brief Images are evaluated independently, so the path doesn't depend on
+ * the number of threads evaluating them, beyond the rounding of the sums over
+ * the band in FIRE.
+ */
+TEST_F(TestNudgedElasticBand, ThreadInvariance) {
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  auto serial = make(100);
+  serial->run();
+  omp_set_num_threads(num_threads);
+  auto parallel = make(100);
+  parallel->run();
+
+  for (std::size_t image = 0; image < num_images; ++image) {
+    const auto& a = serial->band().images()[image];
+    const auto& b = parallel->band().images()[image];
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      ASSERT_NEAR(a->pos(0)[idim], b->pos(0)[idim], 1E-8);
+    }
+  }
+}
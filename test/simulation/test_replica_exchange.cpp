@@ -0,0 +1,117 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <filesystem>
+// Third-Party Libraries
+#include <omp.h>
+#include <toml++/toml.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "test/base_fixtures/argon_box.hpp"
+#include "tyche/simulation/simulation_reader.hpp"
+#include "tyche/simulation/replica_exchange.hpp"
+
+using namespace tyche;
+using namespace std::string_view_literals;
+
+/**
+ * @brief Test fixture for replica exchange of the box of Argon over a ladder
+ * of temperatures.
+ */
+class TestReplicaExchange : public ArgonBox {
+ public:
+  void SetUp() override { ArgonBox::SetUp(32, density * 10); }
+
+ protected:
+  /**
+   * @brief Create a fresh replica exchange simulation from the configuration.
+   * @return The simulation.
+   */
+  std::unique_ptr<ReplicaExchange> create() {
+    toml::table config = toml::parse(simulation_config);
+    config.at_path("Simulation.ReplicaExchange.Cell.length").ref<double>() =
+        cell->length();
+    auto reader = SimulationReader(
+        std::make_shared<DynamicAtomicState>(*atomic_state));
+    auto simulation = reader.parse(*config["Simulation"].as_table());
+    return std::unique_ptr<ReplicaExchange>(
+        dynamic_cast<ReplicaExchange*>(simulation.release()));
+  }
+
+  static constexpr std::string_view simulation_config = R"(
+    [Simulation.ReplicaExchange]
+    seed = 42
+    temperatures = [90, 100, 110]
+    exchange_frequency = 20
+
+    [Simulation.ReplicaExchange.Cell]
+    type = "Cubic"
+    length = 1.0
+
+    [Simulation.ReplicaExchange.Integrator]
+    type = "VelocityVerlet"
+    timestep = 1.0
+    num_steps = 2E3
+
+      [Simulation.ReplicaExchange.Integrator.Control]
+      ensemble = "NVT"
+      type = "Bussi"
+      t_relax = 100
+
+    [[Simulation.ReplicaExchange.Outputs]]
+    type = "therm"
+    frequency = 100
+    path = "/tmp/test_replica_exchange.therm"
+
+    [[Simulation.ReplicaExchange.Forces]]
+    type = "LennardJones"
+)"sv;
+};
+
+/**
+ * @brief Neighbouring rungs alternate in attempting exchanges, some of which
+ * are accepted, leaving each replica at exactly one temperature, and each
+ * writes to its own output.
+ */
+TEST_F(TestReplicaExchange, Exchanges) {
+  auto simulation = create();
+  ASSERT_EQ(simulation->num_replicas(), 3);
+  ASSERT_EQ(simulation->temperatures(), std::vector<double>({90, 100, 110}));
+  simulation->run();
+
+  // 99 exchanges between the 100 blocks of steps, starting with the even rung
+  ASSERT_EQ(simulation->attempted(), std::vector<std::size_t>({50, 49}));
+  for (std::size_t irung = 0; irung < 2; ++irung) {
+    ASSERT_GT(simulation->accepted()[irung], 0);
+    ASSERT_LE(simulation->accepted()[irung], simulation->attempted()[irung]);
+  }
+  auto replica_at = simulation->replica_at();
+  std::sort(replica_at.begin(), replica_at.end());
+  ASSERT_EQ(replica_at, std::vector<std::size_t>({0, 1, 2}));
+  for (std::size_t ireplica = 0; ireplica < 3; ++ireplica) {
+    ASSERT_GT(std::filesystem::file_size("/tmp/test_replica_exchange." +
+                                         std::to_string(ireplica) + ".therm"),
+              0);
+  }
+}
+
+/**
+ * @brief Each replica runs on a single thread whatever the size of the team,
+ * and exchanges draw from their own stream, so the sequence of exchanges
+ * doesn't depend on the number of threads.
+ */
+TEST_F(TestReplicaExchange, ThreadInvariance) {
+  omp_set_num_threads(1);
+  auto serial = create();
+  serial->run();
+  omp_set_num_threads(3);
+  auto threaded = create();
+  threaded->run();
+  ASSERT_EQ(serial->accepted(), threaded->accepted());
+  ASSERT_EQ(serial->replica_at(), threaded->replica_at());
+}
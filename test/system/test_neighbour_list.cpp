@@ -0,0 +1,103 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <set>
+#include <random>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "test/base_fixtures/argon_box.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Neighbour list of a box of Argon gas whose cell is rescaled, as by a
+ * barostat.
+ */
+class TestNeighbourListArgonGas : public ArgonBox {
+ public:
+  void SetUp() override { ArgonBox::SetUp(125, 1.784E-1); }
+
+ protected:
+  static constexpr double cutoff = 6;
+  static constexpr double skin = 1;
+
+  /**
+   * @brief Scale the atomic positions and the cell by some factor.
+   * @param scale The factor to scale by.
+   */
+  void dilate(double scale) {
+    Tensor<double, 2>::iterator pos = atomic_state->pos();
+    for (std::size_t idx = 0; idx < 3 * atomic_state->num_atoms(); ++idx) {
+      pos[idx] *= scale;
+    }
+    cell->scale(scale);
+  }
+
+  /**
+   * @brief Find the neighbours of an atom within some distance by brute force.
+   * @param iatom The index of the atom.
+   * @param range The distance to find neighbours within.
+   * @return The indices of the neighbours.
+   */
+  std::set<std::size_t> brute_force(std::size_t iatom, double range) {
+    std::set<std::size_t> neighbours;
+    for (std::size_t jatom = 0; jatom < atomic_state->num_atoms(); ++jatom) {
+      if (jatom == iatom) continue;
+      double dx = atomic_state->pos(jatom)[0] - atomic_state->pos(iatom)[0];
+      double dy = atomic_state->pos(jatom)[1] - atomic_state->pos(iatom)[1];
+      double dz = atomic_state->pos(jatom)[2] - atomic_state->pos(iatom)[2];
+      cell->min_image(dx, dy, dz);
+      if (dx * dx + dy * dy + dz * dz < range * range) neighbours.insert(jatom);
+    }
+    return neighbours;
+  }
+};
+
+/**
+ * @brief Uniformly rescaling the cell and positions moves no atom relative to
+ * the cell, so the list stays valid without a rebuild.
+ */
+TEST_F(TestNeighbourListArgonGas, RescaledCellNeedsNoRebuild) {
+  NeighbourList list(cutoff, skin, true);
+  list.update(*atomic_state, *cell);
+  dilate(0.98);
+  ASSERT_FALSE(list.update(*atomic_state, *cell));
+  for (std::size_t iatom = 0; iatom < atomic_state->num_atoms(); ++iatom) {
+    auto listed = list.neighbours(iatom);
+    std::set<std::size_t> neighbours(listed.begin(), listed.end());
+    for (std::size_t jatom : brute_force(iatom, cutoff)) {
+      ASSERT_TRUE(neighbours.count(jatom));
+    }
+  }
+}
+
+/**
+ * @brief After rescaling, a rebuild that only moves the atoms which changed bin
+ * finds the same neighbours as one from scratch.
+ */
+TEST_F(TestNeighbourListArgonGas, RebuildAfterRescaleMatchesFresh) {
+  NeighbourList list(cutoff, skin, true);
+  list.update(*atomic_state, *cell);
+  dilate(0.98);
+  std::mt19937 generator(5);
+  std::normal_distribution<double> distribution{0.0, 1.0};
+  Tensor<double, 2>::iterator pos = atomic_state->pos();
+  for (std::size_t idx = 0; idx < 3 * atomic_state->num_atoms(); ++idx) {
+    pos[idx] += distribution(generator);
+  }
+  ASSERT_TRUE(list.update(*atomic_state, *cell));
+
+  NeighbourList fresh(cutoff, skin, true);
+  fresh.update(*atomic_state, *cell);
+  for (std::size_t iatom = 0; iatom < atomic_state->num_atoms(); ++iatom) {
+    auto listed = list.neighbours(iatom), expected = fresh.neighbours(iatom);
+    ASSERT_EQ(std::set<std::size_t>(listed.begin(), listed.end()),
+              std::set<std::size_t>(expected.begin(), expected.end()));
+    ASSERT_EQ(std::set<std::size_t>(listed.begin(), listed.end()),
+              brute_force(iatom, cutoff + skin));
+  }
+}
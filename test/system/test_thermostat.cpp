@@ -2,8 +2,10 @@
  * @brief
  */
 // C++ Standard Libraries
-//
+#include <cmath>
+#include <vector>
 // Third-Party Libraries
+#include <omp.h>
 #include <gtest/gtest.h>
 // Project Inclusions
 #include "tyche/system/thermostat.hpp"
@@ -18,8 +20,52 @@ class TestThermostat : public ArgonBox {
 
 using namespace tyche;
 
-// TEST_F(TestThermostat, QQ) {
-//   SetUp(64);
-//   Thermostat::initialise_velocities(*atomic_state, 300);
-//   ASSERT_NEAR(Thermostat::temperature(*atomic_state), 300, 1E-8);
-// }
+/**
+ * @brief Initial velocities are at exactly the target temperature, with no
+ * centre of mass motion.
+ */
+TEST_F(TestThermostat, InitialiseVelocities) {
+  SetUp(64);
+  Thermostat thermostat(300, 42);
+  thermostat.initialise_velocities(*atomic_state);
+  ASSERT_NEAR(Thermostat::temperature(*atomic_state), 300, 1E-8);
+
+  std::vector<double> momentum(3);
+  for (std::size_t iatom = 0; iatom < atomic_state->num_atoms(); ++iatom) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      momentum[idim] += atomic_state->atom_type(iatom)->mass() *
+                        atomic_state->vel(iatom)[idim];
+    }
+  }
+  for (double p : momentum) ASSERT_NEAR(p, 0, 1E-10);
+}
+
+/**
+ * @brief Changing the temperature of the heat bath scales velocities to it.
+ */
+TEST_F(TestThermostat, SetTemperature) {
+  SetUp(64);
+  Thermostat thermostat(300, 42);
+  thermostat.initialise_velocities(*atomic_state);
+  thermostat.set_temperature(*atomic_state, 150);
+  ASSERT_EQ(thermostat.target_temperature(), 150);
+  ASSERT_NEAR(Thermostat::temperature(*atomic_state), 150, 1E-8);
+}
+
+/**
+ * @brief Initial velocities depend only on the seed, not the number of
+ * threads drawing them.
+ */
+TEST_F(TestThermostat, ThreadInvariance) {
+  SetUp(125);
+  Thermostat thermostat(300, 42);
+  omp_set_num_threads(1);
+  thermostat.initialise_velocities(*atomic_state);
+  std::vector<double> serial(
+      atomic_state->vel(), atomic_state->vel() + 3 * atomic_state->num_atoms());
+  omp_set_num_threads(4);
+  thermostat.initialise_velocities(*atomic_state);
+  for (std::size_t idx = 0; idx < serial.size(); ++idx) {
+    ASSERT_EQ(atomic_state->vel()[idx], serial[idx]);
+  }
+}
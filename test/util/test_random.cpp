@@ -0,0 +1,113 @@
+/**
+ * @brief Unit testing of random number generation.
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <vector>
+// Third-Party Libraries
+#include <gtest/gtest.h>
+// Project Inclusions
+#include "tyche/util/random.hpp"
+
+using namespace tyche;
+
+/**
+ * @brief Check Philox against known-answer vectors from the Random123
+ * reference implementation.
+ */
+TEST(RandomTests, PhiloxKnownAnswers) {
+  {
+    Philox philox(0);
+    Philox::Counter expected = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                0x9b00dbd8};
+    ASSERT_EQ(philox({0, 0, 0, 0}), expected);
+  }
+  {
+    Philox philox(0x299f31d0a4093822);
+    Philox::Counter expected = {0xd16cfe09, 0x94fdcceb, 0x5001e420,
+                                0x24126ea1};
+    ASSERT_EQ(philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}),
+              expected);
+  }
+}
+
+/**
+ * @brief Bulk normal numbers should match those drawn one pair at a time,
+ * and have zero mean and unit variance.
+ */
+TEST(RandomTests, FillNormal) {
+  Philox philox(42);
+  std::vector<double> values(100001);
+  philox.fill_normal(3, values.data(), values.size());
+
+  for (std::size_t p = 0; p < 10; ++p) {
+    auto pair = philox.normal(3, p);
+    ASSERT_DOUBLE_EQ(values[2 * p], pair[0]);
+    ASSERT_DOUBLE_EQ(values[2 * p + 1], pair[1]);
+  }
+  ASSERT_DOUBLE_EQ(values.back(), philox.normal(3, values.size() / 2)[0]);
+
+  double mean = 0, var = 0;
+  for (double value : values) mean += value;
+  mean /= values.size();
+  for (double value : values) var += (value - mean) * (value - mean);
+  var /= values.size() - 1;
+  ASSERT_NEAR(mean, 0, 0.01);
+  ASSERT_NEAR(var, 1, 0.01);
+}
+
+/**
+ * @brief Bulk uniform numbers should match those drawn one pair at a time, and
+ * lie on (0,1].
+ */
+TEST(RandomTests, FillUniform) {
+  Philox philox(42);
+  std::vector<double> values(1001);
+  philox.fill_uniform(5, values.data(), values.size());
+  for (std::size_t p = 0; p < values.size() / 2; ++p) {
+    auto pair = philox.uniform(5, p);
+    ASSERT_EQ(values[2 * p], pair[0]);
+    ASSERT_EQ(values[2 * p + 1], pair[1]);
+  }
+  ASSERT_EQ(values.back(), philox.uniform(5, values.size() / 2)[0]);
+  for (double value : values) {
+    ASSERT_GT(value, 0);
+    ASSERT_LE(value, 1);
+  }
+}
+
+/**
+ * @brief Streams of the same seed are independent of one another, whilst the
+ * default stream is keyed on the seed alone.
+ */
+TEST(RandomTests, Streams) {
+  const std::uint64_t seed = 42;
+  ASSERT_EQ(Philox(seed)(0, 0), Philox(seed, RandomStream::Default)(0, 0));
+  ASSERT_NE(Philox(seed)(0, 0), Philox(seed, RandomStream::Langevin)(0, 0));
+  ASSERT_NE(Philox(seed, RandomStream::Andersen)(0, 0),
+            Philox(seed, RandomStream::Langevin)(0, 0));
+  ASSERT_NE(Philox(seed, RandomStream::Langevin)(0, 0),
+            Philox(seed + 1, RandomStream::Langevin)(0, 0));
+}
+
+/**
+ * @brief Gamma variates should have mean and variance equal to the shape,
+ * including for shapes below one.
+ */
+TEST(RandomTests, Gamma) {
+  Philox philox(42);
+  for (double shape : {0.5, 2.5, 100.0}) {
+    const std::size_t num_samples = 100000;
+    double mean = 0, var = 0;
+    std::vector<double> values(num_samples);
+    for (std::size_t i = 0; i < num_samples; ++i) {
+      values[i] = philox.gamma(shape, i);
+      mean += values[i];
+    }
+    mean /= num_samples;
+    for (double value : values) var += (value - mean) * (value - mean);
+    var /= num_samples - 1;
+    ASSERT_NEAR(mean, shape, 0.02 * shape);
+    ASSERT_NEAR(var, shape, 0.05 * shape);
+  }
+}
@@ -6,13 +6,17 @@
 
 // C++ Standard Libraries
 #include <map>
+#include <array>
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
 // Third-Party Libraries
 #include <spdlog/spdlog.h>
 // Project Inclusions
 #include "tyche/util/tensor.hpp"
 #include "tyche/atom/atom_type.hpp"
+#include "tyche/atom/topology.hpp"
 
 namespace tyche {
 
@@ -44,14 +48,93 @@ class AtomicState {
     pos_ = std::move(pos);
 
     // Count up the number of atoms of each atom type we have
-    std::size_t num_atom_types = 0;
     for (const auto& atom_type : atom_types_) {
-      if (!num_atoms_.count(atom_type)) {
-        num_atoms_.insert({atom_type, 0});
-        atom_type_idx_.insert({atom_type, num_atom_types++});
-      }
+      add_atom_type(atom_type);
       num_atoms_.at(atom_type) += 1;
     }
+
+    // Cache the atom type index of each atom so that computational hotspots
+    // don't need to go through the shared pointer and map
+    atom_type_indices_.resize(atom_types_.size());
+    for (std::size_t iatom = 0; iatom < atom_types_.size(); ++iatom) {
+      atom_type_indices_[iatom] = atom_type_idx_.at(atom_types_[iatom]);
+    }
+  }
+
+  /**
+   * @brief Register an atom type with the atomic state, with no atoms of it
+   * yet, so that it has an index before any atoms of it are inserted. Forces
+   * size their parameters by the atom types known when they're created, so
+   * must be created after every atom type that'll be inserted is registered.
+   * @param atom_type The atom type, which is left alone if already known.
+   */
+  void add_atom_type(std::shared_ptr<AtomType> atom_type) {
+    if (atom_type_idx_.count(atom_type)) return;
+    const std::size_t idx = atom_type_idx_.size();
+    num_atoms_.insert({atom_type, 0});
+    atom_type_idx_.insert({atom_type, idx});
+  }
+
+  /**
+   * @brief Reserve storage for a number of atoms, so that inserting atoms up to
+   * that many doesn't reallocate.
+   * @param num_atoms The number of atoms to reserve storage for.
+   */
+  virtual void reserve(std::size_t num_atoms) {
+    pos_.reserve(3 * num_atoms);
+    atom_types_.reserve(num_atoms);
+    atom_type_indices_.reserve(num_atoms);
+  }
+
+  /**
+   * @brief Insert an atom after the last, in amortised constant time, as the
+   * storage for atoms doubles whenever it's full. Storage is never released
+   * by removing atoms, so a system whose number of atoms fluctuates stops
+   * allocating once it's reached its largest.
+   * @param atom_type The atom type of the atom, which is registered if new.
+   * @param pos The position of the atom.
+   * @return The index of the atom, i.e. the number of atoms before it.
+   */
+  virtual std::size_t insert_atom(std::shared_ptr<AtomType> atom_type,
+                                  const std::array<double, 3>& pos) {
+    if (topology_) {
+      throw std::runtime_error("Can't insert atoms into a bonded topology.");
+    }
+    const std::size_t iatom = atom_types_.size();
+    if (iatom == atom_types_.capacity()) {
+      reserve(std::max(2 * iatom, min_capacity));
+    }
+    add_atom_type(atom_type);
+    num_atoms_.at(atom_type) += 1;
+    atom_type_indices_.push_back(atom_type_idx_.at(atom_type));
+    atom_types_.push_back(std::move(atom_type));
+    pos_.resize(iatom + 1, 3);
+    std::copy(pos.begin(), pos.end(), this->pos(iatom));
+    return iatom;
+  }
+
+  /**
+   * @brief Remove an atom in constant time, by moving the last atom into its
+   * place. Anything indexed by atom must follow suit.
+   * @param iatom The index of the atom.
+   * @return The index the moved atom had, i.e. the number of atoms left, which
+   * is iatom itself if it was the last atom.
+   */
+  virtual std::size_t remove_atom(std::size_t iatom) {
+    if (topology_) {
+      throw std::runtime_error("Can't remove atoms from a bonded topology.");
+    }
+    const std::size_t last = atom_types_.size() - 1;
+    num_atoms_.at(atom_types_[iatom]) -= 1;
+    if (iatom != last) {
+      atom_types_[iatom] = atom_types_[last];
+      atom_type_indices_[iatom] = atom_type_indices_[last];
+      std::copy(pos(last), pos(last) + 3, pos(iatom));
+    }
+    atom_types_.pop_back();
+    atom_type_indices_.pop_back();
+    pos_.resize(last, 3);
+    return last;
   }
 
   /**
@@ -124,10 +207,40 @@ class AtomicState {
     return atom_type_idx_.at(atom_type);
   }
 
+  /**
+   * @brief Get the unique atom type index, on [0,num_atom_types), of each atom
+   * in the atomic state.
+   * @return Iterable with the atom type index of each atom.
+   */
+  const std::vector<std::size_t>& atom_type_indices() const {
+    return atom_type_indices_;
+  }
+
+  /**
+   * @brief Set the bonded topology of the atoms in the atomic state. Must be
+   * called after the atoms have been added.
+   * @param topology The topology, which may only refer to existing atoms.
+   */
+  void set_topology(std::shared_ptr<Topology> topology) {
+    topology->validate(num_atoms());
+    topology_ = topology;
+  }
+
+  /**
+   * @brief Getter for the bonded topology of the atomic state.
+   * @return The topology, or nullptr if the atoms aren't bonded.
+   */
+  std::shared_ptr<const Topology> topology() const { return topology_; }
+
  protected:
   std::map<std::shared_ptr<AtomType>, std::size_t> num_atoms_, atom_type_idx_;
   Tensor<double, 2> pos_;
   std::vector<std::shared_ptr<AtomType>> atom_types_;
+  std::vector<std::size_t> atom_type_indices_;
+  std::shared_ptr<Topology> topology_;
+
+  //< Number of atoms storage is first reserved for on insertion
+  static constexpr std::size_t min_capacity = 16;
 };
 
 }  // namespace tyche
@@ -15,6 +15,8 @@
 #include "tyche/util/tensor.hpp"
 #include "tyche/io/toml_reader.hpp"
 #include "tyche/atom/atom_type.hpp"
+#include "tyche/atom/topology.hpp"
+#include "tyche/atom/topology_reader.hpp"
 #include "tyche/atom/atomic_state.hpp"
 #include "tyche/atom/dynamic_atomic_state.hpp"
 
@@ -118,6 +120,30 @@ class BaseAtomicStateReader : public TOMLReader<ReturnType> {
     }
     return types;
   }
+
+  /**
+   * @brief Register every atom type with the atomic state, including those
+   * without any atoms, which may be inserted later.
+   * @param atomic_state The atomic state, whose atoms have been added.
+   */
+  void register_types(AtomicState& atomic_state) {
+    for (const auto& type : atom_types_) {
+      atomic_state.add_atom_type(type.second);
+    }
+  }
+
+  /**
+   * @brief Parse the bonded topology from the "Topology" node within the
+   * "Atoms" node, if there is one, and attach it to the atomic state.
+   * @param config The "Atoms" node in the TOML configuration.
+   * @param atomic_state The atomic state, whose atoms have been added.
+   */
+  void parse_topology(toml::table& config, AtomicState& atomic_state) {
+    if (!config["Topology"]) return;
+    TopologyReader reader;
+    atomic_state.set_topology(std::make_shared<Topology>(
+        reader.parse(*config["Topology"].as_table())));
+  }
 };
 
 /**
@@ -148,6 +174,8 @@ class AtomicStateReader : public BaseAtomicStateReader<AtomicState> {
         parse_atomic_cartesian_tensor(config, "positions", num_atoms_per_type);
 
     atomic_state.add(std::move(types), std::move(pos));
+    register_types(atomic_state);
+    parse_topology(config, atomic_state);
 
     return atomic_state;
   }
@@ -187,6 +215,8 @@ class DynamicAtomicStateReader
 
     atomic_state.add(std::move(types), std::move(pos), std::move(vel),
                      std::move(force));
+    register_types(atomic_state);
+    parse_topology(config, atomic_state);
 
     return atomic_state;
   }
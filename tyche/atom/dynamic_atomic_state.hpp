@@ -6,6 +6,7 @@
 
 // C++ Standard Libraries
 #include <map>
+#include <array>
 #include <memory>
 #include <vector>
 #include <optional>
@@ -47,6 +48,68 @@ class DynamicAtomicState : public AtomicState {
     // the simulation and data not provided. Else just move the provided data.
     vel_ = std::move(vel.value_or(Tensor<double, 2>(num_atoms(), 3)));
     force_ = std::move(force.value_or(Tensor<double, 2>(num_atoms(), 3)));
+
+    // Cache the mass of each atom, and its inverse, in contiguous arrays so
+    // that integrators don't go through the shared pointer or divide
+    mass_.resize(atom_types_.size());
+    inv_mass_.resize(atom_types_.size());
+    for (std::size_t iatom = 0; iatom < atom_types_.size(); ++iatom) {
+      mass_[iatom] = atom_types_[iatom]->mass();
+      inv_mass_[iatom] = 1 / mass_[iatom];
+    }
+  }
+
+  /**
+   * @brief Reserve storage for a number of atoms, so that inserting atoms up to
+   * that many doesn't reallocate.
+   * @param num_atoms The number of atoms to reserve storage for.
+   */
+  void reserve(std::size_t num_atoms) override {
+    AtomicState::reserve(num_atoms);
+    vel_.reserve(3 * num_atoms);
+    force_.reserve(3 * num_atoms);
+    mass_.reserve(num_atoms);
+    inv_mass_.reserve(num_atoms);
+  }
+
+  /**
+   * @brief Insert an atom after the last, at rest and with no force on it, in
+   * amortised constant time.
+   * @param atom_type The atom type of the atom, which is registered if new.
+   * @param pos The position of the atom.
+   * @return The index of the atom, i.e. the number of atoms before it.
+   */
+  std::size_t insert_atom(std::shared_ptr<AtomType> atom_type,
+                          const std::array<double, 3>& pos) override {
+    const double mass = atom_type->mass();
+    const std::size_t iatom = AtomicState::insert_atom(atom_type, pos);
+    // Rows added by resizing are zeroed
+    vel_.resize(iatom + 1, 3);
+    force_.resize(iatom + 1, 3);
+    mass_.push_back(mass);
+    inv_mass_.push_back(1 / mass);
+    return iatom;
+  }
+
+  /**
+   * @brief Remove an atom in constant time, by moving the last atom into its
+   * place.
+   * @param iatom The index of the atom.
+   * @return The index the moved atom had, i.e. the number of atoms left.
+   */
+  std::size_t remove_atom(std::size_t iatom) override {
+    const std::size_t last = AtomicState::remove_atom(iatom);
+    if (iatom != last) {
+      std::copy(vel(last), vel(last) + 3, vel(iatom));
+      std::copy(force(last), force(last) + 3, force(iatom));
+      mass_[iatom] = mass_[last];
+      inv_mass_[iatom] = inv_mass_[last];
+    }
+    vel_.resize(last, 3);
+    force_.resize(last, 3);
+    mass_.pop_back();
+    inv_mass_.pop_back();
+    return last;
   }
 
   /**
@@ -86,9 +149,38 @@ class DynamicAtomicState : public AtomicState {
   }
 
   /**
-   * @brief Zero the tensor containing atomic forces.
+   * @brief Get the mass of each atom in the atomic state.
+   * @return Iterable with the mass of each atom.
+   */
+  const std::vector<double>& mass() const { return mass_; }
+
+  /**
+   * @brief Get the inverse mass of each atom in the atomic state.
+   * @return Iterable with the inverse mass of each atom.
+   */
+  const std::vector<double>& inv_mass() const { return inv_mass_; }
+
+  /**
+   * @brief Zero the tensor containing atomic forces, along with the virial.
+   */
+  void zero_forces() {
+    force_.zero();
+    virial_ = 0;
+  }
+
+  /**
+   * @brief Getter for the virial, \sum_i r_i . f_i, accumulated alongside the
+   * forces. For pairwise interactions this is \sum_{i<j} r_{ij} . f_{ij},
+   * which doesn't depend on the periodic images used.
+   * @return The virial.
+   */
+  double virial() const { return virial_; }
+
+  /**
+   * @brief Add a contribution to the virial.
+   * @param virial The contribution to add.
    */
-  void zero_forces() { force_.zero(); }
+  void add_virial(double virial) { virial_ += virial; }
 
   /**
    * @brief Compute the kinetic energy of either a single atom, or the entire
@@ -99,15 +191,18 @@ class DynamicAtomicState : public AtomicState {
    */
   double kinetic(std::optional<std::size_t> iatom = std::nullopt) const {
     if (iatom) {
-      return 0.5 * atom_types_[*iatom]->mass() *
-             vel_.inner_product<0>(*iatom, *iatom);
+      return 0.5 * mass_[*iatom] * vel_.inner_product<0>(*iatom, *iatom);
     }
 
     double kin = 0;
-    Tensor<double, 2>::const_iterator velocity = vel();
-    for (std::size_t jatom = 0; jatom < num_atoms(); ++jatom) {
-      kin += atom_types_[jatom]->mass() * vel_.inner_product<0>(jatom, jatom);
-      velocity += 3;
+    const double* v = std::to_address(vel());
+    const double* m = mass_.data();
+    const std::size_t num = mass_.size();
+#pragma omp parallel for simd schedule(static) reduction(+ : kin)
+    for (std::size_t jatom = 0; jatom < num; ++jatom) {
+      kin += m[jatom] * (v[3 * jatom] * v[3 * jatom] +
+                         v[3 * jatom + 1] * v[3 * jatom + 1] +
+                         v[3 * jatom + 2] * v[3 * jatom + 2]);
     }
     return 0.5 * kin;
   }
@@ -120,6 +215,8 @@ class DynamicAtomicState : public AtomicState {
 
  protected:
   Tensor<double, 2> vel_, force_;
+  std::vector<double> mass_, inv_mass_;
+  double virial_ = 0;
 };
 
 }  // namespace tyche
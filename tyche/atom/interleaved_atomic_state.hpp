@@ -0,0 +1,171 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_ATOM_INTERLEAVED_ATOMIC_STATE_HPP
+#define __TYCHE_ATOM_INTERLEAVED_ATOMIC_STATE_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Atomic states of several replicas of the same atoms, interleaved so
+ * that kernels vectorise across replicas rather than atoms.
+ *
+ * Each coordinate of each atom is followed by that of every other replica, so
+ * component idim of atom iatom in replica ireplica is at
+ *
+ *      (3 iatom + idim) num_replicas + ireplica
+ *
+ * of the positions, velocities and forces. The replicas share the atom types
+ * and masses of the atoms, but each sits in its own cubic cell and accumulates
+ * its own virial.
+ */
+class InterleavedAtomicState {
+ public:
+  /**
+   * @brief Class constructor, taking the atom types and masses from one of
+   * the replicas.
+   * @param state The atomic state of any of the replicas.
+   * @param num_replicas The number of replicas.
+   */
+  InterleavedAtomicState(const DynamicAtomicState& state,
+                         std::size_t num_replicas)
+      : num_atoms_(state.num_atoms()),
+        num_replicas_(num_replicas),
+        atom_type_indices_(state.atom_type_indices()),
+        inv_mass_(state.inv_mass()),
+        pos_(3 * num_atoms_ * num_replicas_),
+        vel_(3 * num_atoms_ * num_replicas_),
+        force_(3 * num_atoms_ * num_replicas_),
+        length_(num_replicas_),
+        virial_(num_replicas_) {}
+
+  /**
+   * @brief Copy the positions, velocities and forces of a replica in.
+   * @param ireplica The index of the replica.
+   * @param state The atomic state of the replica.
+   * @param cell The cubic cell the replica sits in.
+   */
+  void load(std::size_t ireplica, const DynamicAtomicState& state,
+            const CubicCell& cell) {
+    const double *pos = std::to_address(state.pos()),
+                 *vel = std::to_address(state.vel()),
+                 *force = std::to_address(state.force());
+    for (std::size_t idx = 0; idx < 3 * num_atoms_; ++idx) {
+      pos_[idx * num_replicas_ + ireplica] = pos[idx];
+      vel_[idx * num_replicas_ + ireplica] = vel[idx];
+      force_[idx * num_replicas_ + ireplica] = force[idx];
+    }
+    length_[ireplica] = cell.length();
+  }
+
+  /**
+   * @brief Copy the positions, velocities, forces and virial of a replica out.
+   * @param ireplica The index of the replica.
+   * @param state The atomic state of the replica.
+   */
+  void store(std::size_t ireplica, DynamicAtomicState& state) const {
+    // The virial can only be added to, so is zeroed along with the forces
+    state.zero_forces();
+    state.add_virial(virial_[ireplica]);
+    double *pos = std::to_address(state.pos()),
+           *vel = std::to_address(state.vel()),
+           *force = std::to_address(state.force());
+    for (std::size_t idx = 0; idx < 3 * num_atoms_; ++idx) {
+      pos[idx] = pos_[idx * num_replicas_ + ireplica];
+      vel[idx] = vel_[idx * num_replicas_ + ireplica];
+      force[idx] = force_[idx * num_replicas_ + ireplica];
+    }
+  }
+
+  /**
+   * @brief Getter for the number of atoms in each replica.
+   * @return The number of atoms.
+   */
+  std::size_t num_atoms() const { return num_atoms_; }
+
+  /**
+   * @brief Getter for the number of replicas.
+   * @return The number of replicas.
+   */
+  std::size_t num_replicas() const { return num_replicas_; }
+
+  /**
+   * @brief Getter for the index of the atom type of each atom.
+   * @return The atom type indices.
+   */
+  const std::vector<std::size_t>& atom_type_indices() const {
+    return atom_type_indices_;
+  }
+
+  /**
+   * @brief Getter for the inverse mass of each atom.
+   * @return The inverse masses.
+   */
+  const std::vector<double>& inv_mass() const { return inv_mass_; }
+
+  /**
+   * @brief Getter for the interleaved positions.
+   * @return Pointer to the positions.
+   */
+  double* pos() { return pos_.data(); }
+  const double* pos() const { return pos_.data(); }
+
+  /**
+   * @brief Getter for the interleaved velocities.
+   * @return Pointer to the velocities.
+   */
+  double* vel() { return vel_.data(); }
+  const double* vel() const { return vel_.data(); }
+
+  /**
+   * @brief Getter for the interleaved forces.
+   * @return Pointer to the forces.
+   */
+  double* force() { return force_.data(); }
+  const double* force() const { return force_.data(); }
+
+  /**
+   * @brief Getter for the length of the cubic cell of each replica.
+   * @return Pointer to the cell lengths.
+   */
+  const double* length() const { return length_.data(); }
+
+  /**
+   * @brief Getter for the virial of each replica, \sum_i r_i . f_i,
+   * accumulated alongside the forces.
+   * @return Pointer to the virials.
+   */
+  double* virial() { return virial_.data(); }
+  const double* virial() const { return virial_.data(); }
+
+  /**
+   * @brief Zero the forces of every replica, along with their virials.
+   */
+  void zero_forces() {
+    std::fill(force_.begin(), force_.end(), 0.0);
+    std::fill(virial_.begin(), virial_.end(), 0.0);
+  }
+
+ private:
+  std::size_t num_atoms_, num_replicas_;
+  std::vector<std::size_t> atom_type_indices_;
+  std::vector<double> inv_mass_;
+  std::vector<double> pos_, vel_, force_;
+  //< Length of the cubic cell of each replica
+  std::vector<double> length_;
+  //< Virial of each replica at the last evaluation
+  std::vector<double> virial_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_ATOM_INTERLEAVED_ATOMIC_STATE_HPP */
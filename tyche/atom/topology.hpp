@@ -0,0 +1,239 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_ATOM_TOPOLOGY_HPP
+#define __TYCHE_ATOM_TOPOLOGY_HPP
+
+// C++ Standard Libraries
+#include <span>
+#include <array>
+#include <string>
+#include <vector>
+#include <optional>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+//
+
+namespace tyche {
+
+/**
+ * @brief List of bonded terms of the same kind, each of which couples a fixed
+ * number of atoms through a fixed number of parameters.
+ *
+ * Terms are stored as a structure of arrays: one contiguous array of atom
+ * indices for each position in the term, and one contiguous array for each
+ * parameter, so that force kernels can stream through them with unit stride.
+ * @tparam NumAtoms The number of atoms taking part in each term.
+ * @tparam NumParams The number of parameters of each term.
+ */
+template <std::size_t NumAtoms, std::size_t NumParams>
+class BondedTerms {
+ public:
+  static constexpr std::size_t num_atoms = NumAtoms;
+  static constexpr std::size_t num_params = NumParams;
+
+  /**
+   * @brief Add a term to the list.
+   * @param atoms Indices of the atoms taking part in the term, in order.
+   * @param params Parameters of the term.
+   */
+  void add(const std::array<std::size_t, NumAtoms>& atoms,
+           const std::array<double, NumParams>& params) {
+    for (std::size_t slot = 0; slot < NumAtoms; ++slot) {
+      for (std::size_t other = slot + 1; other < NumAtoms; ++other) {
+        if (atoms[slot] == atoms[other]) {
+          throw std::runtime_error(
+              "An atom can only appear once in a bonded term.");
+        }
+      }
+    }
+    // Every term we support is symmetric under reversal of its atoms, so store
+    // them with the lower index first; that way sorting groups together terms
+    // that share atoms
+    bool reverse = atoms.front() > atoms.back();
+    for (std::size_t slot = 0; slot < NumAtoms; ++slot) {
+      atoms_[slot].push_back(atoms[reverse ? NumAtoms - 1 - slot : slot]);
+    }
+    for (std::size_t iparam = 0; iparam < NumParams; ++iparam) {
+      params_[iparam].push_back(params[iparam]);
+    }
+  }
+
+  /**
+   * @brief Sort the terms lexicographically by their atom indices, so that
+   * consecutive terms touch nearby memory in the atomic state.
+   */
+  void sort() {
+    std::vector<std::size_t> order(size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) {
+                       for (const auto& slot : atoms_) {
+                         if (slot[a] != slot[b]) return slot[a] < slot[b];
+                       }
+                       return false;
+                     });
+    for (auto& slot : atoms_) permute(slot, order);
+    for (auto& param : params_) permute(param, order);
+  }
+
+  /**
+   * @brief Getter for the number of terms.
+   * @return The number of terms.
+   */
+  std::size_t size() const { return atoms_[0].size(); }
+
+  /**
+   * @brief Getter for the largest atom index referenced by any term.
+   * @return The largest atom index, or nothing if there are no terms.
+   */
+  std::optional<std::size_t> max_atom() const {
+    if (size() == 0) return std::nullopt;
+    std::size_t max = 0;
+    for (const auto& slot : atoms_) {
+      max = std::max(max, *std::max_element(slot.begin(), slot.end()));
+    }
+    return max;
+  }
+
+  /**
+   * @brief Getter for the atom indices at some position in every term.
+   * @param slot The position within the term, on [0,NumAtoms).
+   * @return The index of the atom at that position, for each term.
+   */
+  const std::vector<std::size_t>& atoms(std::size_t slot) const {
+    return atoms_[slot];
+  }
+
+  /**
+   * @brief Getter for a parameter of every term.
+   * @param iparam The index of the parameter, on [0,NumParams).
+   * @return The parameter for each term.
+   */
+  const std::vector<double>& param(std::size_t iparam) const {
+    return params_[iparam];
+  }
+
+ private:
+  std::array<std::vector<std::size_t>, NumAtoms> atoms_;
+  std::array<std::vector<double>, NumParams> params_;
+
+  /**
+   * @brief Reorder an array.
+   * @param data The array to reorder.
+   * @param order The index into the original array of each reordered element.
+   */
+  template <typename T>
+  static void permute(std::vector<T>& data,
+                      const std::vector<std::size_t>& order) {
+    std::vector<T> permuted(data.size());
+    for (std::size_t idx = 0; idx < order.size(); ++idx) {
+      permuted[idx] = data[order[idx]];
+    }
+    data = std::move(permuted);
+  }
+};
+
+/**
+ * @brief List of rigid bodies, each of which is a group of atoms whose
+ * relative positions are fixed. Atoms of all bodies are stored contiguously,
+ * with the atoms of each body delimited by offsets.
+ */
+class RigidBodies {
+ public:
+  /**
+   * @brief Class constructor.
+   */
+  RigidBodies() : offsets_{0} {}
+
+  /**
+   * @brief Add a rigid body to the list.
+   * @param atoms Indices of the atoms that make up the body.
+   */
+  void add(const std::vector<std::size_t>& atoms) {
+    if (atoms.size() < 2) {
+      throw std::runtime_error("A rigid body needs at least two atoms.");
+    }
+    atoms_.insert(atoms_.end(), atoms.begin(), atoms.end());
+    offsets_.push_back(atoms_.size());
+  }
+
+  /**
+   * @brief Getter for the number of rigid bodies.
+   * @return The number of rigid bodies.
+   */
+  std::size_t size() const { return offsets_.size() - 1; }
+
+  /**
+   * @brief Getter for the atoms of a rigid body.
+   * @param ibody The index of the rigid body.
+   * @return The indices of the atoms of the body.
+   */
+  std::span<const std::size_t> atoms(std::size_t ibody) const {
+    return std::span<const std::size_t>(atoms_.data() + offsets_[ibody],
+                                        offsets_[ibody + 1] - offsets_[ibody]);
+  }
+
+  /**
+   * @brief Getter for the largest atom index in any body.
+   * @return The largest atom index, or nothing if there are no bodies.
+   */
+  std::optional<std::size_t> max_atom() const {
+    if (atoms_.empty()) return std::nullopt;
+    return *std::max_element(atoms_.begin(), atoms_.end());
+  }
+
+ private:
+  std::vector<std::size_t> atoms_, offsets_;
+};
+
+/**
+ * @brief Bonded connectivity of the atoms in an atomic state. Atoms are
+ * referred to by their index within the atomic state.
+ */
+struct Topology {
+  //< Harmonic bonds with parameters (k, r0)
+  BondedTerms<2, 2> bonds;
+  //< Harmonic angles, about the middle atom, with parameters (k, theta0)
+  BondedTerms<3, 2> angles;
+  //< Periodic dihedrals with parameters (k, n, phi0)
+  BondedTerms<4, 3> dihedrals;
+  //< Holonomic distance constraints with parameter (distance)
+  BondedTerms<2, 1> constraints;
+  //< Groups of atoms that move as rigid bodies
+  RigidBodies rigid_bodies;
+
+  /**
+   * @brief Sort all term lists for locality.
+   */
+  void sort() {
+    bonds.sort();
+    angles.sort();
+    dihedrals.sort();
+    constraints.sort();
+  }
+
+  /**
+   * @brief Make sure every term refers to an atom that exists.
+   * @param num_atoms The number of atoms in the atomic state.
+   */
+  void validate(std::size_t num_atoms) const {
+    for (auto max_atom :
+         {bonds.max_atom(), angles.max_atom(), dihedrals.max_atom(),
+          constraints.max_atom(), rigid_bodies.max_atom()}) {
+      if (max_atom && *max_atom >= num_atoms) {
+        throw std::runtime_error("Topology refers to atom " +
+                                 std::to_string(*max_atom) + " but there are " +
+                                 std::to_string(num_atoms) + " atoms.");
+      }
+    }
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_ATOM_TOPOLOGY_HPP */
@@ -0,0 +1,175 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_ATOM_TOPOLOGY_READER_HPP
+#define __TYCHE_ATOM_TOPOLOGY_READER_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <string>
+#include <numbers>
+// Third-Party Libraries
+#include <toml++/toml.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/must.hpp"
+#include "tyche/io/toml_reader.hpp"
+#include "tyche/atom/topology.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Reader for the bonded topology of an atomic state.
+ *
+ * The topology sits within the "Atoms" node, and is read along with the
+ * atomic state. Each kind of term is an array of tables; each table holds the
+ * parameters shared by a group of terms, and the atoms of each term in that
+ * group, e.g.
+ *
+ *      [[Atoms.Topology.Bonds]]
+ *      k = 0.1
+ *      r0 = 1.54
+ *      atoms = [[0, 1], [1, 2]]
+ *
+ *      [[Atoms.Topology.Angles]]
+ *      k = 0.05
+ *      theta0 = 109.5
+ *      atoms = [[0, 1, 2]]
+ *
+ *      [[Atoms.Topology.Dihedrals]]
+ *      k = 0.01
+ *      n = 3
+ *      phi0 = 0
+ *      atoms = [[0, 1, 2, 3]]
+ *
+ *      [[Atoms.Topology.Constraints]]
+ *      distance = 1.09
+ *      atoms = [[3, 4]]
+ *
+ *      [[Atoms.Topology.RigidBodies]]
+ *      atoms = [[5, 6, 7], [8, 9, 10]]
+ *
+ * Atoms are indexed by their position in the atomic state, i.e. ordered by
+ * atom type identifier and then by the order of their positions. Force
+ * constants are in internal energy units, and equilibrium angles are in
+ * degrees.
+ */
+class TopologyReader : public TOMLReader<Topology> {
+ public:
+  /**
+   * @brief Class constructor.
+   */
+  TopologyReader() {}
+
+  /**
+   * @brief Parse the topology from the TOML config.
+   * @param config "Topology" node of the TOML.
+   * @return The instantiated Topology, with its terms sorted for locality.
+   */
+  Topology parse(toml::table& config) {
+    Topology topology;
+    parse_terms(config, "Bonds", topology.bonds, [](Mapping& mapping) {
+      return std::array<double, 2>{must_find<double>(mapping, "k"),
+                                   must_find<double>(mapping, "r0")};
+    });
+    parse_terms(config, "Angles", topology.angles, [](Mapping& mapping) {
+      return std::array<double, 2>{
+          must_find<double>(mapping, "k"),
+          must_find<double>(mapping, "theta0") * degrees_to_radians};
+    });
+    parse_terms(config, "Dihedrals", topology.dihedrals, [](Mapping& mapping) {
+      return std::array<double, 3>{
+          must_find<double>(mapping, "k"), must_find<double>(mapping, "n"),
+          must_find<double>(mapping, "phi0") * degrees_to_radians};
+    });
+    parse_terms(config, "Constraints", topology.constraints,
+                [](Mapping& mapping) {
+                  return std::array<double, 1>{
+                      must_find<double>(mapping, "distance")};
+                });
+    parse_rigid_bodies(config, topology.rigid_bodies);
+    topology.sort();
+    spdlog::info(
+        "Found {} bond/s, {} angle/s, {} dihedral/s, {} constraint/s and {} "
+        "rigid bodies.",
+        topology.bonds.size(), topology.angles.size(),
+        topology.dihedrals.size(), topology.constraints.size(),
+        topology.rigid_bodies.size());
+    return topology;
+  }
+
+ private:
+  static constexpr double degrees_to_radians = std::numbers::pi / 180;
+
+  /**
+   * @brief Parse all groups of one kind of term.
+   * @param config "Topology" node of the TOML.
+   * @param key The name of the array of tables holding the groups.
+   * @param terms The list of terms to add to.
+   * @param parse_params Function returning the parameters of a group from
+   * the mapping of its table.
+   */
+  template <class Terms, class ParamParser>
+  void parse_terms(toml::table& config, std::string key, Terms& terms,
+                   ParamParser parse_params) {
+    if (!config[key]) return;
+    for (auto&& node : *config[key].as_array()) {
+      toml::table& group = *node.as_table();
+      auto params_mapping = parse_table(group);
+      auto params = parse_params(params_mapping);
+
+      if (!group["atoms"]) {
+        throw std::runtime_error("Topology." + key + " requires atoms.");
+      }
+      auto atoms = parse_matrix<int64_t>(*group["atoms"].as_array());
+      if (atoms.num_elements() == 0) continue;
+      if (atoms.size(1) != Terms::num_atoms) {
+        throw std::runtime_error(
+            "Each of Topology." + key + " must have " +
+            std::to_string(Terms::num_atoms) + " atoms.");
+      }
+      for (std::size_t iterm = 0; iterm < atoms.size(0); ++iterm) {
+        std::array<std::size_t, Terms::num_atoms> term;
+        for (std::size_t slot = 0; slot < Terms::num_atoms; ++slot) {
+          if (atoms(iterm, slot) < 0) {
+            throw std::runtime_error("Atom indices must be non-negative.");
+          }
+          term[slot] = atoms(iterm, slot);
+        }
+        terms.add(term, params);
+      }
+    }
+  }
+
+  /**
+   * @brief Parse all groups of rigid bodies. Bodies within a group must all
+   * have the same number of atoms.
+   * @param config "Topology" node of the TOML.
+   * @param bodies The list of rigid bodies to add to.
+   */
+  void parse_rigid_bodies(toml::table& config, RigidBodies& bodies) {
+    if (!config["RigidBodies"]) return;
+    for (auto&& node : *config["RigidBodies"].as_array()) {
+      toml::table& group = *node.as_table();
+      if (!group["atoms"]) {
+        throw std::runtime_error("Topology.RigidBodies requires atoms.");
+      }
+      auto atoms = parse_matrix<int64_t>(*group["atoms"].as_array());
+      if (atoms.num_elements() == 0) continue;
+      for (std::size_t ibody = 0; ibody < atoms.size(0); ++ibody) {
+        std::vector<std::size_t> body(atoms.size(1));
+        for (std::size_t iatom = 0; iatom < body.size(); ++iatom) {
+          if (atoms(ibody, iatom) < 0) {
+            throw std::runtime_error("Atom indices must be non-negative.");
+          }
+          body[iatom] = atoms(ibody, iatom);
+        }
+        bodies.add(body);
+      }
+    }
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_ATOM_TOPOLOGY_READER_HPP */
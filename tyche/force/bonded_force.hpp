@@ -0,0 +1,181 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_BONDED_FORCE_HPP
+#define __TYCHE_FORCE_BONDED_FORCE_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <stdexcept>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/atom/topology.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/force/force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Base class for forces evaluated over a list of bonded terms.
+ *
+ * Evaluation is split into two threaded passes so that neither needs atomics.
+ * The first streams over the terms, writing the force each term exerts on each
+ * of its atoms into a structure of arrays; derived classes provide this pass,
+ * which vectorises since each term is independent. The second gathers, for
+ * each bonded atom, the contributions of every term it takes part in, using an
+ * incidence list built once at construction.
+ * @tparam Terms The BondedTerms type the force is evaluated over.
+ */
+template <class Terms>
+class BondedForce : public Force {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param topology The topology holding the terms, which is kept alive by
+   * the force.
+   * @param terms The list of terms within the topology to evaluate.
+   */
+  BondedForce(std::shared_ptr<const Topology> topology, const Terms& terms)
+      : topology_(topology), terms_(terms) {
+    build_incidence();
+  }
+
+  /**
+   * @brief Evaluate all forces arising from the bonded terms, accumulating
+   * their virial.
+   * @param state The atomic state we're computing the forces for.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The potential energy of the bonded terms.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override {
+    term_force_.resize(3 * Terms::num_atoms * terms_.size());
+    double virial = 0;
+    double pot = compute(state.pos(), cell, virial);
+    state.add_virial(virial);
+
+    Tensor<double, 2>::iterator force = state.force();
+    const std::size_t stride = terms_.size();
+#pragma omp parallel for schedule(static)
+    for (std::size_t idx = 0; idx < atoms_.size(); ++idx) {
+      double fx = 0, fy = 0, fz = 0;
+      for (std::size_t ientry = offsets_[idx]; ientry < offsets_[idx + 1];
+           ++ientry) {
+        const double* f = term_force_.data() + entries_[ientry];
+        fx += f[0];
+        fy += f[stride];
+        fz += f[2 * stride];
+      }
+      force[3 * atoms_[idx]] += fx;
+      force[3 * atoms_[idx] + 1] += fy;
+      force[3 * atoms_[idx] + 2] += fz;
+    }
+    return pot;
+  }
+
+ protected:
+  /**
+   * @brief Compute the energy of every term and the force each exerts on its
+   * atoms, storing the latter with term_force().
+   * @param pos Iterator to the start of the atomic positions.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param virial The virial, \sum_i r_i . f_i, summed over all terms.
+   * @return The potential energy summed over all terms.
+   */
+  virtual double compute(Tensor<double, 2>::const_iterator pos,
+                         const Cell& cell, double& virial) = 0;
+
+  /**
+   * @brief Getter for the storage of one component of the force each term
+   * exerts on one of its atoms.
+   * @param slot The position of the atom within the term.
+   * @param dim The Cartesian component of the force.
+   * @return Pointer to the force component, contiguous over terms.
+   */
+  double* term_force(std::size_t slot, std::size_t dim) {
+    return term_force_.data() + (3 * slot + dim) * terms_.size();
+  }
+
+  /**
+   * @brief Find the periodicity of the cell so that the minimum image
+   * convention can be applied inline in vectorised loops, as
+   * dx -= length * round(dx * inv_length).
+   * @param cell The simulation cell.
+   * @param length The cell length, or zero if the cell isn't periodic.
+   * @param inv_length The inverse cell length, or zero if the cell isn't
+   * periodic.
+   */
+  static void periodicity(const Cell& cell, double& length,
+                          double& inv_length) {
+    if (auto cubic = dynamic_cast<const CubicCell*>(&cell)) {
+      length = cubic->length();
+      inv_length = 1 / length;
+    } else if (dynamic_cast<const UnboundedCell*>(&cell)) {
+      length = inv_length = 0;
+    } else {
+      throw std::runtime_error("Bonded forces don't support this cell.");
+    }
+  }
+
+  /**
+   * @brief Make sure there's a topology to evaluate.
+   * @param topology The topology.
+   * @return The topology.
+   */
+  static std::shared_ptr<const Topology> require(
+      std::shared_ptr<const Topology> topology) {
+    if (!topology) {
+      throw std::runtime_error("Bonded forces require a Topology.");
+    }
+    return topology;
+  }
+
+  std::shared_ptr<const Topology> topology_;
+  const Terms& terms_;
+
+ private:
+  //< Force of each term on each of its atoms; see term_force()
+  std::vector<double> term_force_;
+  //< Each atom that takes part in at least one term, in ascending order
+  std::vector<std::size_t> atoms_;
+  //< Offset into entries_ of the first term of each atom in atoms_
+  std::vector<std::size_t> offsets_;
+  //< Offset into term_force_ of the x component of each incidence
+  std::vector<std::size_t> entries_;
+
+  /**
+   * @brief Build the list of terms each atom takes part in.
+   */
+  void build_incidence() {
+    const std::size_t num_terms = terms_.size();
+    auto max_atom = terms_.max_atom();
+    std::vector<std::size_t> count(max_atom ? *max_atom + 1 : 0, 0);
+    for (std::size_t slot = 0; slot < Terms::num_atoms; ++slot) {
+      for (std::size_t iatom : terms_.atoms(slot)) ++count[iatom];
+    }
+
+    std::vector<std::size_t> position(count.size());
+    offsets_.assign(1, 0);
+    atoms_.clear();
+    for (std::size_t iatom = 0; iatom < count.size(); ++iatom) {
+      if (count[iatom] == 0) continue;
+      position[iatom] = offsets_.back();
+      atoms_.push_back(iatom);
+      offsets_.push_back(offsets_.back() + count[iatom]);
+    }
+
+    entries_.resize(offsets_.back());
+    for (std::size_t iterm = 0; iterm < num_terms; ++iterm) {
+      for (std::size_t slot = 0; slot < Terms::num_atoms; ++slot) {
+        std::size_t iatom = terms_.atoms(slot)[iterm];
+        entries_[position[iatom]++] = 3 * slot * num_terms + iterm;
+      }
+    }
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_BONDED_FORCE_HPP */
@@ -0,0 +1,63 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_BORN_MAYER_HPP
+#define __TYCHE_FORCE_BORN_MAYER_HPP
+
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/pair_potential.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Born-Mayer repulsion, U = A \exp(-r / \rho).
+ *
+ * Parameters are read from the atom types as A_born_mayer and rho_born_mayer.
+ * A is mixed geometrically and \rho arithmetically.
+ */
+class BornMayer : public PairPotential<BornMayer, 2> {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param cutoff The interaction cutoff distance.
+   * @param skin Neighbour list skin distance.
+   */
+  BornMayer(const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+            double cutoff, double skin)
+      : PairPotential(atom_types, cutoff, skin) {}
+
+  /**
+   * @brief Mix the parameters of two atom types.
+   * @param itype An atom type.
+   * @param jtype An atom type.
+   * @return A and 1 / \rho of the pair.
+   */
+  static Coefficients mix(AtomType& itype, AtomType& jtype) {
+    return {std::sqrt(itype.get<double>("A_born_mayer") *
+                      jtype.get<double>("A_born_mayer")),
+            2 / (itype.get<double>("rho_born_mayer") +
+                 jtype.get<double>("rho_born_mayer"))};
+  }
+
+  /**
+   * @brief Evaluate the potential for a pair of atoms.
+   * @param rsq The squared separation of the atoms.
+   * @param coeffs The coefficients of the pair.
+   * @return The energy, and force divided by the separation.
+   */
+  static PairTerm energy_force(double rsq, const Coefficients& coeffs) {
+    const auto [a, inv_rho] = coeffs;
+    double r = std::sqrt(rsq);
+    double energy = a * std::exp(-r * inv_rho);
+    return {energy, energy * inv_rho / r};
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_BORN_MAYER_HPP */
@@ -0,0 +1,67 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_BUCKINGHAM_HPP
+#define __TYCHE_FORCE_BUCKINGHAM_HPP
+
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/pair_potential.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Buckingham potential, U = A \exp(-r / \rho) - C / r^6.
+ *
+ * Parameters are read from the atom types as A_buckingham, rho_buckingham and
+ * C_buckingham. A and C are mixed geometrically and \rho arithmetically.
+ */
+class Buckingham : public PairPotential<Buckingham, 3> {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param cutoff The interaction cutoff distance.
+   * @param skin Neighbour list skin distance.
+   */
+  Buckingham(const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+             double cutoff, double skin)
+      : PairPotential(atom_types, cutoff, skin) {}
+
+  /**
+   * @brief Mix the parameters of two atom types.
+   * @param itype An atom type.
+   * @param jtype An atom type.
+   * @return A, 1 / \rho and C of the pair.
+   */
+  static Coefficients mix(AtomType& itype, AtomType& jtype) {
+    return {std::sqrt(itype.get<double>("A_buckingham") *
+                      jtype.get<double>("A_buckingham")),
+            2 / (itype.get<double>("rho_buckingham") +
+                 jtype.get<double>("rho_buckingham")),
+            std::sqrt(itype.get<double>("C_buckingham") *
+                      jtype.get<double>("C_buckingham"))};
+  }
+
+  /**
+   * @brief Evaluate the potential for a pair of atoms.
+   * @param rsq The squared separation of the atoms.
+   * @param coeffs The coefficients of the pair.
+   * @return The energy, and force divided by the separation.
+   */
+  static PairTerm energy_force(double rsq, const Coefficients& coeffs) {
+    const auto [a, inv_rho, c] = coeffs;
+    double r = std::sqrt(rsq), inv_rsq = 1 / rsq;
+    double repulsion = a * std::exp(-r * inv_rho);
+    double dispersion = c * inv_rsq * inv_rsq * inv_rsq;
+    return {repulsion - dispersion,
+            repulsion * inv_rho / r - 6 * dispersion * inv_rsq};
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_BUCKINGHAM_HPP */
@@ -0,0 +1,137 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/util/tensor.hpp"
+#include "tyche/force/dissipative_particle_dynamics.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+DissipativeParticleDynamics::DissipativeParticleDynamics(
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+    double temperature, std::uint64_t seed, double skin)
+    : num_types_(atom_types.size()),
+      a_(num_types_ * num_types_),
+      gamma_(num_types_ * num_types_),
+      sigma_(num_types_ * num_types_),
+      cutoff_(num_types_ * num_types_),
+      random_(seed, RandomStream::DissipativeParticleDynamics),
+      step_(0),
+      num_evaluations_(0),
+      neighbours_(max_cutoff(atom_types), skin, true) {
+  const double kt =
+      constants::boltzmann * constants::joule_to_internal * temperature;
+  for (const auto& itype : atom_types) {
+    for (const auto& jtype : atom_types) {
+      std::size_t idx = itype.second * num_types_ + jtype.second;
+      auto mix = [&](std::string name) {
+        return (itype.first->get<double>(name) +
+                jtype.first->get<double>(name)) /
+               2;
+      };
+      a_[idx] = mix("a_dpd");
+      gamma_[idx] = mix("gamma_dpd");
+      sigma_[idx] = std::sqrt(2 * gamma_[idx] * kt);
+      cutoff_[idx] = mix("rc_dpd");
+    }
+  }
+}
+
+// ========================================================================== //
+
+double DissipativeParticleDynamics::max_cutoff(
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types) {
+  double cutoff = 0;
+  for (const auto& itype : atom_types) {
+    for (const auto& jtype : atom_types) {
+      cutoff = std::max(cutoff, (itype.first->get<double>("rc_dpd") +
+                                 jtype.first->get<double>("rc_dpd")) /
+                                    2);
+    }
+  }
+  return cutoff;
+}
+
+// ========================================================================== //
+
+double DissipativeParticleDynamics::evaluate(DynamicAtomicState& state,
+                                             const Cell& cell) {
+  if (!inv_sqrt_dt_) {
+    throw std::runtime_error(
+        "DPD needs the time increment before evaluating random forces.");
+  }
+  const double inv_sqrt_dt = *inv_sqrt_dt_;
+  neighbours_.update(state, cell);
+  // Integrators evaluate a handful of times a step, far short of the bits of
+  // the step. Without steps, evaluations are simply counted
+  const std::uint64_t key = step_ << evaluation_bits | num_evaluations_++;
+
+  const auto& types = state.atom_type_indices();
+  Tensor<double, 2>::const_iterator pos = state.pos(), vel = state.vel();
+  Tensor<double, 2>::iterator force = state.force();
+
+  double pot = 0, virial = 0;
+#pragma omp parallel for schedule(dynamic, 32) reduction(+ : pot, virial)
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    const std::size_t itype = types[iatom];
+    double fx = 0, fy = 0, fz = 0;
+    for (std::size_t jatom : neighbours_.neighbours(iatom)) {
+      double dx = pos[3 * iatom] - pos[3 * jatom];
+      double dy = pos[3 * iatom + 1] - pos[3 * jatom + 1];
+      double dz = pos[3 * iatom + 2] - pos[3 * jatom + 2];
+      cell.min_image(dx, dy, dz);
+      double rsq = dx * dx + dy * dy + dz * dz;
+
+      std::size_t idx = itype * num_types_ + types[jatom];
+      double cutoff = cutoff_[idx];
+      if (rsq >= cutoff * cutoff) continue;
+      double r = std::sqrt(rsq), inv_r = 1 / r;
+      double w = 1 - r / cutoff;
+
+      // Unit vector and relative velocity, from j to i
+      double ex = dx * inv_r, ey = dy * inv_r, ez = dz * inv_r;
+      double ev = ex * (vel[3 * iatom] - vel[3 * jatom]) +
+                  ey * (vel[3 * iatom + 1] - vel[3 * jatom + 1]) +
+                  ez * (vel[3 * iatom + 2] - vel[3 * jatom + 2]);
+
+      // Key the noise on the unordered pair so that theta_ij = theta_ji
+      std::uint64_t pair = std::uint64_t(std::min(iatom, jatom)) << 32 |
+                           std::max(iatom, jatom);
+      double theta = random_.normal(key, pair)[0];
+
+      double f = a_[idx] * w - gamma_[idx] * w * w * ev +
+                 sigma_[idx] * w * theta * inv_sqrt_dt;
+      fx += f * ex;
+      fy += f * ey;
+      fz += f * ez;
+      // Each pair is visited twice in a full list
+      pot += 0.25 * a_[idx] * cutoff * w * w;
+      virial += 0.5 * f * r;
+    }
+    force[3 * iatom] += fx;
+    force[3 * iatom + 1] += fy;
+    force[3 * iatom + 2] += fz;
+  }
+  state.add_virial(virial);
+  return pot;
+}
+
+// ========================================================================== //
+
+void DissipativeParticleDynamics::set_step(std::uint64_t step) {
+  step_ = step;
+  num_evaluations_ = 0;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,119 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_DISSIPATIVE_PARTICLE_DYNAMICS_HPP
+#define __TYCHE_FORCE_DISSIPATIVE_PARTICLE_DYNAMICS_HPP
+
+// C++ Standard Libraries
+#include <map>
+#include <memory>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <optional>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "tyche/force/force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Dissipative particle dynamics (Groot and Warren, J. Chem. Phys. 107,
+ * 4423 (1997)), where each pair of particles within a cutoff r_c interacts
+ * through conservative, dissipative and random forces along their separation,
+ *
+ *      F_ij = [a w - \gamma w^2 (e_ij . v_ij) + \sigma w \theta_ij / \sqrt{dt}]
+ *             e_ij
+ *
+ * with w = 1 - r_ij / r_c and \sigma^2 = 2 \gamma k_B T, so that the
+ * dissipative and random forces together act as a momentum-conserving
+ * thermostat. The conservative force has potential energy a r_c w^2 / 2.
+ * The time increment dt is set through set_dt before every step, so that it
+ * follows that of the integrator.
+ *
+ * Parameters are read from the atom types as a_dpd, gamma_dpd and rc_dpd, and
+ * are mixed arithmetically for unlike pairs.
+ *
+ * The Gaussian \theta_ij = \theta_ji is drawn from a counter-based generator
+ * keyed on the integration step, the evaluation within it and the pair of
+ * atoms, so forces don't depend on the number of threads, the order in which
+ * pairs are visited or any evaluations outside of steps. Each atom
+ * sums over its own neighbours in a full list, so no two threads write to the
+ * same atom.
+ */
+class DissipativeParticleDynamics : public Force {
+ public:
+  /**
+   * @brief Class constructor. Initialise all mixed atom type parameters here so
+   * we don't have to do it for every pair during evaluation.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param temperature Temperature of the thermostat, in Kelvin.
+   * @param seed Seed of the random force.
+   * @param skin Neighbour list skin distance.
+   */
+  DissipativeParticleDynamics(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+      double temperature, std::uint64_t seed, double skin);
+
+  /**
+   * @brief Evaluate the conservative, dissipative and random forces between
+   * all pairs of atoms within the cutoff. Random forces are drawn afresh on
+   * every evaluation. The time increment must have been set.
+   * @param state The atomic state we're computing the forces for.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The conservative potential energy.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override;
+
+  /**
+   * @brief Key the random forces of the next evaluations on a step, counting
+   * evaluations within it afresh.
+   * @param step The index of the step.
+   */
+  void set_step(std::uint64_t step) override;
+
+  /**
+   * @brief Scale the random forces of the next evaluations to the time
+   * increment they're applied over, so that they balance the friction.
+   * @param dt The time increment.
+   */
+  void set_dt(double dt) override { inv_sqrt_dt_ = 1 / std::sqrt(dt); }
+
+  /**
+   * @brief The friction and random forces are only balanced over steps of the
+   * time increment set.
+   * @return True.
+   */
+  bool depends_on_dt() const override { return true; }
+
+ protected:
+  std::size_t num_types_;
+  //< Conservative strength, friction, noise strength and cutoff of each pair
+  //< of atom types
+  std::vector<double> a_, gamma_, sigma_, cutoff_;
+  //< Inverse square root of the time increment, once set
+  std::optional<double> inv_sqrt_dt_;
+  Philox random_;
+  //< Step and number of evaluations within it, which key the random force
+  std::uint64_t step_, num_evaluations_;
+  NeighbourList neighbours_;
+
+  //< Bits of the key given to the number of evaluations within a step
+  static constexpr std::uint64_t evaluation_bits = 20;
+
+  /**
+   * @brief Find the largest cutoff over all pairs of atom types.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @return The largest cutoff.
+   */
+  static double max_cutoff(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_DISSIPATIVE_PARTICLE_DYNAMICS_HPP */
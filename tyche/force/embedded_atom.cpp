@@ -0,0 +1,133 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/force/embedded_atom.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+EmbeddedAtom::EmbeddedAtom(
+    const EmbeddedAtomTables& tables,
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+    double skin)
+    : num_types_(atom_types.size()),
+      cutoff_sq_(tables.cutoff * tables.cutoff),
+      embedding_(atom_types.size()),
+      density_(atom_types.size()),
+      r_pair_(atom_types.size() * atom_types.size()),
+      neighbours_(tables.cutoff, skin, true) {
+  // Find which element in the tables each atom type corresponds to
+  std::vector<std::size_t> element(num_types_);
+  for (const auto& [atom_type, itype] : atom_types) {
+    auto it = std::find(tables.elements.begin(), tables.elements.end(),
+                        atom_type->id());
+    if (it == tables.elements.end())
+      throw std::runtime_error("No EAM tables for atom type " +
+                               atom_type->id());
+    element[itype] = std::distance(tables.elements.begin(), it);
+  }
+
+  const std::size_t num_elements = tables.elements.size();
+  for (std::size_t itype = 0; itype < num_types_; ++itype) {
+    std::size_t ielem = element[itype];
+    embedding_[itype] = CubicSpline(tables.embedding[ielem], 0, tables.drho);
+    density_[itype] = CubicSpline(tables.density[ielem], 0, tables.dr);
+    for (std::size_t jtype = 0; jtype < num_types_; ++jtype) {
+      r_pair_[itype * num_types_ + jtype] = CubicSpline(
+          tables.r_pair[ielem * num_elements + element[jtype]], 0, tables.dr);
+    }
+  }
+}
+
+// ========================================================================== //
+
+double EmbeddedAtom::evaluate(DynamicAtomicState& state, const Cell& cell) {
+  neighbours_.update(state, cell);
+
+  const std::size_t num_atoms = state.num_atoms();
+  rho_.resize(num_atoms);
+  d_embedding_.resize(num_atoms);
+
+  const auto& types = state.atom_type_indices();
+  Tensor<double, 2>::const_iterator pos = state.pos();
+  Tensor<double, 2>::iterator force = state.force();
+
+  // First pass: accumulate the density at each atom, and from it the embedding
+  // energy and its derivative
+  double pot = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : pot)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    double rho = 0;
+    for (std::size_t jatom : neighbours_.neighbours(iatom)) {
+      double dx = pos[3 * jatom] - pos[3 * iatom];
+      double dy = pos[3 * jatom + 1] - pos[3 * iatom + 1];
+      double dz = pos[3 * jatom + 2] - pos[3 * iatom + 2];
+      cell.min_image(dx, dy, dz);
+      double rsq = dx * dx + dy * dy + dz * dz;
+      if (rsq >= cutoff_sq_) continue;
+      rho += density_[types[jatom]](std::sqrt(rsq));
+    }
+    double embedding;
+    rho_[iatom] = rho;
+    embedding_[types[iatom]].evaluate(rho, embedding, d_embedding_[iatom]);
+    pot += embedding;
+  }
+
+  // Second pass: forces from the pair potential and the change in embedding
+  // energy of both atoms in each pair
+  double virial = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : pot, virial)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    const std::size_t itype = types[iatom];
+    double fx = 0, fy = 0, fz = 0;
+    for (std::size_t jatom : neighbours_.neighbours(iatom)) {
+      const std::size_t jtype = types[jatom];
+      double dx = pos[3 * jatom] - pos[3 * iatom];
+      double dy = pos[3 * jatom + 1] - pos[3 * iatom + 1];
+      double dz = pos[3 * jatom + 2] - pos[3 * iatom + 2];
+      cell.min_image(dx, dy, dz);
+      double rsq = dx * dx + dy * dy + dz * dz;
+      if (rsq >= cutoff_sq_) continue;
+      double r = std::sqrt(rsq), inv_r = 1 / r;
+
+      // Density contributed to iatom by jatom, and vice versa
+      double f_j, df_j, f_i, df_i;
+      density_[jtype].evaluate(r, f_j, df_j);
+      density_[itype].evaluate(r, f_i, df_i);
+
+      // Pair potential is tabulated as r * phi(r)
+      double z, dz_dr;
+      r_pair_[itype * num_types_ + jtype].evaluate(r, z, dz_dr);
+      double phi = z * inv_r;
+      double dphi = (dz_dr - phi) * inv_r;
+      // Each pair is visited twice in a full list
+      pot += 0.5 * phi;
+
+      double de_dr =
+          dphi + d_embedding_[iatom] * df_j + d_embedding_[jatom] * df_i;
+      double f_tmp = de_dr * inv_r;
+      fx += f_tmp * dx;
+      fy += f_tmp * dy;
+      fz += f_tmp * dz;
+      virial -= 0.5 * f_tmp * rsq;
+    }
+    force[3 * iatom] += fx;
+    force[3 * iatom + 1] += fy;
+    force[3 * iatom + 2] += fz;
+  }
+  state.add_virial(virial);
+  return pot;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
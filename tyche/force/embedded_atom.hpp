@@ -0,0 +1,75 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_EMBEDDED_ATOM_HPP
+#define __TYCHE_FORCE_EMBEDDED_ATOM_HPP
+
+// C++ Standard Libraries
+#include <map>
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/spline.hpp"
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/force/embedded_atom_reader.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Embedded-atom method force evaluation for an atomic state. The
+ * potential energy is
+ *
+ *      V = \sum_i F_i(\rho_i) + \frac{1}{2} \sum_{i \neq j} \phi_{ij}(r_{ij}),
+ *      \rho_i = \sum_{j \neq i} f_j(r_{ij})
+ *
+ * where F is the embedding function, f the electron density contributed by a
+ * neighbour and phi the pair potential, all of which are tabulated.
+ *
+ * Evaluation is in two passes over a full neighbour list: the first
+ * accumulates the density at each atom and the derivative of its embedding
+ * energy, and the second computes forces using them. Each atom only ever
+ * writes to its own entries, so both passes thread over atoms without
+ * contention.
+ */
+class EmbeddedAtom : public Force {
+ public:
+  /**
+   * @brief Class constructor. Build splines of the tabulated functions for
+   * each atom type present in the system.
+   * @param tables The tabulated functions; must contain an element whose
+   * identifier matches each atom type.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param skin Neighbour list skin distance.
+   */
+  EmbeddedAtom(
+      const EmbeddedAtomTables& tables,
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+      double skin);
+
+  /**
+   * @brief Evaluate all forces arising from the embedded-atom method potential
+   * between atoms in an atomic state. The virial is accumulated in the same
+   * loop as the forces.
+   * @param state The atomic state we're computing the forces for.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The embedded-atom method potential.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override;
+
+ protected:
+  std::size_t num_types_;
+  double cutoff_sq_;
+  std::vector<CubicSpline> embedding_, density_, r_pair_;
+  NeighbourList neighbours_;
+  //< Per-atom density and embedding energy derivative; persist between
+  //< evaluations so we only allocate when the number of atoms changes
+  std::vector<double> rho_, d_embedding_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_EMBEDDED_ATOM_HPP */
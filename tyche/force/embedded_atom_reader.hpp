@@ -0,0 +1,138 @@
+/**
+ * @brief Reader for tabulated embedded-atom method potentials.
+ */
+#ifndef __TYCHE_FORCE_EMBEDDED_ATOM_READER_HPP
+#define __TYCHE_FORCE_EMBEDDED_ATOM_READER_HPP
+
+// C++ Standard Libraries
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <filesystem>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/io/reader.hpp"
+#include "tyche/util/constants.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Tabulated functions defining an embedded-atom method potential for
+ * some set of elements. Energies are in internal units, distances in Angstrom.
+ */
+struct EmbeddedAtomTables {
+  //< Element identifiers, in the order they appear in the tables
+  std::vector<std::string> elements;
+  //< Number of points and spacing of the embedding function tabulation
+  std::size_t num_rho;
+  double drho;
+  //< Number of points and spacing of the density and pair tabulations
+  std::size_t num_r;
+  double dr;
+  //< Cutoff distance of the density and pair functions
+  double cutoff;
+  //< Embedding function F(rho) of each element
+  std::vector<std::vector<double>> embedding;
+  //< Electron density f(r) contributed by each element
+  std::vector<std::vector<double>> density;
+  //< Pair potential multiplied by distance, r * phi(r), for each pair of
+  //< elements; flattened with index (i * num_elements + j), symmetric
+  std::vector<std::vector<double>> r_pair;
+};
+
+/**
+ * @brief Reader for embedded-atom method potentials in the DYNAMO "setfl"
+ * format, which is the de facto standard format that tabulated potentials are
+ * distributed in. Energies are assumed to be tabulated in eV.
+ */
+class EmbeddedAtomReader : public Reader {
+ public:
+  /**
+   * @brief Class constructor.
+   */
+  EmbeddedAtomReader() {}
+
+  /**
+   * @brief Parse the tables from a setfl file.
+   * @param path The path to the setfl file.
+   * @return The tabulated functions.
+   */
+  EmbeddedAtomTables parse(std::filesystem::path path) {
+    std::ifstream ifs(path);
+    if (!ifs)
+      throw std::runtime_error("Couldn't open EAM potential file: " +
+                               path.string());
+    spdlog::info("Reading EAM potential from: {}", path.string());
+
+    // First three lines are comments
+    std::string line;
+    for (std::size_t iline = 0; iline < 3; ++iline) {
+      std::getline(ifs, line);
+    }
+
+    EmbeddedAtomTables tables;
+    std::size_t num_elements;
+    std::getline(ifs, line);
+    std::istringstream elements(line);
+    elements >> num_elements;
+    tables.elements.resize(num_elements);
+    for (auto& element : tables.elements) {
+      elements >> element;
+    }
+
+    // The remainder of the file is whitespace-separated, so we can just stream
+    // values regardless of how they're split across lines
+    ifs >> tables.num_rho >> tables.drho >> tables.num_r >> tables.dr >>
+        tables.cutoff;
+
+    tables.embedding.resize(num_elements);
+    tables.density.resize(num_elements);
+    for (std::size_t ielem = 0; ielem < num_elements; ++ielem) {
+      // Atomic number, mass, lattice constant and lattice type; unused
+      std::string ignore;
+      ifs >> ignore >> ignore >> ignore >> ignore;
+      tables.embedding[ielem] =
+          read_values(ifs, tables.num_rho, constants::ev_to_internal);
+      tables.density[ielem] = read_values(ifs, tables.num_r, 1);
+    }
+
+    tables.r_pair.resize(num_elements * num_elements);
+    for (std::size_t ielem = 0; ielem < num_elements; ++ielem) {
+      for (std::size_t jelem = 0; jelem <= ielem; ++jelem) {
+        tables.r_pair[ielem * num_elements + jelem] =
+            tables.r_pair[jelem * num_elements + ielem] =
+                read_values(ifs, tables.num_r, constants::ev_to_internal);
+      }
+    }
+
+    if (!ifs)
+      throw std::runtime_error("Malformed EAM potential file: " +
+                               path.string());
+    return tables;
+  }
+
+ private:
+  /**
+   * @brief Read some number of values from the stream.
+   * @param ifs The stream to read from.
+   * @param num_values The number of values to read.
+   * @param scale Factor to multiply each value by.
+   * @return The values read.
+   */
+  std::vector<double> read_values(std::ifstream& ifs, std::size_t num_values,
+                                  double scale) {
+    std::vector<double> values(num_values);
+    for (auto& value : values) {
+      ifs >> value;
+      value *= scale;
+    }
+    return values;
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_EMBEDDED_ATOM_READER_HPP */
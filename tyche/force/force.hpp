@@ -5,12 +5,18 @@
 #define __TYCHE_FORCE_FORCE_HPP
 
 // C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
 #include <functional>
 // Third-Party Libraries
 //
 // Project Inclusions
 #include "tyche/system/cell.hpp"
 #include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/interleaved_force.hpp"
 
 namespace tyche {
 
@@ -30,10 +36,49 @@ class Force {
    * @return The total energy associated with the forces.
    */
   virtual double evaluate(DynamicAtomicState& state, const Cell& cell) = 0;
+
+  /**
+   * @brief Tell the force which integration step its next evaluations belong
+   * to. Forces drawing random numbers key them on it, so a trajectory doesn't
+   * depend on how many evaluations there were outside of steps.
+   * @param step The index of the step.
+   */
+  virtual void set_step(std::uint64_t step) {}
+
+  /**
+   * @brief Tell the force the time increment of the steps its next
+   * evaluations belong to. Forces whose random kicks are scaled by it follow
+   * it, including as the time increment adapts.
+   * @param dt The time increment.
+   */
+  virtual void set_dt(double dt) {}
+
+  /**
+   * @brief Whether the force depends on the time increment set through
+   * set_dt, so is only valid over steps of that increment.
+   * @return True if the force follows the time increment.
+   */
+  virtual bool depends_on_dt() const { return false; }
+
+  /**
+   * @brief Combine this force with the same force of other replicas into one
+   * evaluated across an interleaved atomic state of them all.
+   * @param replicas The force of each replica, in the order of the replicas.
+   * @return The interleaved force, or nullptr if the force can't be
+   * interleaved.
+   */
+  virtual std::unique_ptr<InterleavedForce> interleave(
+      const std::vector<const Force*>& replicas) const {
+    return nullptr;
+  }
 };
 
 /**
  * @brief Wrapper for all forces required for atomic state propagation.
+ *
+ * Each force is assigned a level, so that multiple time-step integrators can
+ * evaluate fast-varying forces (level 0) more often than slowly-varying ones
+ * (higher levels). Integrators that don't distinguish levels evaluate them all.
  */
 class Forces : public Force {
  public:
@@ -48,24 +93,130 @@ class Forces : public Force {
     state.zero_forces();
 
     double pot = 0;
-    for (auto& force : forces_) {
-      pot += force->evaluate(state, cell);
+    for (std::size_t iforce = 0; iforce < forces_.size(); ++iforce) {
+      energies_[iforce] = forces_[iforce]->evaluate(state, cell);
+      pot += energies_[iforce];
+    }
+    return pot;
+  }
+
+  /**
+   * @brief Evaluate only the forces at one level for the argument atomic
+   * state.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param level The level of forces to evaluate.
+   * @return The potential energy accumulated across forces at the level.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell,
+                  std::size_t level) {
+    state.zero_forces();
+
+    double pot = 0;
+    for (std::size_t iforce = 0; iforce < forces_.size(); ++iforce) {
+      if (levels_[iforce] == level) {
+        energies_[iforce] = forces_[iforce]->evaluate(state, cell);
+        pot += energies_[iforce];
+      }
     }
     return pot;
   }
 
+  /**
+   * @brief Tell every force which integration step its next evaluations belong
+   * to.
+   * @param step The index of the step.
+   */
+  void set_step(std::uint64_t step) override {
+    for (auto& force : forces_) force->set_step(step);
+  }
+
+  /**
+   * @brief Tell every force the time increment of the steps its next
+   * evaluations belong to.
+   * @param dt The time increment.
+   */
+  void set_dt(double dt) override {
+    for (auto& force : forces_) force->set_dt(dt);
+  }
+
+  /**
+   * @brief Tell only the forces at one level the time increment they're
+   * evaluated over, as multiple time-step integrators step each level by its
+   * own.
+   * @param dt The time increment.
+   * @param level The level of forces.
+   */
+  void set_dt(double dt, std::size_t level) {
+    for (std::size_t iforce = 0; iforce < forces_.size(); ++iforce) {
+      if (levels_[iforce] == level) forces_[iforce]->set_dt(dt);
+    }
+  }
+
+  /**
+   * @brief Whether any registered force depends on the time increment.
+   * @return True if any force follows the time increment.
+   */
+  bool depends_on_dt() const override {
+    return std::any_of(forces_.begin(), forces_.end(),
+                       [](const auto& force) { return force->depends_on_dt(); });
+  }
+
   /**
    * @brief Add a Force object to the iterable of other force objects already
    * registered.
    * @param force An object which derives from Force, i.e. it provides an
    * evaluate method.
+   * @param level The level to evaluate the force at; 0 for the fastest
+   * varying forces.
    */
-  void add(std::unique_ptr<Force> force) {
+  void add(std::unique_ptr<Force> force, std::size_t level = 0) {
     forces_.push_back(std::move(force));
+    levels_.push_back(level);
+    energies_.push_back(0);
   }
 
+  /**
+   * @brief Setter for the potential energy of one force, for when it's been
+   * evaluated elsewhere, as for interleaved replicas.
+   * @param iforce The index of the force, in the order they were added.
+   * @param energy The potential energy.
+   */
+  void set_energy(std::size_t iforce, double energy) {
+    energies_[iforce] = energy;
+  }
+
+  /**
+   * @brief Getter for the potential energy summed over the last evaluation of
+   * each force, at whichever level, so that it needn't be evaluated again.
+   * @return The potential energy.
+   */
+  double potential() const {
+    return std::accumulate(energies_.begin(), energies_.end(), 0.0);
+  }
+
+  /**
+   * @brief Getter for the number of levels, i.e. one more than the highest
+   * level of any registered force.
+   * @return The number of levels.
+   */
+  std::size_t num_levels() const {
+    if (levels_.empty()) return 0;
+    return *std::max_element(levels_.begin(), levels_.end()) + 1;
+  }
+
+  /**
+   * @brief Getter for the registered forces.
+   * @return The forces.
+   */
+  const std::vector<std::unique_ptr<Force>>& forces() const { return forces_; }
+
  private:
   std::vector<std::unique_ptr<Force>> forces_;
+  //< Level of each force
+  std::vector<std::size_t> levels_;
+  //< Potential energy of each force at its last evaluation
+  std::vector<double> energies_;
 };
 
 }  // namespace tyche
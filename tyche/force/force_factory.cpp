@@ -7,8 +7,24 @@
 #include <spdlog/spdlog.h>
 // Project Inclusions
 #include "tyche/util/must.hpp"
+#include "tyche/util/maybe.hpp"
+#include "tyche/util/seed.hpp"
 #include "tyche/force/force_factory.hpp"
 #include "tyche/force/lennard_jones.hpp"
+#include "tyche/force/buckingham.hpp"
+#include "tyche/force/morse.hpp"
+#include "tyche/force/born_mayer.hpp"
+#include "tyche/force/weeks_chandler_andersen.hpp"
+#include "tyche/force/embedded_atom.hpp"
+#include "tyche/force/embedded_atom_reader.hpp"
+#include "tyche/force/stillinger_weber.hpp"
+#include "tyche/force/tersoff.hpp"
+#include "tyche/force/harmonic_bond.hpp"
+#include "tyche/force/harmonic_angle.hpp"
+#include "tyche/force/periodic_dihedral.hpp"
+#include "tyche/force/dissipative_particle_dynamics.hpp"
+#include "tyche/force/neural_network.hpp"
+#include "tyche/force/neural_network_reader.hpp"
 
 namespace tyche {
 
@@ -16,13 +32,60 @@ namespace tyche {
 
 std::unique_ptr<Force> ForceFactory::create(
     Reader::Mapping config,
-    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_type) {
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_type,
+    std::shared_ptr<const Topology> topology) {
   auto type = must_find<std::string>(config, "type");
   spdlog::info("Creating force of type: {}", type);
 
   std::unique_ptr<Force> force;
   if (type == "LennardJones") {
     force = std::make_unique<LennardJones>(atom_type);
+  } else if (type == "Buckingham") {
+    auto cutoff = must_find<double>(config, "cutoff");
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    force = std::make_unique<Buckingham>(atom_type, cutoff, skin);
+  } else if (type == "Morse") {
+    auto cutoff = must_find<double>(config, "cutoff");
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    force = std::make_unique<Morse>(atom_type, cutoff, skin);
+  } else if (type == "BornMayer") {
+    auto cutoff = must_find<double>(config, "cutoff");
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    force = std::make_unique<BornMayer>(atom_type, cutoff, skin);
+  } else if (type == "WCA") {
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    force = std::make_unique<WeeksChandlerAndersen>(atom_type, skin);
+  } else if (type == "EAM") {
+    auto path = must_find<std::string>(config, "path");
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    EmbeddedAtomReader reader;
+    force =
+        std::make_unique<EmbeddedAtom>(reader.parse(path), atom_type, skin);
+  } else if (type == "StillingerWeber") {
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    force = std::make_unique<StillingerWeber>(atom_type, skin);
+  } else if (type == "Tersoff") {
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    force = std::make_unique<Tersoff>(atom_type, skin);
+  } else if (type == "HarmonicBond") {
+    force = std::make_unique<HarmonicBond>(topology);
+  } else if (type == "HarmonicAngle") {
+    force = std::make_unique<HarmonicAngle>(topology);
+  } else if (type == "PeriodicDihedral") {
+    force = std::make_unique<PeriodicDihedral>(topology);
+  } else if (type == "DPD") {
+    auto temperature = must_find<double>(config, "temperature");
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    auto key = resolve_seed(config, "seed");
+    spdlog::info("DPD thermostat at {:.2f}K.", temperature);
+    force = std::make_unique<DissipativeParticleDynamics>(
+        atom_type, temperature, key, skin);
+  } else if (type == "NeuralNetwork") {
+    auto path = must_find<std::string>(config, "path");
+    auto skin = maybe_find<double>(config, "skin").value_or(default_skin);
+    NeuralNetworkReader reader;
+    force =
+        std::make_unique<NeuralNetwork>(reader.parse(path), atom_type, skin);
   } else {
     throw std::runtime_error("Unrecognised force: " + type);
   }
@@ -14,6 +14,7 @@
 // Project Inclusions
 #include "tyche/io/reader.hpp"
 #include "tyche/atom/atom_type.hpp"
+#include "tyche/atom/topology.hpp"
 #include "tyche/force/force.hpp"
 
 namespace tyche {
@@ -29,11 +30,19 @@ class ForceFactory {
    * create, as well as any additional information to instantiate that force.
    * @param atom_type Mapping from an atom type to a unique index from
    * [0,num_atom_types) within the system under consideration.
+   * @param topology The bonded topology of the system, required by bonded
+   * forces. Optional; nullptr if the atoms aren't bonded.
    * @return The force.
    */
   static std::unique_ptr<Force> create(
       Reader::Mapping config,
-      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_type);
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_type,
+      std::shared_ptr<const Topology> topology = nullptr);
+
+ private:
+  //< Neighbour list skin distance, in Angstrom, for forces that don't specify
+  //< one
+  static constexpr double default_skin = 1.0;
 };
 
 }  // namespace tyche
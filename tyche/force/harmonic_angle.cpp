@@ -0,0 +1,92 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/harmonic_angle.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+HarmonicAngle::HarmonicAngle(std::shared_ptr<const Topology> topology)
+    : BondedForce(topology, require(topology)->angles) {}
+
+// ========================================================================== //
+
+double HarmonicAngle::compute(Tensor<double, 2>::const_iterator pos,
+                              const Cell& cell, double& virial) {
+  double length, inv_length;
+  periodicity(cell, length, inv_length);
+
+  const std::size_t num_terms = terms_.size();
+  const std::size_t* a = terms_.atoms(0).data();
+  const std::size_t* b = terms_.atoms(1).data();
+  const std::size_t* c = terms_.atoms(2).data();
+  const double* k = terms_.param(0).data();
+  const double* theta0 = terms_.param(1).data();
+  double *fax = term_force(0, 0), *fay = term_force(0, 1),
+         *faz = term_force(0, 2);
+  double *fbx = term_force(1, 0), *fby = term_force(1, 1),
+         *fbz = term_force(1, 2);
+  double *fcx = term_force(2, 0), *fcy = term_force(2, 1),
+         *fcz = term_force(2, 2);
+
+  double pot = 0, vir = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : pot, vir)
+  for (std::size_t iterm = 0; iterm < num_terms; ++iterm) {
+    // Vectors from the middle atom to each of the outer atoms
+    double ax = pos[3 * a[iterm]] - pos[3 * b[iterm]];
+    double ay = pos[3 * a[iterm] + 1] - pos[3 * b[iterm] + 1];
+    double az = pos[3 * a[iterm] + 2] - pos[3 * b[iterm] + 2];
+    double cx = pos[3 * c[iterm]] - pos[3 * b[iterm]];
+    double cy = pos[3 * c[iterm] + 1] - pos[3 * b[iterm] + 1];
+    double cz = pos[3 * c[iterm] + 2] - pos[3 * b[iterm] + 2];
+    ax -= length * std::round(ax * inv_length);
+    ay -= length * std::round(ay * inv_length);
+    az -= length * std::round(az * inv_length);
+    cx -= length * std::round(cx * inv_length);
+    cy -= length * std::round(cy * inv_length);
+    cz -= length * std::round(cz * inv_length);
+    double inv_ra = 1 / std::sqrt(ax * ax + ay * ay + az * az);
+    double inv_rc = 1 / std::sqrt(cx * cx + cy * cy + cz * cz);
+    ax *= inv_ra;
+    ay *= inv_ra;
+    az *= inv_ra;
+    cx *= inv_rc;
+    cy *= inv_rc;
+    cz *= inv_rc;
+
+    double cos_theta = std::clamp(ax * cx + ay * cy + az * cz, -1.0, 1.0);
+    double theta = std::acos(cos_theta);
+    // Keep away from the singularity of dtheta/dcos at linear geometries
+    double sin_theta = std::max(std::sqrt(1 - cos_theta * cos_theta), 1E-8);
+
+    double bend = theta - theta0[iterm];
+    pot += 0.5 * k[iterm] * bend * bend;
+    // Force on each outer atom is -dV/dtheta dtheta/dcos dcos/dr
+    double pre = k[iterm] * bend / sin_theta;
+    fax[iterm] = pre * inv_ra * (cx - cos_theta * ax);
+    fay[iterm] = pre * inv_ra * (cy - cos_theta * ay);
+    faz[iterm] = pre * inv_ra * (cz - cos_theta * az);
+    fcx[iterm] = pre * inv_rc * (ax - cos_theta * cx);
+    fcy[iterm] = pre * inv_rc * (ay - cos_theta * cy);
+    fcz[iterm] = pre * inv_rc * (az - cos_theta * cz);
+    // Relative to the middle atom, as the forces sum to zero
+    vir += (ax * fax[iterm] + ay * fay[iterm] + az * faz[iterm]) / inv_ra +
+           (cx * fcx[iterm] + cy * fcy[iterm] + cz * fcz[iterm]) / inv_rc;
+    fbx[iterm] = -fax[iterm] - fcx[iterm];
+    fby[iterm] = -fay[iterm] - fcy[iterm];
+    fbz[iterm] = -faz[iterm] - fcz[iterm];
+  }
+  virial = vir;
+  return pot;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
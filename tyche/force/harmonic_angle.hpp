@@ -0,0 +1,47 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_HARMONIC_ANGLE_HPP
+#define __TYCHE_FORCE_HARMONIC_ANGLE_HPP
+
+// C++ Standard Libraries
+#include <memory>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/topology.hpp"
+#include "tyche/force/bonded_force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Harmonic angle bending force over the angles of a topology, with
+ * potential energy
+ *
+ *      V = \frac{1}{2} k (\theta - \theta_0)^2
+ *
+ * where theta is the angle between the outer atoms about the middle atom.
+ */
+class HarmonicAngle : public BondedForce<BondedTerms<3, 2>> {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param topology The topology holding the angles.
+   */
+  HarmonicAngle(std::shared_ptr<const Topology> topology);
+
+ protected:
+  /**
+   * @brief Compute the energy and forces of every angle.
+   * @param pos Iterator to the start of the atomic positions.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param virial The virial of the forces.
+   * @return The angle bending energy.
+   */
+  double compute(Tensor<double, 2>::const_iterator pos, const Cell& cell,
+                 double& virial) override;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_HARMONIC_ANGLE_HPP */
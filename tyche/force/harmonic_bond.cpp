@@ -0,0 +1,63 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/harmonic_bond.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+HarmonicBond::HarmonicBond(std::shared_ptr<const Topology> topology)
+    : BondedForce(topology, require(topology)->bonds) {}
+
+// ========================================================================== //
+
+double HarmonicBond::compute(Tensor<double, 2>::const_iterator pos,
+                             const Cell& cell, double& virial) {
+  double length, inv_length;
+  periodicity(cell, length, inv_length);
+
+  const std::size_t num_terms = terms_.size();
+  const std::size_t* a = terms_.atoms(0).data();
+  const std::size_t* b = terms_.atoms(1).data();
+  const double* k = terms_.param(0).data();
+  const double* r0 = terms_.param(1).data();
+  double *fax = term_force(0, 0), *fay = term_force(0, 1),
+         *faz = term_force(0, 2);
+  double *fbx = term_force(1, 0), *fby = term_force(1, 1),
+         *fbz = term_force(1, 2);
+
+  double pot = 0, vir = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : pot, vir)
+  for (std::size_t iterm = 0; iterm < num_terms; ++iterm) {
+    double dx = pos[3 * b[iterm]] - pos[3 * a[iterm]];
+    double dy = pos[3 * b[iterm] + 1] - pos[3 * a[iterm] + 1];
+    double dz = pos[3 * b[iterm] + 2] - pos[3 * a[iterm] + 2];
+    dx -= length * std::round(dx * inv_length);
+    dy -= length * std::round(dy * inv_length);
+    dz -= length * std::round(dz * inv_length);
+    double r = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+    double stretch = r - r0[iterm];
+    pot += 0.5 * k[iterm] * stretch * stretch;
+    double pre = k[iterm] * stretch / r;
+    vir -= pre * r * r;
+    fax[iterm] = pre * dx;
+    fay[iterm] = pre * dy;
+    faz[iterm] = pre * dz;
+    fbx[iterm] = -pre * dx;
+    fby[iterm] = -pre * dy;
+    fbz[iterm] = -pre * dz;
+  }
+  virial = vir;
+  return pot;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
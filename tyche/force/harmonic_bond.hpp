@@ -0,0 +1,45 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_HARMONIC_BOND_HPP
+#define __TYCHE_FORCE_HARMONIC_BOND_HPP
+
+// C++ Standard Libraries
+#include <memory>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/topology.hpp"
+#include "tyche/force/bonded_force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Harmonic bond stretching force over the bonds of a topology, with
+ * potential energy
+ *
+ *      V = \frac{1}{2} k (r - r_0)^2
+ */
+class HarmonicBond : public BondedForce<BondedTerms<2, 2>> {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param topology The topology holding the bonds.
+   */
+  HarmonicBond(std::shared_ptr<const Topology> topology);
+
+ protected:
+  /**
+   * @brief Compute the energy and forces of every bond.
+   * @param pos Iterator to the start of the atomic positions.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param virial The virial of the forces.
+   * @return The bond stretching energy.
+   */
+  double compute(Tensor<double, 2>::const_iterator pos, const Cell& cell,
+                 double& virial) override;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_HARMONIC_BOND_HPP */
@@ -0,0 +1,96 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_INTERLEAVED_FORCE_HPP
+#define __TYCHE_FORCE_INTERLEAVED_FORCE_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/interleaved_atomic_state.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Abstract base class for forces evaluated across the replicas of an
+ * interleaved atomic state at once.
+ */
+class InterleavedForce {
+ public:
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~InterleavedForce() = default;
+
+  /**
+   * @brief Evaluate the force on every atom of every replica, adding it to
+   * the forces and virials of the interleaved state.
+   * @param state The interleaved atomic state.
+   * @param pot The potential energy of each replica, which this force's
+   * energy is added to.
+   */
+  virtual void evaluate(InterleavedAtomicState& state, double* pot) = 0;
+};
+
+/**
+ * @brief Wrapper for all interleaved forces required for propagating an
+ * interleaved atomic state.
+ */
+class InterleavedForces {
+ public:
+  /**
+   * @brief Evaluate all forces on every replica.
+   * @param state The interleaved atomic state.
+   * @return The potential energy of each replica.
+   */
+  const std::vector<double>& evaluate(InterleavedAtomicState& state) {
+    const std::size_t num_replicas = state.num_replicas();
+    state.zero_forces();
+    energies_.assign(forces_.size() * num_replicas, 0.0);
+    for (std::size_t iforce = 0; iforce < forces_.size(); ++iforce) {
+      forces_[iforce]->evaluate(state,
+                                energies_.data() + iforce * num_replicas);
+    }
+    pot_.assign(num_replicas, 0.0);
+    for (std::size_t iforce = 0; iforce < forces_.size(); ++iforce) {
+      for (std::size_t r = 0; r < num_replicas; ++r) {
+        pot_[r] += energies_[iforce * num_replicas + r];
+      }
+    }
+    return pot_;
+  }
+
+  /**
+   * @brief Getter for the potential energy of one force in one replica at the
+   * last evaluation.
+   * @param iforce The index of the force, in the order they were added.
+   * @param ireplica The index of the replica.
+   * @return The potential energy.
+   */
+  double energy(std::size_t iforce, std::size_t ireplica) const {
+    return energies_[iforce * pot_.size() + ireplica];
+  }
+
+  /**
+   * @brief Add an interleaved force.
+   * @param force The force.
+   */
+  void add(std::unique_ptr<InterleavedForce> force) {
+    forces_.push_back(std::move(force));
+  }
+
+ private:
+  std::vector<std::unique_ptr<InterleavedForce>> forces_;
+  //< Potential energy of each force, then each replica, at the last evaluation
+  std::vector<double> energies_;
+  //< Potential energy of each replica at the last evaluation
+  std::vector<double> pot_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_INTERLEAVED_FORCE_HPP */
@@ -0,0 +1,261 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_INTERLEAVED_PAIR_POTENTIAL_HPP
+#define __TYCHE_FORCE_INTERLEAVED_PAIR_POTENTIAL_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/atom/interleaved_atomic_state.hpp"
+#include "tyche/force/interleaved_force.hpp"
+
+namespace tyche {
+
+// Forward-declaration of the pair potentials being interleaved
+template <class Derived, std::size_t NumCoeffs>
+class PairPotential;
+
+/**
+ * @brief Pair potential evaluated across the replicas of an interleaved atomic
+ * state, as made by PairPotential::interleave.
+ *
+ * The replicas share one full neighbour list, holding every pair within the
+ * cutoff plus skin in any replica, so that the innermost loop is over replicas
+ * at a fixed pair. Coefficients are interleaved the same way, so that each
+ * replica may take its own, and pairs beyond their cutoff in one replica are
+ * masked out rather than branched on. The systems are small, so the list is
+ * built by direct search over pairs, vectorised in the same way, and rebuilt
+ * once an atom of any replica has moved further than half the skin.
+ *
+ * The virial of each replica is accumulated alongside its forces.
+ * @tparam Derived The potential.
+ * @tparam NumCoeffs The number of coefficients of each pair of atom types.
+ */
+template <class Derived, std::size_t NumCoeffs>
+class InterleavedPairPotential : public InterleavedForce {
+ public:
+  using Coefficients = std::array<double, NumCoeffs>;
+
+  /**
+   * @brief Class constructor.
+   * @param replicas The potential of each replica, in the order of the
+   * replicas, which must share atom types.
+   */
+  explicit InterleavedPairPotential(
+      const std::vector<const PairPotential<Derived, NumCoeffs>*>& replicas)
+      : num_types_(replicas.front()->num_types_),
+        num_replicas_(replicas.size()),
+        coeffs_(num_types_ * num_types_ * NumCoeffs * num_replicas_),
+        cutoff_sq_(num_types_ * num_types_ * num_replicas_),
+        shift_(num_types_ * num_types_ * num_replicas_),
+        cutoff_(0),
+        skin_(0) {
+    for (std::size_t ireplica = 0; ireplica < num_replicas_; ++ireplica) {
+      const auto& potential = *replicas[ireplica];
+      cutoff_ = std::max(cutoff_, potential.cutoff());
+      skin_ = std::max(skin_, potential.neighbours_.skin());
+      for (std::size_t idx = 0; idx < num_types_ * num_types_; ++idx) {
+        for (std::size_t icoeff = 0; icoeff < NumCoeffs; ++icoeff) {
+          coeffs_[(idx * NumCoeffs + icoeff) * num_replicas_ + ireplica] =
+              potential.coeffs_[idx][icoeff];
+        }
+        cutoff_sq_[idx * num_replicas_ + ireplica] = potential.cutoff_sq_[idx];
+        shift_[idx * num_replicas_ + ireplica] = potential.shift_[idx];
+      }
+    }
+  }
+
+  /**
+   * @brief Evaluate the pairwise forces of every replica.
+   * @param state The interleaved atomic state.
+   * @param pot The potential energy of each replica, which this potential's
+   * energy is added to.
+   */
+  void evaluate(InterleavedAtomicState& state, double* pot) override {
+    if (invalidated(state)) build(state);
+
+    const std::size_t num_replicas = num_replicas_;
+    const std::size_t* types = state.atom_type_indices().data();
+    const double *pos = state.pos(), *length = state.length();
+    double* force = state.force();
+    partial_.assign(omp_get_max_threads() * num_replicas, 0.0);
+    partial_virial_.assign(partial_.size(), 0.0);
+
+#pragma omp parallel
+    {
+      double* e = partial_.data() + omp_get_thread_num() * num_replicas;
+      double* w = partial_virial_.data() + omp_get_thread_num() * num_replicas;
+#pragma omp for schedule(dynamic, 8)
+      for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+        const double* xi = pos + 3 * iatom * num_replicas;
+        double* fi = force + 3 * iatom * num_replicas;
+        for (std::size_t n = offsets_[iatom]; n < offsets_[iatom + 1]; ++n) {
+          const std::size_t jatom = neighbours_[n];
+          const double* xj = pos + 3 * jatom * num_replicas;
+          const std::size_t idx = types[iatom] * num_types_ + types[jatom];
+          const double* c = coeffs_.data() + idx * NumCoeffs * num_replicas;
+          const double* cutoff_sq = cutoff_sq_.data() + idx * num_replicas;
+          const double* shift = shift_.data() + idx * num_replicas;
+#pragma omp simd
+          for (std::size_t r = 0; r < num_replicas; ++r) {
+            double dx = xi[r] - xj[r];
+            double dy = xi[num_replicas + r] - xj[num_replicas + r];
+            double dz = xi[2 * num_replicas + r] - xj[2 * num_replicas + r];
+            dx -= std::round(dx / length[r]) * length[r];
+            dy -= std::round(dy / length[r]) * length[r];
+            dz -= std::round(dz / length[r]) * length[r];
+            const double rsq = dx * dx + dy * dy + dz * dz;
+            Coefficients coeffs;
+            for (std::size_t icoeff = 0; icoeff < NumCoeffs; ++icoeff) {
+              coeffs[icoeff] = c[icoeff * num_replicas + r];
+            }
+            const auto term = Derived::energy_force(rsq, coeffs);
+            const bool inside = rsq < cutoff_sq[r];
+            const double f = inside ? term.force : 0;
+            fi[r] += f * dx;
+            fi[num_replicas + r] += f * dy;
+            fi[2 * num_replicas + r] += f * dz;
+            // Each pair is visited twice in a full list
+            e[r] += inside ? 0.5 * (term.energy - shift[r]) : 0;
+            w[r] += 0.5 * f * rsq;
+          }
+        }
+      }
+    }
+
+    double* virial = state.virial();
+    for (std::size_t ithread = 0; ithread < partial_.size() / num_replicas;
+         ++ithread) {
+      for (std::size_t r = 0; r < num_replicas; ++r) {
+        pot[r] += partial_[ithread * num_replicas + r];
+        virial[r] += partial_virial_[ithread * num_replicas + r];
+      }
+    }
+  }
+
+  /**
+   * @brief Getter for the number of times the neighbour list has been built.
+   * @return The number of builds.
+   */
+  std::size_t num_builds() const { return num_builds_; }
+
+ private:
+  std::size_t num_types_, num_replicas_;
+  //< Coefficients of each pair of atom types, then each replica
+  std::vector<double> coeffs_;
+  //< Squared cutoff and energy at the cutoff of each pair of atom types, then
+  //< each replica
+  std::vector<double> cutoff_sq_, shift_;
+  //< Largest cutoff and skin of any replica
+  double cutoff_, skin_;
+  //< Full neighbour list shared by the replicas, with the neighbours of atom
+  //< iatom from offsets_[iatom] up to offsets_[iatom + 1]
+  std::vector<std::size_t> offsets_, neighbours_;
+  //< Interleaved positions and cell lengths at the last build
+  std::vector<double> ref_pos_, ref_length_;
+  std::size_t num_builds_ = 0;
+  //< Potential energy and virial of each replica summed by each thread
+  std::vector<double> partial_, partial_virial_;
+
+  /**
+   * @brief Check whether any atom of any replica has moved further than half
+   * the skin since the last build, or any cell has changed.
+   * @param state The interleaved atomic state.
+   * @return True if the list needs rebuilding.
+   */
+  bool invalidated(const InterleavedAtomicState& state) const {
+    const std::size_t num_replicas = num_replicas_;
+    const std::size_t num_coords = 3 * state.num_atoms() * num_replicas;
+    if (ref_pos_.size() != num_coords) return true;
+    const double* length = state.length();
+    if (!std::equal(length, length + num_replicas, ref_length_.begin())) {
+      return true;
+    }
+
+    const double *pos = state.pos(), *ref = ref_pos_.data();
+    double max_dsq = 0;
+#pragma omp parallel for schedule(static) reduction(max : max_dsq)
+    for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+      const double* x = pos + 3 * iatom * num_replicas;
+      const double* x0 = ref + 3 * iatom * num_replicas;
+#pragma omp simd reduction(max : max_dsq)
+      for (std::size_t r = 0; r < num_replicas; ++r) {
+        double dx = x[r] - x0[r];
+        double dy = x[num_replicas + r] - x0[num_replicas + r];
+        double dz = x[2 * num_replicas + r] - x0[2 * num_replicas + r];
+        dx -= std::round(dx / length[r]) * length[r];
+        dy -= std::round(dy / length[r]) * length[r];
+        dz -= std::round(dz / length[r]) * length[r];
+        max_dsq = std::max(max_dsq, dx * dx + dy * dy + dz * dz);
+      }
+    }
+    return max_dsq > 0.25 * skin_ * skin_;
+  }
+
+  /**
+   * @brief Build the full neighbour list, holding each pair within the cutoff
+   * plus skin in any replica.
+   * @param state The interleaved atomic state.
+   */
+  void build(const InterleavedAtomicState& state) {
+    const std::size_t num_atoms = state.num_atoms();
+    const std::size_t num_replicas = num_replicas_;
+    const double *pos = state.pos(), *length = state.length();
+    const double list_sq = (cutoff_ + skin_) * (cutoff_ + skin_);
+
+    // Pairs against the lower-indexed atom
+    std::vector<std::vector<std::size_t>> half(num_atoms);
+#pragma omp parallel for schedule(dynamic, 8)
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      const double* xi = pos + 3 * iatom * num_replicas;
+      for (std::size_t jatom = iatom + 1; jatom < num_atoms; ++jatom) {
+        const double* xj = pos + 3 * jatom * num_replicas;
+        double min_rsq = std::numeric_limits<double>::max();
+#pragma omp simd reduction(min : min_rsq)
+        for (std::size_t r = 0; r < num_replicas; ++r) {
+          double dx = xi[r] - xj[r];
+          double dy = xi[num_replicas + r] - xj[num_replicas + r];
+          double dz = xi[2 * num_replicas + r] - xj[2 * num_replicas + r];
+          dx -= std::round(dx / length[r]) * length[r];
+          dy -= std::round(dy / length[r]) * length[r];
+          dz -= std::round(dz / length[r]) * length[r];
+          min_rsq = std::min(min_rsq, dx * dx + dy * dy + dz * dz);
+        }
+        if (min_rsq < list_sq) half[iatom].push_back(jatom);
+      }
+    }
+
+    // Store each pair against both atoms
+    std::vector<std::size_t> count(num_atoms + 1, 0);
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      count[iatom + 1] += half[iatom].size();
+      for (std::size_t jatom : half[iatom]) ++count[jatom + 1];
+    }
+    offsets_.resize(num_atoms + 1);
+    std::partial_sum(count.begin(), count.end(), offsets_.begin());
+    neighbours_.resize(offsets_.back());
+    std::vector<std::size_t> next(offsets_.begin(), offsets_.end() - 1);
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      for (std::size_t jatom : half[iatom]) {
+        neighbours_[next[iatom]++] = jatom;
+        neighbours_[next[jatom]++] = iatom;
+      }
+    }
+
+    ref_pos_.assign(pos, pos + 3 * num_atoms * num_replicas);
+    ref_length_.assign(length, length + num_replicas);
+    ++num_builds_;
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_INTERLEAVED_PAIR_POTENTIAL_HPP */
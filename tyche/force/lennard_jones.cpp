@@ -43,7 +43,7 @@ LennardJones::LennardJones(
 // ========================================================================== //
 
 double LennardJones::evaluate(DynamicAtomicState& state, const Cell& cell) {
-  double pot = 0;
+  double pot = 0, virial = 0;
 
   Tensor<double, 2>::const_iterator iatom_pos = state.pos();
   Tensor<double, 2>::iterator iatom_force = state.force();
@@ -79,6 +79,7 @@ double LennardJones::evaluate(DynamicAtomicState& state, const Cell& cell) {
       pot += 4 * eps * (A - B);
 
       double f_tmp = (24 * eps / rsq) * (2 * A - B);
+      virial += f_tmp * rsq;
       double fx = f_tmp * dx, fy = f_tmp * dy, fz = f_tmp * dz;
 
       iatom_force[0] -= fx;
@@ -92,6 +93,7 @@ double LennardJones::evaluate(DynamicAtomicState& state, const Cell& cell) {
     iatom_pos += 3;
     iatom_force += 3;
   }
+  state.add_virial(virial);
   return pot;
 }
 
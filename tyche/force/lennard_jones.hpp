@@ -28,7 +28,8 @@ class LennardJones : public Force {
 
   /**
    * @brief Evaluate all pairwise forces arising from the Lennard-Jones
-   * potential between atoms in an atomic state.
+   * potential between atoms in an atomic state. The virial is accumulated in
+   * the same loop.
    * @param state The atomic state we're computing the forces for.
    * @return The Lennard-Jones potential.
    */
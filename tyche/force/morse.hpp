@@ -0,0 +1,67 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_MORSE_HPP
+#define __TYCHE_FORCE_MORSE_HPP
+
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/pair_potential.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Morse potential, U = D [\exp(-2 \alpha (r - r_0)) -
+ * 2 \exp(-\alpha (r - r_0))], with a well of depth D at r_0.
+ *
+ * Parameters are read from the atom types as D_morse, alpha_morse and
+ * r0_morse. D is mixed geometrically, and \alpha and r_0 arithmetically.
+ */
+class Morse : public PairPotential<Morse, 3> {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param cutoff The interaction cutoff distance.
+   * @param skin Neighbour list skin distance.
+   */
+  Morse(const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+        double cutoff, double skin)
+      : PairPotential(atom_types, cutoff, skin) {}
+
+  /**
+   * @brief Mix the parameters of two atom types.
+   * @param itype An atom type.
+   * @param jtype An atom type.
+   * @return D, \alpha and r_0 of the pair.
+   */
+  static Coefficients mix(AtomType& itype, AtomType& jtype) {
+    return {std::sqrt(itype.get<double>("D_morse") *
+                      jtype.get<double>("D_morse")),
+            (itype.get<double>("alpha_morse") +
+             jtype.get<double>("alpha_morse")) /
+                2,
+            (itype.get<double>("r0_morse") + jtype.get<double>("r0_morse")) /
+                2};
+  }
+
+  /**
+   * @brief Evaluate the potential for a pair of atoms.
+   * @param rsq The squared separation of the atoms.
+   * @param coeffs The coefficients of the pair.
+   * @return The energy, and force divided by the separation.
+   */
+  static PairTerm energy_force(double rsq, const Coefficients& coeffs) {
+    const auto [d, alpha, r0] = coeffs;
+    double r = std::sqrt(rsq);
+    double e = std::exp(-alpha * (r - r0));
+    return {d * e * (e - 2), 2 * alpha * d * e * (e - 1) / r};
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_MORSE_HPP */
@@ -0,0 +1,429 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/gemm.hpp"
+#include "tyche/util/tensor.hpp"
+#include "tyche/force/neural_network.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+NeuralNetwork::NeuralNetwork(
+    const NeuralNetworkModel& model,
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+    double skin)
+    : num_types_(atom_types.size()),
+      num_elements_(model.elements.size()),
+      cutoff_(model.cutoff),
+      model_(model),
+      element_(num_types_),
+      radial_(num_types_ * num_elements_),
+      angular_(num_types_ * num_elements_ * num_elements_),
+      batches_(num_types_),
+      neighbours_(model.cutoff, skin, true) {
+  // Find which element in the model each atom type corresponds to
+  for (const auto& [atom_type, itype] : atom_types) {
+    auto it = std::find_if(
+        model.elements.begin(), model.elements.end(),
+        [&](const auto& element) { return element.id == atom_type->id(); });
+    if (it == model.elements.end())
+      throw std::runtime_error("No neural network for atom type " +
+                               atom_type->id());
+    element_[itype] = std::distance(model.elements.begin(), it);
+  }
+
+  // Group the symmetry functions of each atom type by neighbour element(s)
+  for (std::size_t itype = 0; itype < num_types_; ++itype) {
+    const auto& element = model_.elements[element_[itype]];
+    for (std::size_t ifunc = 0; ifunc < element.radial.size(); ++ifunc) {
+      const auto& radial = element.radial[ifunc];
+      auto& functions = radial_[itype * num_elements_ + radial.element];
+      functions.column.push_back(ifunc);
+      functions.eta.push_back(radial.eta);
+      functions.r_s.push_back(radial.r_s);
+    }
+    for (std::size_t ifunc = 0; ifunc < element.angular.size(); ++ifunc) {
+      const auto& angular = element.angular[ifunc];
+      std::size_t jelem = std::min(angular.element_j, angular.element_k);
+      std::size_t kelem = std::max(angular.element_j, angular.element_k);
+      auto& functions =
+          angular_[(itype * num_elements_ + jelem) * num_elements_ + kelem];
+      functions.column.push_back(element.radial.size() + ifunc);
+      functions.eta.push_back(angular.eta);
+      functions.zeta.push_back(angular.zeta);
+      functions.lambda.push_back(angular.lambda);
+      functions.prefactor.push_back(std::pow(2, 1 - angular.zeta));
+    }
+  }
+}
+
+// ========================================================================== //
+
+double NeuralNetwork::evaluate(DynamicAtomicState& state, const Cell& cell) {
+  neighbours_.update(state, cell);
+  short_lists_.resize(omp_get_max_threads());
+
+  // Batch the atoms by type
+  const auto& types = state.atom_type_indices();
+  row_.resize(state.num_atoms());
+  for (auto& batch : batches_) batch.atoms.clear();
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    auto& batch = batches_[types[iatom]];
+    row_[iatom] = batch.atoms.size();
+    batch.atoms.push_back(iatom);
+  }
+  for (std::size_t itype = 0; itype < num_types_; ++itype) {
+    std::size_t size = batches_[itype].atoms.size() *
+                       model_.elements[element_[itype]].num_descriptors();
+    batches_[itype].descriptors.resize(size);
+    batches_[itype].gradient.resize(size);
+  }
+
+  // Symmetry functions
+#pragma omp parallel
+  {
+    auto& short_list = short_lists_[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 32)
+    for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+      const std::size_t itype = types[iatom];
+      const std::size_t num_descriptors =
+          model_.elements[element_[itype]].num_descriptors();
+      gather(iatom, state, cell, short_list);
+      describe(itype, short_list,
+               batches_[itype].descriptors.data() +
+                   row_[iatom] * num_descriptors);
+    }
+  }
+
+  // Networks, batched over all atoms of each type
+  double pot = 0;
+  for (std::size_t itype = 0; itype < num_types_; ++itype) {
+    if (!batches_[itype].atoms.empty()) pot += infer(itype);
+  }
+
+  // Forces
+  double virial = 0;
+  buffer_.zero(state.num_atoms());
+#pragma omp parallel reduction(+ : virial)
+  {
+    auto& short_list = short_lists_[omp_get_thread_num()];
+    auto force = buffer_.local();
+#pragma omp for schedule(dynamic, 32)
+    for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+      const std::size_t itype = types[iatom];
+      const std::size_t num_descriptors =
+          model_.elements[element_[itype]].num_descriptors();
+      gather(iatom, state, cell, short_list);
+      virial += backpropagate(
+          iatom, itype, short_list,
+          batches_[itype].gradient.data() + row_[iatom] * num_descriptors,
+          force);
+    }
+  }
+  buffer_.reduce(state.force());
+  state.add_virial(virial);
+  return pot;
+}
+
+// ========================================================================== //
+
+void NeuralNetwork::gather(std::size_t iatom, const DynamicAtomicState& state,
+                           const Cell& cell,
+                           std::vector<Neighbour>& short_list) const {
+  const auto& types = state.atom_type_indices();
+  Tensor<double, 2>::const_iterator pos = state.pos();
+  const double k = std::numbers::pi / cutoff_;
+  short_list.clear();
+  for (std::size_t jatom : neighbours_.neighbours(iatom)) {
+    double dx = pos[3 * jatom] - pos[3 * iatom];
+    double dy = pos[3 * jatom + 1] - pos[3 * iatom + 1];
+    double dz = pos[3 * jatom + 2] - pos[3 * iatom + 2];
+    cell.min_image(dx, dy, dz);
+    double rsq = dx * dx + dy * dy + dz * dz;
+    if (rsq >= cutoff_ * cutoff_) continue;
+    double r = std::sqrt(rsq), inv_r = 1 / r;
+    short_list.push_back({jatom, element_[types[jatom]], r, dx * inv_r,
+                          dy * inv_r, dz * inv_r,
+                          0.5 * (std::cos(k * r) + 1),
+                          -0.5 * k * std::sin(k * r)});
+  }
+}
+
+// ========================================================================== //
+
+void NeuralNetwork::describe(std::size_t itype,
+                             const std::vector<Neighbour>& short_list,
+                             double* descriptors) const {
+  const std::size_t num_descriptors =
+      model_.elements[element_[itype]].num_descriptors();
+  std::fill(descriptors, descriptors + num_descriptors, 0.0);
+  const double k = std::numbers::pi / cutoff_;
+
+  for (const auto& j : short_list) {
+    const auto& functions = radial_[itype * num_elements_ + j.element];
+    const std::size_t* column = functions.column.data();
+    const double *eta = functions.eta.data(), *r_s = functions.r_s.data();
+    // Each function has its own column, so there are no conflicting writes
+#pragma omp simd
+    for (std::size_t q = 0; q < functions.column.size(); ++q) {
+      double dr = j.r - r_s[q];
+      descriptors[column[q]] += std::exp(-eta[q] * dr * dr) * j.fc;
+    }
+  }
+
+  for (std::size_t jdx = 0; jdx < short_list.size(); ++jdx) {
+    const auto& j = short_list[jdx];
+    for (std::size_t kdx = jdx + 1; kdx < short_list.size(); ++kdx) {
+      const auto& l = short_list[kdx];
+      const auto& functions =
+          angular_[(itype * num_elements_ + std::min(j.element, l.element)) *
+                       num_elements_ +
+                   std::max(j.element, l.element)];
+      if (functions.column.empty()) continue;
+
+      double cx = l.r * l.ux - j.r * j.ux, cy = l.r * l.uy - j.r * j.uy,
+             cz = l.r * l.uz - j.r * j.uz;
+      double rc_sq = cx * cx + cy * cy + cz * cz;
+      if (rc_sq >= cutoff_ * cutoff_) continue;
+      double fc_jk = 0.5 * (std::cos(k * std::sqrt(rc_sq)) + 1);
+      double cos_theta = j.ux * l.ux + j.uy * l.uy + j.uz * l.uz;
+      double r_sq = j.r * j.r + l.r * l.r + rc_sq;
+      double fc = j.fc * l.fc * fc_jk;
+
+      const std::size_t* column = functions.column.data();
+      const double *eta = functions.eta.data(), *zeta = functions.zeta.data(),
+                   *lambda = functions.lambda.data(),
+                   *prefactor = functions.prefactor.data();
+#pragma omp simd
+      for (std::size_t q = 0; q < functions.column.size(); ++q) {
+        double p = 1 + lambda[q] * cos_theta;
+        descriptors[column[q]] += prefactor[q] * std::pow(p, zeta[q]) *
+                                  std::exp(-eta[q] * r_sq) * fc;
+      }
+    }
+  }
+}
+
+// ========================================================================== //
+
+double NeuralNetwork::infer(std::size_t itype) {
+  using Activation = NeuralNetworkModel::Activation;
+  const auto& element = model_.elements[element_[itype]];
+  auto& batch = batches_[itype];
+  const std::size_t num_atoms = batch.atoms.size();
+  const std::size_t num_descriptors = element.num_descriptors();
+  const std::size_t num_layers = element.layers.size();
+  batch.outputs.resize(num_layers);
+  batch.derivatives.resize(num_layers);
+
+  // Normalise the descriptors into the input of the first layer, which is
+  // kept in the gradient buffer until the backward pass overwrites it
+  std::vector<double>& input = batch.gradient;
+#pragma omp parallel for schedule(static)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    const double* g = batch.descriptors.data() + iatom * num_descriptors;
+    double* x = input.data() + iatom * num_descriptors;
+#pragma omp simd
+    for (std::size_t q = 0; q < num_descriptors; ++q) {
+      x[q] = (g[q] - element.shift[q]) * element.scale[q];
+    }
+  }
+
+  // Forward pass
+  const double* in = input.data();
+  for (std::size_t ilayer = 0; ilayer < num_layers; ++ilayer) {
+    const auto& layer = element.layers[ilayer];
+    auto& out = batch.outputs[ilayer];
+    auto& deriv = batch.derivatives[ilayer];
+    out.resize(num_atoms * layer.num_out);
+    deriv.resize(num_atoms * layer.num_out);
+    gemm(num_atoms, layer.num_out, layer.num_in, in, layer.weights.data(),
+         out.data());
+
+    const double* bias = layer.bias.data();
+    const std::size_t width = layer.num_out;
+#pragma omp parallel for schedule(static)
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      double* z = out.data() + iatom * width;
+      double* d = deriv.data() + iatom * width;
+      switch (layer.activation) {
+        case Activation::linear:
+#pragma omp simd
+          for (std::size_t q = 0; q < width; ++q) {
+            z[q] += bias[q];
+            d[q] = 1;
+          }
+          break;
+        case Activation::tanh:
+#pragma omp simd
+          for (std::size_t q = 0; q < width; ++q) {
+            z[q] = std::tanh(z[q] + bias[q]);
+            d[q] = 1 - z[q] * z[q];
+          }
+          break;
+        case Activation::softplus:
+#pragma omp simd
+          for (std::size_t q = 0; q < width; ++q) {
+            double x = z[q] + bias[q];
+            z[q] = std::max(x, 0.0) + std::log1p(std::exp(-std::abs(x)));
+            d[q] = 1 / (1 + std::exp(-x));
+          }
+          break;
+      }
+    }
+    in = out.data();
+  }
+
+  double pot = 0;
+  const auto& energies = batch.outputs.back();
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    pot += energies[iatom];
+  }
+
+  // Backward pass, starting from dE/dE_i = 1 at the output
+  batch.delta.assign(batch.derivatives.back().begin(),
+                     batch.derivatives.back().end());
+  for (std::size_t ilayer = num_layers; ilayer-- > 0;) {
+    const auto& layer = element.layers[ilayer];
+    if (ilayer == 0) {
+      gemm_nt(num_atoms, layer.num_in, layer.num_out, batch.delta.data(),
+              layer.weights.data(), batch.gradient.data());
+      break;
+    }
+    batch.delta_prev.resize(num_atoms * layer.num_in);
+    gemm_nt(num_atoms, layer.num_in, layer.num_out, batch.delta.data(),
+            layer.weights.data(), batch.delta_prev.data());
+    const auto& deriv = batch.derivatives[ilayer - 1];
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t idx = 0; idx < batch.delta_prev.size(); ++idx) {
+      batch.delta_prev[idx] *= deriv[idx];
+    }
+    std::swap(batch.delta, batch.delta_prev);
+  }
+
+  // Chain through the normalisation of the descriptors
+#pragma omp parallel for schedule(static)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    double* g = batch.gradient.data() + iatom * num_descriptors;
+#pragma omp simd
+    for (std::size_t q = 0; q < num_descriptors; ++q) {
+      g[q] *= element.scale[q];
+    }
+  }
+  return pot;
+}
+
+// ========================================================================== //
+
+double NeuralNetwork::backpropagate(std::size_t iatom, std::size_t itype,
+                                    const std::vector<Neighbour>& short_list,
+                                    const double* gradient,
+                                    std::vector<double>::iterator force) const {
+  const double k = std::numbers::pi / cutoff_;
+  double fx = 0, fy = 0, fz = 0, virial = 0;
+
+  for (const auto& j : short_list) {
+    const auto& functions = radial_[itype * num_elements_ + j.element];
+    const std::size_t* column = functions.column.data();
+    const double *eta = functions.eta.data(), *r_s = functions.r_s.data();
+    double de_dr = 0;
+#pragma omp simd reduction(+ : de_dr)
+    for (std::size_t q = 0; q < functions.column.size(); ++q) {
+      double dr = j.r - r_s[q];
+      double e = std::exp(-eta[q] * dr * dr);
+      de_dr += gradient[column[q]] * e * (j.dfc - 2 * eta[q] * dr * j.fc);
+    }
+    virial -= de_dr * j.r;
+    force[3 * j.idx] -= de_dr * j.ux;
+    force[3 * j.idx + 1] -= de_dr * j.uy;
+    force[3 * j.idx + 2] -= de_dr * j.uz;
+    fx += de_dr * j.ux;
+    fy += de_dr * j.uy;
+    fz += de_dr * j.uz;
+  }
+
+  for (std::size_t jdx = 0; jdx < short_list.size(); ++jdx) {
+    const auto& j = short_list[jdx];
+    for (std::size_t kdx = jdx + 1; kdx < short_list.size(); ++kdx) {
+      const auto& l = short_list[kdx];
+      const auto& functions =
+          angular_[(itype * num_elements_ + std::min(j.element, l.element)) *
+                       num_elements_ +
+                   std::max(j.element, l.element)];
+      if (functions.column.empty()) continue;
+
+      // Vector from the first to the second neighbour
+      double cx = l.r * l.ux - j.r * j.ux, cy = l.r * l.uy - j.r * j.uy,
+             cz = l.r * l.uz - j.r * j.uz;
+      double rc_sq = cx * cx + cy * cy + cz * cz;
+      if (rc_sq >= cutoff_ * cutoff_) continue;
+      double rc = std::sqrt(rc_sq), inv_rc = 1 / rc;
+      double fc_jk = 0.5 * (std::cos(k * rc) + 1);
+      double dfc_jk = -0.5 * k * std::sin(k * rc);
+      double cos_theta = j.ux * l.ux + j.uy * l.uy + j.uz * l.uz;
+      double r_sq = j.r * j.r + l.r * l.r + rc_sq;
+      double fc = j.fc * l.fc * fc_jk;
+
+      // Derivatives of the energy with respect to the three distances and the
+      // angle, summed over functions
+      double de_dj = 0, de_dl = 0, de_dc = 0, de_dcos = 0;
+      const std::size_t* column = functions.column.data();
+      const double *eta = functions.eta.data(), *zeta = functions.zeta.data(),
+                   *lambda = functions.lambda.data(),
+                   *prefactor = functions.prefactor.data();
+#pragma omp simd reduction(+ : de_dj, de_dl, de_dc, de_dcos)
+      for (std::size_t q = 0; q < functions.column.size(); ++q) {
+        double p = 1 + lambda[q] * cos_theta;
+        double p_zeta1 = std::pow(p, zeta[q] - 1);
+        double a = gradient[column[q]] * prefactor[q] *
+                   std::exp(-eta[q] * r_sq);
+        double t = a * p_zeta1 * p;
+        de_dcos += a * zeta[q] * lambda[q] * p_zeta1 * fc;
+        de_dj += t * (j.dfc * l.fc * fc_jk - 2 * eta[q] * j.r * fc);
+        de_dl += t * (j.fc * l.dfc * fc_jk - 2 * eta[q] * l.r * fc);
+        de_dc += t * (j.fc * l.fc * dfc_jk - 2 * eta[q] * rc * fc);
+      }
+
+      // Gradient of the energy with respect to the position of each neighbour;
+      // the central atom takes the opposite of their sum
+      double cj = de_dcos / j.r, cl = de_dcos / l.r, cc = de_dc * inv_rc;
+      double gjx = de_dj * j.ux + cj * (l.ux - cos_theta * j.ux) - cc * cx;
+      double gjy = de_dj * j.uy + cj * (l.uy - cos_theta * j.uy) - cc * cy;
+      double gjz = de_dj * j.uz + cj * (l.uz - cos_theta * j.uz) - cc * cz;
+      double glx = de_dl * l.ux + cl * (j.ux - cos_theta * l.ux) + cc * cx;
+      double gly = de_dl * l.uy + cl * (j.uy - cos_theta * l.uy) + cc * cy;
+      double glz = de_dl * l.uz + cl * (j.uz - cos_theta * l.uz) + cc * cz;
+      // Relative to the central atom, as the forces sum to zero
+      virial -= j.r * (j.ux * gjx + j.uy * gjy + j.uz * gjz) +
+                l.r * (l.ux * glx + l.uy * gly + l.uz * glz);
+
+      force[3 * j.idx] -= gjx;
+      force[3 * j.idx + 1] -= gjy;
+      force[3 * j.idx + 2] -= gjz;
+      force[3 * l.idx] -= glx;
+      force[3 * l.idx + 1] -= gly;
+      force[3 * l.idx + 2] -= glz;
+      fx += gjx + glx;
+      fy += gjy + gly;
+      fz += gjz + glz;
+    }
+  }
+
+  force[3 * iatom] += fx;
+  force[3 * iatom + 1] += fy;
+  force[3 * iatom + 2] += fz;
+  return virial;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
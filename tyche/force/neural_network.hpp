@@ -0,0 +1,164 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_NEURAL_NETWORK_HPP
+#define __TYCHE_FORCE_NEURAL_NETWORK_HPP
+
+// C++ Standard Libraries
+#include <map>
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/force/thread_force_buffer.hpp"
+#include "tyche/force/neural_network_reader.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Behler-Parrinello neural network potential (Behler and Parrinello,
+ * Phys. Rev. Lett. 98, 146401 (2007)), where the energy is a sum of atomic
+ * energies, each the output of a feed-forward network of the atom's element
+ * applied to radial and angular symmetry functions of its neighbourhood.
+ *
+ * Evaluation is in three stages:
+ *   1. Symmetry functions of each atom, threaded over atoms and vectorised
+ *      over the functions of each neighbour element, or pair of elements.
+ *   2. Forward and backward passes of the network of each element, as matrix
+ *      multiplies over all atoms of that element at once, which gives the
+ *      derivative of the energy with respect to every symmetry function.
+ *   3. Forces, by chaining those derivatives through the symmetry functions,
+ *      which are recomputed rather than stored to keep memory at O(N).
+ * Stages 1 and 3 enumerate neighbours from a full list; stage 3 pushes force
+ * onto neighbours through per-thread buffers.
+ */
+class NeuralNetwork : public Force {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param model The symmetry functions and networks; must contain an element
+   * whose identifier matches each atom type.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param skin Neighbour list skin distance.
+   */
+  NeuralNetwork(
+      const NeuralNetworkModel& model,
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+      double skin);
+
+  /**
+   * @brief Evaluate the energy and forces of the neural network potential.
+   * The virial is accumulated alongside the forces.
+   * @param state The atomic state we're computing the forces for.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The neural network potential.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override;
+
+ protected:
+  /**
+   * @brief Neighbour of a central atom within the cutoff.
+   */
+  struct Neighbour {
+    //< Index and model element of the neighbouring atom
+    std::size_t idx, element;
+    //< Distance, unit vector from the central atom to the neighbour, and the
+    //< cutoff function and its derivative
+    double r, ux, uy, uz, fc, dfc;
+  };
+
+  /**
+   * @brief Symmetry functions of a central element over one neighbour element,
+   * or one pair of neighbour elements, stored contiguously for vectorisation.
+   */
+  struct Functions {
+    //< Column of each function in the descriptors
+    std::vector<std::size_t> column;
+    //< Radial parameters, and angular parameters along with 2^{1-\zeta}
+    std::vector<double> eta, r_s, zeta, lambda, prefactor;
+  };
+
+  /**
+   * @brief Batch of all atoms of one atom type, and the network buffers of
+   * that batch, which persist between evaluations.
+   */
+  struct Batch {
+    std::vector<std::size_t> atoms;
+    //< Row-major symmetry functions of each atom, and the derivative of the
+    //< energy with respect to each
+    std::vector<double> descriptors, gradient;
+    //< Output of each layer, and the derivative of its activation
+    std::vector<std::vector<double>> outputs, derivatives;
+    //< Derivative of the energy with respect to the pre-activations of the
+    //< current layer during the backward pass, and of the layer before
+    std::vector<double> delta, delta_prev;
+  };
+
+  std::size_t num_types_, num_elements_;
+  double cutoff_;
+  NeuralNetworkModel model_;
+  //< Model element of each atom type
+  std::vector<std::size_t> element_;
+  //< Radial functions of each atom type, indexed by (type * num_elements_ +
+  //< neighbour element), and angular functions indexed by (type *
+  //< num_elements_^2 + element_j * num_elements_ + element_k) with
+  //< element_j <= element_k
+  std::vector<Functions> radial_, angular_;
+  //< Row of each atom within the batch of its type
+  std::vector<std::size_t> row_;
+  std::vector<Batch> batches_;
+  NeighbourList neighbours_;
+  ThreadForceBuffer buffer_;
+  std::vector<std::vector<Neighbour>> short_lists_;
+
+  /**
+   * @brief Gather the neighbours of an atom within the cutoff.
+   * @param iatom The central atom.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param short_list The list to fill.
+   */
+  void gather(std::size_t iatom, const DynamicAtomicState& state,
+              const Cell& cell, std::vector<Neighbour>& short_list) const;
+
+  /**
+   * @brief Compute the symmetry functions of an atom.
+   * @param itype The atom type of the central atom.
+   * @param short_list The neighbours of the central atom.
+   * @param descriptors The symmetry functions, which are overwritten.
+   */
+  void describe(std::size_t itype, const std::vector<Neighbour>& short_list,
+                double* descriptors) const;
+
+  /**
+   * @brief Run the network of an atom type over its batch, and back-propagate
+   * to find the derivative of the energy with respect to every descriptor.
+   * @param itype The atom type.
+   * @return The sum of the atomic energies of the batch.
+   */
+  double infer(std::size_t itype);
+
+  /**
+   * @brief Chain the derivatives of the energy with respect to the symmetry
+   * functions of an atom through to the forces on it and its neighbours.
+   * @param iatom The central atom.
+   * @param itype The atom type of the central atom.
+   * @param short_list The neighbours of the central atom.
+   * @param gradient The derivative of the energy with respect to each
+   * symmetry function.
+   * @param force The forces to accumulate to.
+   * @return The contribution to the virial of the forces.
+   */
+  double backpropagate(std::size_t iatom, std::size_t itype,
+                       const std::vector<Neighbour>& short_list,
+                       const double* gradient,
+                       std::vector<double>::iterator force) const;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_NEURAL_NETWORK_HPP */
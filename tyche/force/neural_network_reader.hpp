@@ -0,0 +1,251 @@
+/**
+ * @brief Reader for Behler-Parrinello neural network potentials.
+ */
+#ifndef __TYCHE_FORCE_NEURAL_NETWORK_READER_HPP
+#define __TYCHE_FORCE_NEURAL_NETWORK_READER_HPP
+
+// C++ Standard Libraries
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <filesystem>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/io/reader.hpp"
+#include "tyche/util/constants.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Symmetry functions and feed-forward networks defining a
+ * Behler-Parrinello neural network potential for some set of elements.
+ * Energies are in internal units, distances in Angstrom.
+ */
+struct NeuralNetworkModel {
+  /**
+   * @brief Activation function applied to the output of a layer.
+   */
+  enum class Activation : std::uint32_t { linear = 0, tanh = 1, softplus = 2 };
+
+  /**
+   * @brief Fully-connected layer, out = act(in W + b).
+   */
+  struct Layer {
+    std::size_t num_in, num_out;
+    Activation activation;
+    //< Row-major num_in x num_out weights, and num_out biases
+    std::vector<double> weights, bias;
+  };
+
+  /**
+   * @brief Radial symmetry function,
+   * G = \sum_j \exp(-\eta (r_ij - r_s)^2) f_c(r_ij),
+   * over neighbours j of one element.
+   */
+  struct Radial {
+    std::size_t element;
+    double eta, r_s;
+  };
+
+  /**
+   * @brief Angular symmetry function,
+   * G = 2^{1-\zeta} \sum_{j<k} (1 + \lambda \cos\theta_{jik})^\zeta
+   *     \exp(-\eta (r_ij^2 + r_ik^2 + r_jk^2)) f_c(r_ij) f_c(r_ik) f_c(r_jk),
+   * over pairs of neighbours j and k of a pair of elements, in either order.
+   */
+  struct Angular {
+    std::size_t element_j, element_k;
+    double eta, zeta, lambda;
+  };
+
+  /**
+   * @brief Descriptors and network of a central element. Descriptors are
+   * the radial functions followed by the angular functions, and are
+   * normalised as (G - shift) * scale before entering the network.
+   */
+  struct Element {
+    std::string id;
+    std::vector<Radial> radial;
+    std::vector<Angular> angular;
+    std::vector<double> shift, scale;
+    std::vector<Layer> layers;
+
+    /**
+     * @brief Getter for the number of descriptors of the element.
+     * @return The number of descriptors.
+     */
+    std::size_t num_descriptors() const {
+      return radial.size() + angular.size();
+    }
+  };
+
+  //< Cutoff radius of the cosine cutoff function
+  //< f_c(r) = (\cos(\pi r / r_c) + 1) / 2
+  double cutoff;
+  std::vector<Element> elements;
+};
+
+/**
+ * @brief Reader for neural network potentials in a simple little-endian binary
+ * format, where strings are a uint32 length followed by their characters:
+ *
+ *      char[8] "TYCHENNP", uint32 version = 1
+ *      double cutoff, uint32 num_elements
+ *      for each element:
+ *        string id
+ *        uint32 num_radial, then (uint32 element, double eta, double r_s)
+ *        uint32 num_angular, then (uint32 element_j, uint32 element_k,
+ *                                  double eta, double zeta, double lambda)
+ *        double shift[num_descriptors], double scale[num_descriptors]
+ *        uint32 num_layers, then (uint32 num_in, uint32 num_out,
+ *                                 uint32 activation,
+ *                                 double weights[num_in * num_out],
+ *                                 double bias[num_out])
+ *
+ * Elements of symmetry functions are indices into the element list. The
+ * network of each element must map its descriptors to a single energy, which
+ * is assumed to be in eV.
+ */
+class NeuralNetworkReader : public Reader {
+ public:
+  /**
+   * @brief Class constructor.
+   */
+  NeuralNetworkReader() {}
+
+  /**
+   * @brief Parse the model from a binary file.
+   * @param path The path to the file.
+   * @return The model.
+   */
+  NeuralNetworkModel parse(std::filesystem::path path) {
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs)
+      throw std::runtime_error("Couldn't open neural network potential file: " +
+                               path.string());
+    spdlog::info("Reading neural network potential from: {}", path.string());
+
+    std::string magic(8, ' ');
+    ifs.read(magic.data(), magic.size());
+    if (magic != "TYCHENNP" || read<std::uint32_t>(ifs) != 1)
+      throw std::runtime_error("Not a neural network potential file: " +
+                               path.string());
+
+    NeuralNetworkModel model;
+    model.cutoff = read<double>(ifs);
+    model.elements.resize(read<std::uint32_t>(ifs));
+    for (auto& element : model.elements) {
+      element.id = std::string(read<std::uint32_t>(ifs), ' ');
+      ifs.read(element.id.data(), element.id.size());
+
+      element.radial.resize(read<std::uint32_t>(ifs));
+      for (auto& radial : element.radial) {
+        radial.element = read<std::uint32_t>(ifs);
+        radial.eta = read<double>(ifs);
+        radial.r_s = read<double>(ifs);
+      }
+      element.angular.resize(read<std::uint32_t>(ifs));
+      for (auto& angular : element.angular) {
+        angular.element_j = read<std::uint32_t>(ifs);
+        angular.element_k = read<std::uint32_t>(ifs);
+        angular.eta = read<double>(ifs);
+        angular.zeta = read<double>(ifs);
+        angular.lambda = read<double>(ifs);
+      }
+      element.shift = read_values(ifs, element.num_descriptors());
+      element.scale = read_values(ifs, element.num_descriptors());
+
+      element.layers.resize(read<std::uint32_t>(ifs));
+      for (auto& layer : element.layers) {
+        layer.num_in = read<std::uint32_t>(ifs);
+        layer.num_out = read<std::uint32_t>(ifs);
+        layer.activation = static_cast<NeuralNetworkModel::Activation>(
+            read<std::uint32_t>(ifs));
+        layer.weights = read_values(ifs, layer.num_in * layer.num_out);
+        layer.bias = read_values(ifs, layer.num_out);
+      }
+      validate(model, element, path);
+
+      // Energies are in eV, and the output layer is linear in them
+      auto& output = element.layers.back();
+      for (auto& weight : output.weights) weight *= constants::ev_to_internal;
+      for (auto& bias : output.bias) bias *= constants::ev_to_internal;
+    }
+
+    if (!ifs)
+      throw std::runtime_error("Malformed neural network potential file: " +
+                               path.string());
+    return model;
+  }
+
+ private:
+  /**
+   * @brief Read a single value from the stream.
+   * @tparam T The type of the value.
+   * @param ifs The stream to read from.
+   * @return The value read.
+   */
+  template <class T>
+  T read(std::ifstream& ifs) {
+    T value{};
+    ifs.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+
+  /**
+   * @brief Read some number of doubles from the stream.
+   * @param ifs The stream to read from.
+   * @param num_values The number of values to read.
+   * @return The values read.
+   */
+  std::vector<double> read_values(std::ifstream& ifs, std::size_t num_values) {
+    std::vector<double> values(num_values);
+    ifs.read(reinterpret_cast<char*>(values.data()),
+             num_values * sizeof(double));
+    return values;
+  }
+
+  /**
+   * @brief Make sure the symmetry functions and layers of an element are
+   * consistent with each other.
+   * @param model The model the element belongs to.
+   * @param element The element.
+   * @param path The path to the file, for error messages.
+   */
+  void validate(const NeuralNetworkModel& model,
+                const NeuralNetworkModel::Element& element,
+                const std::filesystem::path& path) {
+    auto malformed = [&](std::string what) {
+      return std::runtime_error("Malformed neural network potential file " +
+                                path.string() + ": " + what + " of element " +
+                                element.id + ".");
+    };
+    std::size_t num_elements = model.elements.size();
+    for (const auto& radial : element.radial) {
+      if (radial.element >= num_elements) throw malformed("radial function");
+    }
+    for (const auto& angular : element.angular) {
+      if (angular.element_j >= num_elements ||
+          angular.element_k >= num_elements)
+        throw malformed("angular function");
+    }
+    if (element.layers.empty()) throw malformed("no layers");
+    std::size_t num_in = element.num_descriptors();
+    for (const auto& layer : element.layers) {
+      if (layer.num_in != num_in ||
+          layer.activation > NeuralNetworkModel::Activation::softplus)
+        throw malformed("inconsistent layer");
+      num_in = layer.num_out;
+    }
+    if (num_in != 1 || element.layers.back().activation !=
+                           NeuralNetworkModel::Activation::linear)
+      throw malformed("output layer");
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_NEURAL_NETWORK_READER_HPP */
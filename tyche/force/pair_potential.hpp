@@ -0,0 +1,336 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_PAIR_POTENTIAL_HPP
+#define __TYCHE_FORCE_PAIR_POTENTIAL_HPP
+
+// C++ Standard Libraries
+#include <map>
+#include <span>
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/force/interleaved_pair_potential.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Energy of a pair of atoms and the magnitude of their force divided by
+ * their separation, f = -(dU/dr) / r, so that the force on atom i from atom j
+ * is f (r_i - r_j).
+ */
+struct PairTerm {
+  double energy, force;
+};
+
+/**
+ * @brief Interface of forces whose potential energy is a sum over pairs of
+ * atoms within a cutoff, so that the change in energy from moving one atom
+ * follows from its neighbours alone, e.g. for Monte Carlo moves.
+ */
+class PairwiseForce : public Force {
+ public:
+  /**
+   * @brief Getter for the largest cutoff of any pair of atom types.
+   * @return The cutoff.
+   */
+  virtual double cutoff() const = 0;
+
+  /**
+   * @brief Compute the energies of the pairs between one atom, placed at some
+   * position, and some other atoms, each added to a running total.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param iatom The index of the atom.
+   * @param pos The position to place the atom at.
+   * @param atoms The indices of the other atoms, which mustn't include iatom.
+   * @param energies Running total of the energy of each pair, in the order of
+   * the atoms, which this force's energy of the pair is added to.
+   * @return The sum of this force's energies of the pairs.
+   */
+  virtual double pair_energies(const DynamicAtomicState& state,
+                               const Cell& cell, std::size_t iatom,
+                               const std::array<double, 3>& pos,
+                               std::span<const std::size_t> atoms,
+                               double* energies) const = 0;
+};
+
+/**
+ * @brief Base class for pairwise additive potentials with a cutoff, using the
+ * curiously recurring template pattern so that the functional form is inlined
+ * into a common kernel.
+ *
+ * A potential derives as
+ *
+ *      class Morse : public PairPotential<Morse, 3> { ... };
+ *
+ * and provides
+ *
+ *      static Coefficients mix(AtomType& itype, AtomType& jtype);
+ *      static PairTerm energy_force(double rsq, const Coefficients& coeffs);
+ *
+ * where the first reads the parameters of two atom types and applies the
+ * potential's mixing rule, and the second evaluates the potential at a squared
+ * separation. It may also hide
+ *
+ *      static double pair_cutoff(const Coefficients& coeffs, double cutoff);
+ *
+ * to give a pair of atom types a cutoff other than the global one.
+ *
+ * Energies are shifted so that each pair's potential vanishes at its cutoff.
+ * Atoms sum over their neighbours in a full list, so that threads never write
+ * to the same atom. Neighbours within the cutoff are first packed into
+ * contiguous per-thread buffers so that the functional form is evaluated in a
+ * vectorised loop. The virial is accumulated alongside the forces.
+ *
+ * The same potential of several replicas interleaves into an
+ * InterleavedPairPotential, which vectorises across the replicas instead.
+ * @tparam Derived The potential.
+ * @tparam NumCoeffs The number of coefficients of each pair of atom types.
+ */
+template <class Derived, std::size_t NumCoeffs>
+class PairPotential : public PairwiseForce {
+ public:
+  using Coefficients = std::array<double, NumCoeffs>;
+
+  /**
+   * @brief Class constructor. Initialise all mixed atom type parameters here so
+   * we don't have to do it for every pair during evaluation.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param cutoff The interaction cutoff distance.
+   * @param skin Neighbour list skin distance.
+   */
+  PairPotential(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+      double cutoff, double skin)
+      : num_types_(atom_types.size()),
+        coeffs_(num_types_ * num_types_),
+        cutoff_sq_(num_types_ * num_types_),
+        shift_(num_types_ * num_types_),
+        neighbours_(max_cutoff(atom_types, cutoff), skin, true) {
+    for (const auto& [itype, iidx] : atom_types) {
+      for (const auto& [jtype, jidx] : atom_types) {
+        std::size_t idx = iidx * num_types_ + jidx;
+        coeffs_[idx] = Derived::mix(*itype, *jtype);
+        double pair_cutoff = Derived::pair_cutoff(coeffs_[idx], cutoff);
+        cutoff_sq_[idx] = pair_cutoff * pair_cutoff;
+        shift_[idx] =
+            Derived::energy_force(cutoff_sq_[idx], coeffs_[idx]).energy;
+      }
+    }
+  }
+
+  /**
+   * @brief Evaluate all pairwise forces between atoms within the cutoff.
+   * @param state The atomic state we're computing the forces for.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The potential energy.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override {
+    neighbours_.update(state, cell);
+    packed_.resize(omp_get_max_threads());
+
+    const auto& types = state.atom_type_indices();
+    Tensor<double, 2>::const_iterator pos = state.pos();
+    Tensor<double, 2>::iterator force = state.force();
+
+    double pot = 0, virial = 0;
+#pragma omp parallel reduction(+ : pot, virial)
+    {
+      auto& packed = packed_[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 32)
+      for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+        // Pack the neighbours within the cutoff
+        const std::size_t itype = types[iatom];
+        const auto neighbours = neighbours_.neighbours(iatom);
+        packed.resize(neighbours.size());
+        std::size_t num_packed = 0;
+        for (std::size_t jatom : neighbours) {
+          double dx = pos[3 * iatom] - pos[3 * jatom];
+          double dy = pos[3 * iatom + 1] - pos[3 * jatom + 1];
+          double dz = pos[3 * iatom + 2] - pos[3 * jatom + 2];
+          cell.min_image(dx, dy, dz);
+          double rsq = dx * dx + dy * dy + dz * dz;
+          std::size_t idx = itype * num_types_ + types[jatom];
+          if (rsq >= cutoff_sq_[idx]) continue;
+          packed.dx[num_packed] = dx;
+          packed.dy[num_packed] = dy;
+          packed.dz[num_packed] = dz;
+          packed.rsq[num_packed] = rsq;
+          packed.idx[num_packed] = idx;
+          ++num_packed;
+        }
+
+        // Evaluate the potential over the packed neighbours
+        double fx = 0, fy = 0, fz = 0, e = 0, w = 0;
+        const double *dx = packed.dx.data(), *dy = packed.dy.data(),
+                     *dz = packed.dz.data(), *rsq = packed.rsq.data();
+        const std::size_t* idx = packed.idx.data();
+#pragma omp simd reduction(+ : fx, fy, fz, e, w)
+        for (std::size_t n = 0; n < num_packed; ++n) {
+          PairTerm term = Derived::energy_force(rsq[n], coeffs_[idx[n]]);
+          fx += term.force * dx[n];
+          fy += term.force * dy[n];
+          fz += term.force * dz[n];
+          e += term.energy - shift_[idx[n]];
+          w += term.force * rsq[n];
+        }
+        force[3 * iatom] += fx;
+        force[3 * iatom + 1] += fy;
+        force[3 * iatom + 2] += fz;
+        // Each pair is visited twice in a full list
+        pot += 0.5 * e;
+        virial += 0.5 * w;
+      }
+    }
+    state.add_virial(virial);
+    return pot;
+  }
+
+  /**
+   * @brief Getter for the largest cutoff of any pair of atom types.
+   * @return The cutoff.
+   */
+  double cutoff() const override { return neighbours_.cutoff(); }
+
+  /**
+   * @brief Compute the energies of the pairs between one atom, placed at some
+   * position, and some other atoms, each added to a running total. Pairs
+   * beyond their cutoff contribute nothing, which is selected rather than
+   * branched on so that the loop vectorises.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param iatom The index of the atom.
+   * @param pos The position to place the atom at.
+   * @param atoms The indices of the other atoms, which mustn't include iatom.
+   * @param energies Running total of the energy of each pair, in the order of
+   * the atoms, which this force's energy of the pair is added to.
+   * @return The sum of this force's energies of the pairs.
+   */
+  double pair_energies(const DynamicAtomicState& state, const Cell& cell,
+                       std::size_t iatom, const std::array<double, 3>& pos,
+                       std::span<const std::size_t> atoms,
+                       double* energies) const override {
+    const std::size_t* types = state.atom_type_indices().data();
+    const double* atom_pos = std::to_address(state.pos());
+    const std::size_t row = types[iatom] * num_types_;
+    const std::size_t num_pairs = atoms.size();
+    const std::size_t* jatoms = atoms.data();
+
+    double e = 0;
+    with_cell_type(cell, [&](const auto& concrete) {
+#pragma omp simd reduction(+ : e)
+      for (std::size_t n = 0; n < num_pairs; ++n) {
+        const std::size_t jatom = jatoms[n];
+        double dx = pos[0] - atom_pos[3 * jatom];
+        double dy = pos[1] - atom_pos[3 * jatom + 1];
+        double dz = pos[2] - atom_pos[3 * jatom + 2];
+        concrete.min_image(dx, dy, dz);
+        const double rsq = dx * dx + dy * dy + dz * dz;
+        const std::size_t idx = row + types[jatom];
+        const double pair =
+            rsq < cutoff_sq_[idx]
+                ? Derived::energy_force(rsq, coeffs_[idx]).energy - shift_[idx]
+                : 0;
+        energies[n] += pair;
+        e += pair;
+      }
+    });
+    return e;
+  }
+
+  /**
+   * @brief Combine this potential with the same potential of other replicas
+   * into one evaluated across an interleaved atomic state of them all.
+   * @param replicas The force of each replica, in the order of the replicas.
+   * @return The interleaved potential, or nullptr if any replica's force is a
+   * different potential or has different atom types.
+   */
+  std::unique_ptr<InterleavedForce> interleave(
+      const std::vector<const Force*>& replicas) const override {
+    std::vector<const PairPotential*> potentials;
+    for (const Force* force : replicas) {
+      auto potential = dynamic_cast<const Derived*>(force);
+      if (!potential || potential->num_types_ != num_types_) return nullptr;
+      potentials.push_back(potential);
+    }
+    return std::make_unique<InterleavedPairPotential<Derived, NumCoeffs>>(
+        potentials);
+  }
+
+  /**
+   * @brief Default cutoff of a pair of atom types, which is the global one.
+   * @param coeffs The coefficients of the pair.
+   * @param cutoff The global cutoff.
+   * @return The cutoff of the pair.
+   */
+  static double pair_cutoff(const Coefficients& coeffs, double cutoff) {
+    return cutoff;
+  }
+
+ protected:
+  friend InterleavedPairPotential<Derived, NumCoeffs>;
+
+  /**
+   * @brief Neighbours of an atom within the cutoff, in contiguous arrays.
+   */
+  struct Packed {
+    std::vector<double> dx, dy, dz, rsq;
+    //< Index of the pair of atom types
+    std::vector<std::size_t> idx;
+
+    /**
+     * @brief Make sure there's room for some number of neighbours.
+     * @param size The number of neighbours.
+     */
+    void resize(std::size_t size) {
+      if (size <= rsq.size()) return;
+      dx.resize(size);
+      dy.resize(size);
+      dz.resize(size);
+      rsq.resize(size);
+      idx.resize(size);
+    }
+  };
+
+  std::size_t num_types_;
+  //< Coefficients, squared cutoff and energy at the cutoff of each pair of
+  //< atom types
+  std::vector<Coefficients> coeffs_;
+  std::vector<double> cutoff_sq_, shift_;
+  NeighbourList neighbours_;
+  std::vector<Packed> packed_;
+
+  /**
+   * @brief Find the largest cutoff over all pairs of atom types.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param cutoff The global cutoff.
+   * @return The largest cutoff.
+   */
+  static double max_cutoff(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+      double cutoff) {
+    double max = 0;
+    for (const auto& itype : atom_types) {
+      for (const auto& jtype : atom_types) {
+        max = std::max(max, Derived::pair_cutoff(
+                                Derived::mix(*itype.first, *jtype.first),
+                                cutoff));
+      }
+    }
+    return max;
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_PAIR_POTENTIAL_HPP */
@@ -0,0 +1,113 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/periodic_dihedral.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+PeriodicDihedral::PeriodicDihedral(std::shared_ptr<const Topology> topology)
+    : BondedForce(topology, require(topology)->dihedrals) {}
+
+// ========================================================================== //
+
+double PeriodicDihedral::compute(Tensor<double, 2>::const_iterator pos,
+                                 const Cell& cell, double& virial) {
+  double length, inv_length;
+  periodicity(cell, length, inv_length);
+
+  const std::size_t num_terms = terms_.size();
+  const std::size_t* a = terms_.atoms(0).data();
+  const std::size_t* b = terms_.atoms(1).data();
+  const std::size_t* c = terms_.atoms(2).data();
+  const std::size_t* d = terms_.atoms(3).data();
+  const double* k = terms_.param(0).data();
+  const double* n = terms_.param(1).data();
+  const double* phi0 = terms_.param(2).data();
+  double *fax = term_force(0, 0), *fay = term_force(0, 1),
+         *faz = term_force(0, 2);
+  double *fbx = term_force(1, 0), *fby = term_force(1, 1),
+         *fbz = term_force(1, 2);
+  double *fcx = term_force(2, 0), *fcy = term_force(2, 1),
+         *fcz = term_force(2, 2);
+  double *fdx = term_force(3, 0), *fdy = term_force(3, 1),
+         *fdz = term_force(3, 2);
+
+  double pot = 0, vir = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : pot, vir)
+  for (std::size_t iterm = 0; iterm < num_terms; ++iterm) {
+    // Bond vectors along the chain of atoms
+    double b1x = pos[3 * b[iterm]] - pos[3 * a[iterm]];
+    double b1y = pos[3 * b[iterm] + 1] - pos[3 * a[iterm] + 1];
+    double b1z = pos[3 * b[iterm] + 2] - pos[3 * a[iterm] + 2];
+    double b2x = pos[3 * c[iterm]] - pos[3 * b[iterm]];
+    double b2y = pos[3 * c[iterm] + 1] - pos[3 * b[iterm] + 1];
+    double b2z = pos[3 * c[iterm] + 2] - pos[3 * b[iterm] + 2];
+    double b3x = pos[3 * d[iterm]] - pos[3 * c[iterm]];
+    double b3y = pos[3 * d[iterm] + 1] - pos[3 * c[iterm] + 1];
+    double b3z = pos[3 * d[iterm] + 2] - pos[3 * c[iterm] + 2];
+    b1x -= length * std::round(b1x * inv_length);
+    b1y -= length * std::round(b1y * inv_length);
+    b1z -= length * std::round(b1z * inv_length);
+    b2x -= length * std::round(b2x * inv_length);
+    b2y -= length * std::round(b2y * inv_length);
+    b2z -= length * std::round(b2z * inv_length);
+    b3x -= length * std::round(b3x * inv_length);
+    b3y -= length * std::round(b3y * inv_length);
+    b3z -= length * std::round(b3z * inv_length);
+
+    // Normals to the two planes
+    double mx = b1y * b2z - b1z * b2y;
+    double my = b1z * b2x - b1x * b2z;
+    double mz = b1x * b2y - b1y * b2x;
+    double nx = b2y * b3z - b2z * b3y;
+    double ny = b2z * b3x - b2x * b3z;
+    double nz = b2x * b3y - b2y * b3x;
+    double m_sq = std::max(mx * mx + my * my + mz * mz, 1E-16);
+    double n_sq = std::max(nx * nx + ny * ny + nz * nz, 1E-16);
+    double b2_sq = b2x * b2x + b2y * b2y + b2z * b2z;
+    double b2_len = std::sqrt(b2_sq);
+
+    double phi = std::atan2(b2_len * (b1x * nx + b1y * ny + b1z * nz),
+                            mx * nx + my * ny + mz * nz);
+    double arg = n[iterm] * phi - phi0[iterm];
+    pot += k[iterm] * (1 + std::cos(arg));
+    double dv_dphi = -k[iterm] * n[iterm] * std::sin(arg);
+
+    // Forces on the outer atoms lie along the plane normals; those on the
+    // inner atoms follow from there being no net force or torque
+    double pa = dv_dphi * b2_len / m_sq, pd = -dv_dphi * b2_len / n_sq;
+    fax[iterm] = pa * mx;
+    fay[iterm] = pa * my;
+    faz[iterm] = pa * mz;
+    fdx[iterm] = pd * nx;
+    fdy[iterm] = pd * ny;
+    fdz[iterm] = pd * nz;
+    double s1 = (b1x * b2x + b1y * b2y + b1z * b2z) / b2_sq;
+    double s3 = (b3x * b2x + b3y * b2y + b3z * b2z) / b2_sq;
+    fbx[iterm] = s3 * fdx[iterm] - (s1 + 1) * fax[iterm];
+    fby[iterm] = s3 * fdy[iterm] - (s1 + 1) * fay[iterm];
+    fbz[iterm] = s3 * fdz[iterm] - (s1 + 1) * faz[iterm];
+    fcx[iterm] = -fax[iterm] - fbx[iterm] - fdx[iterm];
+    fcy[iterm] = -fay[iterm] - fby[iterm] - fdy[iterm];
+    fcz[iterm] = -faz[iterm] - fbz[iterm] - fdz[iterm];
+    // Relative to the second atom, as the forces sum to zero
+    vir += (b2x + b3x) * fdx[iterm] + (b2y + b3y) * fdy[iterm] +
+           (b2z + b3z) * fdz[iterm] + b2x * fcx[iterm] + b2y * fcy[iterm] +
+           b2z * fcz[iterm] - b1x * fax[iterm] - b1y * fay[iterm] -
+           b1z * faz[iterm];
+  }
+  virial = vir;
+  return pot;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
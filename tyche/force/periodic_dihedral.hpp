@@ -0,0 +1,48 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_PERIODIC_DIHEDRAL_HPP
+#define __TYCHE_FORCE_PERIODIC_DIHEDRAL_HPP
+
+// C++ Standard Libraries
+#include <memory>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/topology.hpp"
+#include "tyche/force/bonded_force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Periodic torsion force over the dihedrals of a topology, with
+ * potential energy
+ *
+ *      V = k (1 + \cos(n \phi - \phi_0))
+ *
+ * where phi is the angle between the plane of the first three atoms and the
+ * plane of the last three.
+ */
+class PeriodicDihedral : public BondedForce<BondedTerms<4, 3>> {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param topology The topology holding the dihedrals.
+   */
+  PeriodicDihedral(std::shared_ptr<const Topology> topology);
+
+ protected:
+  /**
+   * @brief Compute the energy and forces of every dihedral.
+   * @param pos Iterator to the start of the atomic positions.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param virial The virial of the forces.
+   * @return The torsional energy.
+   */
+  double compute(Tensor<double, 2>::const_iterator pos, const Cell& cell,
+                 double& virial) override;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_PERIODIC_DIHEDRAL_HPP */
@@ -0,0 +1,185 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <algorithm>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/force/stillinger_weber.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+StillingerWeber::StillingerWeber(
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+    double skin)
+    : num_types_(atom_types.size()),
+      eps_(num_types_ * num_types_),
+      sigma_(num_types_ * num_types_),
+      cutoff_(num_types_ * num_types_),
+      gamma_sigma_(num_types_ * num_types_),
+      A_(num_types_ * num_types_),
+      B_(num_types_ * num_types_),
+      p_(num_types_ * num_types_),
+      q_(num_types_ * num_types_),
+      lambda_(num_types_),
+      cos_theta0_(num_types_),
+      neighbours_(max_cutoff(atom_types), skin, true) {
+  for (const auto& itype : atom_types) {
+    lambda_[itype.second] = itype.first->get<double>("lambda_sw");
+    cos_theta0_[itype.second] = itype.first->get<double>("costheta0_sw");
+
+    for (const auto& jtype : atom_types) {
+      std::size_t idx = itype.second * num_types_ + jtype.second;
+      auto mix = [&](std::string name) {
+        return (itype.first->get<double>(name) +
+                jtype.first->get<double>(name)) /
+               2;
+      };
+      eps_[idx] = std::sqrt(itype.first->get<double>("eps_sw") *
+                            jtype.first->get<double>("eps_sw"));
+      sigma_[idx] = mix("sigma_sw");
+      cutoff_[idx] = mix("a_sw") * sigma_[idx];
+      gamma_sigma_[idx] = mix("gamma_sw") * sigma_[idx];
+      A_[idx] = mix("A_sw");
+      B_[idx] = mix("B_sw");
+      p_[idx] = mix("p_sw");
+      q_[idx] = mix("q_sw");
+    }
+  }
+}
+
+// ========================================================================== //
+
+double StillingerWeber::max_cutoff(
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types) {
+  double cutoff = 0;
+  for (const auto& itype : atom_types) {
+    for (const auto& jtype : atom_types) {
+      double a =
+          (itype.first->get<double>("a_sw") + jtype.first->get<double>("a_sw"));
+      double sigma = (itype.first->get<double>("sigma_sw") +
+                      jtype.first->get<double>("sigma_sw"));
+      cutoff = std::max(cutoff, a * sigma / 4);
+    }
+  }
+  return cutoff;
+}
+
+// ========================================================================== //
+
+double StillingerWeber::evaluate(DynamicAtomicState& state, const Cell& cell) {
+  neighbours_.update(state, cell);
+  buffer_.zero(state.num_atoms());
+  short_lists_.resize(omp_get_max_threads());
+
+  const auto& types = state.atom_type_indices();
+  Tensor<double, 2>::const_iterator pos = state.pos();
+
+  double pot = 0, virial = 0;
+#pragma omp parallel reduction(+ : pot, virial)
+  {
+    auto& short_list = short_lists_[omp_get_thread_num()];
+    auto force = buffer_.local();
+
+#pragma omp for schedule(dynamic, 32)
+    for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+      const std::size_t itype = types[iatom];
+      double fx = 0, fy = 0, fz = 0;
+
+      // Two-body terms, whilst gathering the short list of neighbours within
+      // the cutoff for the three-body terms
+      short_list.clear();
+      for (std::size_t jatom : neighbours_.neighbours(iatom)) {
+        double dx = pos[3 * jatom] - pos[3 * iatom];
+        double dy = pos[3 * jatom + 1] - pos[3 * iatom + 1];
+        double dz = pos[3 * jatom + 2] - pos[3 * iatom + 2];
+        cell.min_image(dx, dy, dz);
+        double rsq = dx * dx + dy * dy + dz * dz;
+
+        std::size_t idx = itype * num_types_ + types[jatom];
+        if (rsq >= cutoff_[idx] * cutoff_[idx]) continue;
+        double r = std::sqrt(rsq), inv_r = 1 / r;
+
+        double sigma = sigma_[idx], inv_rc = 1 / (r - cutoff_[idx]);
+        double sr_p = std::pow(sigma * inv_r, p_[idx]);
+        double sr_q = std::pow(sigma * inv_r, q_[idx]);
+        double pre = A_[idx] * eps_[idx] * std::exp(sigma * inv_rc);
+        double radial = B_[idx] * sr_p - sr_q;
+        double phi = pre * radial;
+        double dphi =
+            pre * ((q_[idx] * sr_q - p_[idx] * B_[idx] * sr_p) * inv_r -
+                   radial * sigma * inv_rc * inv_rc);
+        // Each pair is visited twice in a full list
+        pot += 0.5 * phi;
+        virial -= 0.5 * dphi * r;
+        fx += dphi * dx * inv_r;
+        fy += dphi * dy * inv_r;
+        fz += dphi * dz * inv_r;
+
+        double g = std::exp(gamma_sigma_[idx] * inv_rc);
+        short_list.push_back({jatom, r, dx * inv_r, dy * inv_r, dz * inv_r, g,
+                              -g * gamma_sigma_[idx] * inv_rc * inv_rc,
+                              std::sqrt(eps_[idx])});
+      }
+
+      // Three-body terms over each distinct pair of neighbours
+      const double lambda = lambda_[itype], cos_theta0 = cos_theta0_[itype];
+      for (std::size_t jdx = 0; jdx < short_list.size(); ++jdx) {
+        const auto& j = short_list[jdx];
+        for (std::size_t kdx = jdx + 1; kdx < short_list.size(); ++kdx) {
+          const auto& k = short_list[kdx];
+
+          double cos_theta = j.ux * k.ux + j.uy * k.uy + j.uz * k.uz;
+          double delta = cos_theta - cos_theta0;
+          double scale = lambda * j.sqrt_eps * k.sqrt_eps;
+          pot += scale * delta * delta * j.g * k.g;
+
+          // Derivatives with respect to the two distances and the angle
+          double de_drj = scale * delta * delta * j.dg * k.g;
+          double de_drk = scale * delta * delta * j.g * k.dg;
+          double de_dcos = 2 * scale * delta * j.g * k.g;
+          double cj = de_dcos / j.r, ck = de_dcos / k.r;
+
+          // Gradient of the energy with respect to the position of each
+          // neighbour; the central atom takes the opposite of their sum
+          double gjx = de_drj * j.ux + cj * (k.ux - cos_theta * j.ux);
+          double gjy = de_drj * j.uy + cj * (k.uy - cos_theta * j.uy);
+          double gjz = de_drj * j.uz + cj * (k.uz - cos_theta * j.uz);
+          double gkx = de_drk * k.ux + ck * (j.ux - cos_theta * k.ux);
+          double gky = de_drk * k.uy + ck * (j.uy - cos_theta * k.uy);
+          double gkz = de_drk * k.uz + ck * (j.uz - cos_theta * k.uz);
+          // Relative to the central atom, as the forces sum to zero
+          virial -= j.r * (j.ux * gjx + j.uy * gjy + j.uz * gjz) +
+                    k.r * (k.ux * gkx + k.uy * gky + k.uz * gkz);
+
+          force[3 * j.idx] -= gjx;
+          force[3 * j.idx + 1] -= gjy;
+          force[3 * j.idx + 2] -= gjz;
+          force[3 * k.idx] -= gkx;
+          force[3 * k.idx + 1] -= gky;
+          force[3 * k.idx + 2] -= gkz;
+          fx += gjx + gkx;
+          fy += gjy + gky;
+          fz += gjz + gkz;
+        }
+      }
+
+      force[3 * iatom] += fx;
+      force[3 * iatom + 1] += fy;
+      force[3 * iatom + 2] += fz;
+    }
+  }
+
+  buffer_.reduce(state.force());
+  state.add_virial(virial);
+  return pot;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,102 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_STILLINGER_WEBER_HPP
+#define __TYCHE_FORCE_STILLINGER_WEBER_HPP
+
+// C++ Standard Libraries
+#include <map>
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/force/thread_force_buffer.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Stillinger-Weber force evaluation for an atomic state. The potential
+ * energy is a sum of two- and three-body terms
+ *
+ *      V = \sum_{i<j} \phi_2(r_{ij}) + \sum_i \sum_{j<k} \phi_3(r_{ij}, r_{ik},
+ *          \theta_{jik})
+ *
+ *      \phi_2(r) = A \epsilon [B (\sigma/r)^p - (\sigma/r)^q]
+ *                  \exp(\sigma / (r - a \sigma))
+ *
+ *      \phi_3 = \lambda \epsilon (\cos\theta_{jik} - \cos\theta_0)^2
+ *               \exp(\gamma \sigma / (r_{ij} - a \sigma))
+ *               \exp(\gamma \sigma / (r_{ik} - a \sigma))
+ *
+ * Parameters are read from the atom types as eps_sw, sigma_sw, a_sw, gamma_sw,
+ * A_sw, B_sw, p_sw, q_sw, lambda_sw and costheta0_sw. For unlike pairs, eps_sw
+ * is mixed geometrically and the remaining pair parameters arithmetically. The
+ * three-body strength uses the geometric mean of the two pair epsilons, along
+ * with lambda_sw and costheta0_sw of the central atom.
+ *
+ * Triplets are enumerated from the short list of neighbours within the cutoff
+ * of each central atom, so the cost is O(N z^2) for a coordination number z.
+ */
+class StillingerWeber : public Force {
+ public:
+  /**
+   * @brief Class constructor. Initialise all mixed atom type parameters here so
+   * we don't have to do it for every pair during evaluation.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param skin Neighbour list skin distance.
+   */
+  StillingerWeber(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+      double skin);
+
+  /**
+   * @brief Evaluate all forces arising from the Stillinger-Weber potential
+   * between atoms in an atomic state. The virial is accumulated in the same
+   * loop as the forces.
+   * @param state The atomic state we're computing the forces for.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The Stillinger-Weber potential.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override;
+
+ protected:
+  /**
+   * @brief Neighbour of a central atom within the cutoff, along with the
+   * quantities that every triplet it takes part in requires.
+   */
+  struct Neighbour {
+    //< Index of the neighbouring atom
+    std::size_t idx;
+    //< Distance and unit vector from the central atom to the neighbour
+    double r, ux, uy, uz;
+    //< Radial three-body factor \exp(\gamma \sigma / (r - a \sigma)) and its
+    //< derivative with respect to r
+    double g, dg;
+    //< Square root of the pair epsilon; the energy scale of a triplet is the
+    //< product of those of its two pairs with lambda of the central atom
+    double sqrt_eps;
+  };
+
+  std::size_t num_types_;
+  std::vector<double> eps_, sigma_, cutoff_, gamma_sigma_, A_, B_, p_, q_;
+  std::vector<double> lambda_, cos_theta0_;
+  NeighbourList neighbours_;
+  ThreadForceBuffer buffer_;
+  std::vector<std::vector<Neighbour>> short_lists_;
+
+  /**
+   * @brief Find the largest cutoff a sigma over all pairs of atom types.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @return The largest cutoff.
+   */
+  static double max_cutoff(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_STILLINGER_WEBER_HPP */
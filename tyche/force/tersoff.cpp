@@ -0,0 +1,243 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/force/tersoff.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Tersoff::Tersoff(
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+    double skin)
+    : num_types_(atom_types.size()),
+      A_(num_types_ * num_types_),
+      B_(num_types_ * num_types_),
+      lambda1_(num_types_ * num_types_),
+      lambda2_(num_types_ * num_types_),
+      R_(num_types_ * num_types_),
+      D_(num_types_ * num_types_),
+      lambda3_(num_types_),
+      beta_(num_types_),
+      n_(num_types_),
+      c_sq_(num_types_),
+      d_sq_(num_types_),
+      h_(num_types_),
+      gamma_(num_types_),
+      neighbours_(max_cutoff(atom_types), skin, true) {
+  for (const auto& itype : atom_types) {
+    auto& i = itype.first;
+    std::size_t iidx = itype.second;
+    lambda3_[iidx] = i->get<double>("lambda3_tersoff");
+    beta_[iidx] = i->get<double>("beta_tersoff");
+    n_[iidx] = i->get<double>("n_tersoff");
+    c_sq_[iidx] = std::pow(i->get<double>("c_tersoff"), 2);
+    d_sq_[iidx] = std::pow(i->get<double>("d_tersoff"), 2);
+    h_[iidx] = i->get<double>("h_tersoff");
+    gamma_[iidx] = i->get<double>("gamma_tersoff");
+
+    for (const auto& jtype : atom_types) {
+      auto& j = jtype.first;
+      std::size_t idx = iidx * num_types_ + jtype.second;
+      auto geometric = [&](std::string name) {
+        return std::sqrt(i->get<double>(name) * j->get<double>(name));
+      };
+      auto arithmetic = [&](std::string name) {
+        return (i->get<double>(name) + j->get<double>(name)) / 2;
+      };
+      A_[idx] = geometric("A_tersoff");
+      B_[idx] = geometric("B_tersoff");
+      lambda1_[idx] = arithmetic("lambda1_tersoff");
+      lambda2_[idx] = arithmetic("lambda2_tersoff");
+
+      double inner = std::sqrt(
+          (i->get<double>("R_tersoff") - i->get<double>("D_tersoff")) *
+          (j->get<double>("R_tersoff") - j->get<double>("D_tersoff")));
+      double outer = std::sqrt(
+          (i->get<double>("R_tersoff") + i->get<double>("D_tersoff")) *
+          (j->get<double>("R_tersoff") + j->get<double>("D_tersoff")));
+      R_[idx] = (outer + inner) / 2;
+      D_[idx] = (outer - inner) / 2;
+    }
+  }
+}
+
+// ========================================================================== //
+
+double Tersoff::max_cutoff(
+    const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types) {
+  double cutoff = 0;
+  for (const auto& itype : atom_types) {
+    for (const auto& jtype : atom_types) {
+      auto outer = [](const std::shared_ptr<AtomType>& type) {
+        return type->get<double>("R_tersoff") + type->get<double>("D_tersoff");
+      };
+      cutoff =
+          std::max(cutoff, std::sqrt(outer(itype.first) * outer(jtype.first)));
+    }
+  }
+  return cutoff;
+}
+
+// ========================================================================== //
+
+void Tersoff::cutoff(double r, std::size_t pair, double& fc,
+                     double& dfc) const {
+  const double R = R_[pair], D = D_[pair];
+  if (r < R - D) {
+    fc = 1;
+    dfc = 0;
+  } else if (r < R + D) {
+    double arg = std::numbers::pi / 2 * (r - R) / D;
+    fc = 0.5 - 0.5 * std::sin(arg);
+    dfc = -std::numbers::pi / (4 * D) * std::cos(arg);
+  } else {
+    fc = 0;
+    dfc = 0;
+  }
+}
+
+// ========================================================================== //
+
+double Tersoff::evaluate(DynamicAtomicState& state, const Cell& cell) {
+  neighbours_.update(state, cell);
+  buffer_.zero(state.num_atoms());
+  short_lists_.resize(omp_get_max_threads());
+  angular_.resize(omp_get_max_threads());
+
+  const auto& types = state.atom_type_indices();
+  Tensor<double, 2>::const_iterator pos = state.pos();
+
+  double pot = 0, virial = 0;
+#pragma omp parallel reduction(+ : pot, virial)
+  {
+    auto& short_list = short_lists_[omp_get_thread_num()];
+    auto force = buffer_.local();
+
+#pragma omp for schedule(dynamic, 32)
+    for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+      const std::size_t itype = types[iatom];
+      const double lambda3_cb = std::pow(lambda3_[itype], 3);
+      const double beta = beta_[itype], n = n_[itype], c_sq = c_sq_[itype],
+                   d_sq = d_sq_[itype], h = h_[itype], gamma = gamma_[itype];
+
+      short_list.clear();
+      for (std::size_t jatom : neighbours_.neighbours(iatom)) {
+        double dx = pos[3 * jatom] - pos[3 * iatom];
+        double dy = pos[3 * jatom + 1] - pos[3 * iatom + 1];
+        double dz = pos[3 * jatom + 2] - pos[3 * iatom + 2];
+        cell.min_image(dx, dy, dz);
+        double rsq = dx * dx + dy * dy + dz * dz;
+
+        std::size_t pair = itype * num_types_ + types[jatom];
+        double r_max = R_[pair] + D_[pair];
+        if (rsq >= r_max * r_max) continue;
+        double r = std::sqrt(rsq), inv_r = 1 / r;
+        double fc, dfc;
+        cutoff(r, pair, fc, dfc);
+        short_list.push_back(
+            {jatom, pair, r, dx * inv_r, dy * inv_r, dz * inv_r, fc, dfc});
+      }
+
+      // Contribution of each neighbour k to the bond order of neighbour j is
+      // cached so that it can be reused for the derivatives
+      auto& angular = angular_[omp_get_thread_num()];
+      angular.resize(short_list.size());
+
+      double fx = 0, fy = 0, fz = 0;
+      for (std::size_t jdx = 0; jdx < short_list.size(); ++jdx) {
+        const auto& j = short_list[jdx];
+
+        double zeta = 0;
+        for (std::size_t kdx = 0; kdx < short_list.size(); ++kdx) {
+          if (kdx == jdx) continue;
+          const auto& k = short_list[kdx];
+          auto& a = angular[kdx];
+          a.cos_theta = j.ux * k.ux + j.uy * k.uy + j.uz * k.uz;
+          double hc = h - a.cos_theta, denom = 1 / (d_sq + hc * hc);
+          a.g = gamma * (1 + c_sq / d_sq - c_sq * denom);
+          a.dg = -2 * gamma * c_sq * hc * denom * denom;
+          double dr = j.r - k.r;
+          a.ex = std::exp(lambda3_cb * dr * dr * dr);
+          a.dex = 3 * lambda3_cb * dr * dr * a.ex;
+          zeta += k.fc * a.g * a.ex;
+        }
+        double t = zeta > 0 ? std::pow(beta * zeta, n) : 0;
+        double b = std::pow(1 + t, -0.5 / n);
+        double db_dzeta = zeta > 0 ? -0.5 * b * t / ((1 + t) * zeta) : 0;
+
+        // Pair contribution at fixed bond order
+        const std::size_t pair = j.pair;
+        double f_rep = A_[pair] * std::exp(-lambda1_[pair] * j.r);
+        double f_att = -B_[pair] * std::exp(-lambda2_[pair] * j.r);
+        pot += 0.5 * j.fc * (f_rep + b * f_att);
+        double de_dr = 0.5 * (j.dfc * (f_rep + b * f_att) -
+                              j.fc * (lambda1_[pair] * f_rep +
+                                      lambda2_[pair] * b * f_att));
+        virial -= de_dr * j.r;
+        force[3 * j.idx] -= de_dr * j.ux;
+        force[3 * j.idx + 1] -= de_dr * j.uy;
+        force[3 * j.idx + 2] -= de_dr * j.uz;
+        fx += de_dr * j.ux;
+        fy += de_dr * j.uy;
+        fz += de_dr * j.uz;
+
+        // Contribution through the bond order's dependence on each neighbour
+        double pre = 0.5 * j.fc * f_att * db_dzeta;
+        if (pre == 0) continue;
+        for (std::size_t kdx = 0; kdx < short_list.size(); ++kdx) {
+          if (kdx == jdx) continue;
+          const auto& k = short_list[kdx];
+          const auto& a = angular[kdx];
+
+          double cj = pre * k.fc * a.ex * a.dg / j.r;
+          double ck = pre * k.fc * a.ex * a.dg / k.r;
+          double rj = pre * k.fc * a.g * a.dex;
+          double rk = pre * (k.dfc * a.g * a.ex - k.fc * a.g * a.dex);
+
+          // Gradient with respect to the position of each neighbour; the
+          // central atom takes the opposite of their sum
+          double gjx = rj * j.ux + cj * (k.ux - a.cos_theta * j.ux);
+          double gjy = rj * j.uy + cj * (k.uy - a.cos_theta * j.uy);
+          double gjz = rj * j.uz + cj * (k.uz - a.cos_theta * j.uz);
+          double gkx = rk * k.ux + ck * (j.ux - a.cos_theta * k.ux);
+          double gky = rk * k.uy + ck * (j.uy - a.cos_theta * k.uy);
+          double gkz = rk * k.uz + ck * (j.uz - a.cos_theta * k.uz);
+          // Relative to the central atom, as the forces sum to zero
+          virial -= j.r * (j.ux * gjx + j.uy * gjy + j.uz * gjz) +
+                    k.r * (k.ux * gkx + k.uy * gky + k.uz * gkz);
+
+          force[3 * j.idx] -= gjx;
+          force[3 * j.idx + 1] -= gjy;
+          force[3 * j.idx + 2] -= gjz;
+          force[3 * k.idx] -= gkx;
+          force[3 * k.idx + 1] -= gky;
+          force[3 * k.idx + 2] -= gkz;
+          fx += gjx + gkx;
+          fy += gjy + gky;
+          fz += gjz + gkz;
+        }
+      }
+
+      force[3 * iatom] += fx;
+      force[3 * iatom + 1] += fy;
+      force[3 * iatom + 2] += fz;
+    }
+  }
+
+  buffer_.reduce(state.force());
+  state.add_virial(virial);
+  return pot;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,127 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_TERSOFF_HPP
+#define __TYCHE_FORCE_TERSOFF_HPP
+
+// C++ Standard Libraries
+#include <map>
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/force/thread_force_buffer.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Tersoff bond-order force evaluation for an atomic state. The
+ * potential energy is
+ *
+ *      V = \frac{1}{2} \sum_i \sum_{j \neq i} f_C(r_{ij})
+ *          [A e^{-\lambda_1 r_{ij}} - b_{ij} B e^{-\lambda_2 r_{ij}}]
+ *
+ *      b_{ij} = (1 + \beta^n \zeta_{ij}^n)^{-1/2n}
+ *
+ *      \zeta_{ij} = \sum_{k \neq i,j} f_C(r_{ik}) g(\theta_{ijk})
+ *                   e^{\lambda_3^3 (r_{ij} - r_{ik})^3}
+ *
+ *      g(\theta) = \gamma (1 + c^2/d^2 - c^2 / (d^2 + (h - \cos\theta)^2))
+ *
+ * with f_C a smooth cutoff which falls from one to zero on [R - D, R + D].
+ *
+ * Parameters are read from the atom types as A_tersoff, B_tersoff,
+ * lambda1_tersoff, lambda2_tersoff, lambda3_tersoff, beta_tersoff, n_tersoff,
+ * c_tersoff, d_tersoff, h_tersoff, gamma_tersoff, R_tersoff and D_tersoff.
+ * Unlike pairs are mixed following Tersoff: A, B and the inner and outer
+ * cutoff radii geometrically, lambda1 and lambda2 arithmetically. The angular
+ * parameters are those of the central atom.
+ *
+ * The bond orders of a central atom are computed from its short list of
+ * neighbours within the cutoff, so the cost is O(N z^2) for a coordination
+ * number z.
+ */
+class Tersoff : public Force {
+ public:
+  /**
+   * @brief Class constructor. Initialise all mixed atom type parameters here so
+   * we don't have to do it for every pair during evaluation.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param skin Neighbour list skin distance.
+   */
+  Tersoff(const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+          double skin);
+
+  /**
+   * @brief Evaluate all forces arising from the Tersoff potential between
+   * atoms in an atomic state. The virial is accumulated in the same loop as
+   * the forces.
+   * @param state The atomic state we're computing the forces for.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The Tersoff potential.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override;
+
+ protected:
+  /**
+   * @brief Neighbour of a central atom within the cutoff, along with the
+   * quantities that every bond order it takes part in requires.
+   */
+  struct Neighbour {
+    //< Index of the neighbouring atom
+    std::size_t idx;
+    //< Index into the mixed pair parameters
+    std::size_t pair;
+    //< Distance and unit vector from the central atom to the neighbour
+    double r, ux, uy, uz;
+    //< Cutoff function and its derivative with respect to r
+    double fc, dfc;
+  };
+
+  /**
+   * @brief Factors of the contribution of a neighbour k to the bond order of
+   * another neighbour j, cached between computing the bond order and its
+   * derivatives.
+   */
+  struct Angular {
+    //< Cosine of the angle between the neighbours about the central atom
+    double cos_theta;
+    //< Angular function and its derivative with respect to cos_theta
+    double g, dg;
+    //< Radial exponential factor and its derivative with respect to r_ij
+    double ex, dex;
+  };
+
+  std::size_t num_types_;
+  std::vector<double> A_, B_, lambda1_, lambda2_, R_, D_;
+  std::vector<double> lambda3_, beta_, n_, c_sq_, d_sq_, h_, gamma_;
+  NeighbourList neighbours_;
+  ThreadForceBuffer buffer_;
+  std::vector<std::vector<Neighbour>> short_lists_;
+  std::vector<std::vector<Angular>> angular_;
+
+  /**
+   * @brief Evaluate the smooth cutoff function.
+   * @param r The distance.
+   * @param pair Index into the mixed pair parameters.
+   * @param fc The value of the cutoff function.
+   * @param dfc The derivative of the cutoff function with respect to r.
+   */
+  void cutoff(double r, std::size_t pair, double& fc, double& dfc) const;
+
+  /**
+   * @brief Find the largest outer cutoff radius over all pairs of atom types.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @return The largest cutoff.
+   */
+  static double max_cutoff(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_TERSOFF_HPP */
@@ -0,0 +1,82 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_THREAD_FORCE_BUFFER_HPP
+#define __TYCHE_FORCE_THREAD_FORCE_BUFFER_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Private force accumulators for each thread.
+ *
+ * Many-body forces threaded over central atoms also push force onto the
+ * central atom's neighbours, which another thread may be writing to at the same
+ * time. Each thread instead accumulates into its own buffer, and the buffers
+ * are summed into the atomic state at the end of the evaluation. The storage
+ * persists between evaluations, so there's only an allocation when the number
+ * of atoms or threads changes.
+ */
+class ThreadForceBuffer {
+ public:
+  /**
+   * @brief Class constructor.
+   */
+  ThreadForceBuffer() : num_threads_(0), stride_(0) {}
+
+  /**
+   * @brief Size the buffers for the number of atoms and available threads, and
+   * zero them. Must be called outside of a parallel region.
+   * @param num_atoms The number of atoms in the atomic state.
+   */
+  void zero(std::size_t num_atoms) {
+    num_threads_ = omp_get_max_threads();
+    stride_ = 3 * num_atoms;
+    const std::size_t size = num_threads_ * stride_;
+    buffer_.resize(size);
+    // Every slice is zeroed, whether or not its thread joins this team, as
+    // reduce sums them all
+#pragma omp parallel for schedule(static)
+    for (std::size_t idx = 0; idx < size; ++idx) buffer_[idx] = 0;
+  }
+
+  /**
+   * @brief Getter for the buffer of the calling thread.
+   * @return Iterator to the start of the calling thread's buffer, laid out in
+   * the same manner as the atomic state's forces.
+   */
+  std::vector<double>::iterator local() {
+    return buffer_.begin() + omp_get_thread_num() * stride_;
+  }
+
+  /**
+   * @brief Add the sum of all thread buffers to some forces. Must be called
+   * outside of a parallel region.
+   * @param force Iterator to the start of the forces to accumulate to.
+   */
+  void reduce(Tensor<double, 2>::iterator force) {
+#pragma omp parallel for
+    for (std::size_t idx = 0; idx < stride_; ++idx) {
+      double sum = 0;
+      for (std::size_t ithread = 0; ithread < num_threads_; ++ithread) {
+        sum += buffer_[ithread * stride_ + idx];
+      }
+      force[idx] += sum;
+    }
+  }
+
+ private:
+  std::size_t num_threads_, stride_;
+  std::vector<double> buffer_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_THREAD_FORCE_BUFFER_HPP */
@@ -0,0 +1,78 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_FORCE_WEEKS_CHANDLER_ANDERSEN_HPP
+#define __TYCHE_FORCE_WEEKS_CHANDLER_ANDERSEN_HPP
+
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/pair_potential.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Weeks-Chandler-Andersen potential (J. Chem. Phys. 54, 5237 (1971)),
+ * the purely repulsive part of the Lennard-Jones potential, truncated at its
+ * minimum 2^{1/6} \sigma and shifted up by \epsilon to vanish there.
+ *
+ * Parameters are the Lennard-Jones eps_lj and sigma_lj of the atom types,
+ * with the same Lorentz-Berthelot mixing.
+ */
+class WeeksChandlerAndersen : public PairPotential<WeeksChandlerAndersen, 2> {
+ public:
+  /**
+   * @brief Class constructor. The cutoff of each pair is fixed by its sigma.
+   * @param atom_types Mapping from atom type to an index on [0,num_atom_types).
+   * @param skin Neighbour list skin distance.
+   */
+  WeeksChandlerAndersen(
+      const std::map<std::shared_ptr<AtomType>, std::size_t>& atom_types,
+      double skin)
+      : PairPotential(atom_types, 0, skin) {}
+
+  /**
+   * @brief Mix the parameters of two atom types.
+   * @param itype An atom type.
+   * @param jtype An atom type.
+   * @return Epsilon and squared sigma of the pair.
+   */
+  static Coefficients mix(AtomType& itype, AtomType& jtype) {
+    double sigma =
+        (itype.get<double>("sigma_lj") + jtype.get<double>("sigma_lj")) / 2;
+    return {std::sqrt(itype.get<double>("eps_lj") *
+                      jtype.get<double>("eps_lj")),
+            sigma * sigma};
+  }
+
+  /**
+   * @brief Cutoff of a pair of atom types, at the minimum of the
+   * Lennard-Jones potential.
+   * @param coeffs The coefficients of the pair.
+   * @param cutoff The global cutoff, which is ignored.
+   * @return The cutoff of the pair.
+   */
+  static double pair_cutoff(const Coefficients& coeffs, double cutoff) {
+    return std::pow(2.0, 1.0 / 6) * std::sqrt(coeffs[1]);
+  }
+
+  /**
+   * @brief Evaluate the Lennard-Jones potential for a pair of atoms.
+   * @param rsq The squared separation of the atoms.
+   * @param coeffs The coefficients of the pair.
+   * @return The energy, and force divided by the separation.
+   */
+  static PairTerm energy_force(double rsq, const Coefficients& coeffs) {
+    const auto [eps, sigma_sq] = coeffs;
+    double tmp = sigma_sq / rsq;
+    double b = tmp * tmp * tmp;
+    double a = b * b;
+    return {4 * eps * (a - b), 24 * eps * (2 * a - b) / rsq};
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_FORCE_WEEKS_CHANDLER_ANDERSEN_HPP */
@@ -0,0 +1,229 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/integrate/constraints.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Constraints::Constraints(std::shared_ptr<const Topology> topology,
+                         double tolerance, std::size_t max_iterations)
+    : topology_(topology),
+      tolerance_(tolerance),
+      max_iterations_(max_iterations),
+      virial_(0) {
+  const auto& constraints = topology_->constraints;
+  a_ = constraints.atoms(0);
+  b_ = constraints.atoms(1);
+  dist_sq_.resize(size());
+  for (std::size_t icon = 0; icon < size(); ++icon) {
+    dist_sq_[icon] = constraints.param(0)[icon] * constraints.param(0)[icon];
+  }
+  ref_x_.resize(size());
+  ref_y_.resize(size());
+  ref_z_.resize(size());
+  build_clusters();
+  spdlog::info("Found {} constraint/s in {} cluster/s.", size(),
+               offsets_.size() - 1);
+}
+
+// ========================================================================== //
+
+void Constraints::build_clusters() {
+  // Union-find over atoms, where each constraint joins its two atoms
+  auto max_atom = topology_->constraints.max_atom();
+  std::vector<std::size_t> parent(max_atom ? *max_atom + 1 : 0);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto root = [&](std::size_t iatom) {
+    while (parent[iatom] != iatom) {
+      parent[iatom] = parent[parent[iatom]];
+      iatom = parent[iatom];
+    }
+    return iatom;
+  };
+  for (std::size_t icon = 0; icon < size(); ++icon) {
+    parent[root(a_[icon])] = root(b_[icon]);
+  }
+
+  // Label each cluster by the order in which it's first seen, then bucket the
+  // constraints by label
+  std::vector<std::size_t> label(parent.size(), size());
+  std::vector<std::size_t> count;
+  std::vector<std::size_t> constraint_label(size());
+  for (std::size_t icon = 0; icon < size(); ++icon) {
+    std::size_t r = root(a_[icon]);
+    if (label[r] == size()) {
+      label[r] = count.size();
+      count.push_back(0);
+    }
+    constraint_label[icon] = label[r];
+    ++count[label[r]];
+  }
+
+  offsets_.assign(count.size() + 1, 0);
+  std::partial_sum(count.begin(), count.end(), offsets_.begin() + 1);
+  std::vector<std::size_t> position(offsets_.begin(), offsets_.end() - 1);
+  cluster_constraints_.resize(size());
+  for (std::size_t icon = 0; icon < size(); ++icon) {
+    cluster_constraints_[position[constraint_label[icon]]++] = icon;
+  }
+}
+
+// ========================================================================== //
+
+void Constraints::store(const DynamicAtomicState& state, const Cell& cell) {
+  Tensor<double, 2>::const_iterator pos = state.pos();
+#pragma omp parallel for schedule(static)
+  for (std::size_t icon = 0; icon < size(); ++icon) {
+    double dx = pos[3 * a_[icon]] - pos[3 * b_[icon]];
+    double dy = pos[3 * a_[icon] + 1] - pos[3 * b_[icon] + 1];
+    double dz = pos[3 * a_[icon] + 2] - pos[3 * b_[icon] + 2];
+    cell.min_image(dx, dy, dz);
+    ref_x_[icon] = dx;
+    ref_y_[icon] = dy;
+    ref_z_[icon] = dz;
+  }
+}
+
+// ========================================================================== //
+
+void Constraints::shake(DynamicAtomicState& state, const Cell& cell,
+                        double dt) {
+  Tensor<double, 2>::iterator pos = state.pos(), vel = state.vel();
+  const std::size_t num_clusters = offsets_.size() - 1;
+  const double inv_dt = 1 / dt;
+
+  double virial = 0;
+  bool converged = true;
+#pragma omp parallel for schedule(dynamic) reduction(+ : virial) \
+    reduction(&& : converged)
+  for (std::size_t icluster = 0; icluster < num_clusters; ++icluster) {
+    bool done = false;
+    for (std::size_t iter = 0; iter < max_iterations_ && !done; ++iter) {
+      done = true;
+      for (std::size_t idx = offsets_[icluster]; idx < offsets_[icluster + 1];
+           ++idx) {
+        const std::size_t icon = cluster_constraints_[idx];
+        const std::size_t a = a_[icon], b = b_[icon];
+        double sx = pos[3 * a] - pos[3 * b];
+        double sy = pos[3 * a + 1] - pos[3 * b + 1];
+        double sz = pos[3 * a + 2] - pos[3 * b + 2];
+        cell.min_image(sx, sy, sz);
+        double diff = dist_sq_[icon] - (sx * sx + sy * sy + sz * sz);
+        if (std::abs(diff) <= 2 * tolerance_ * dist_sq_[icon]) continue;
+        done = false;
+
+        // Move the atoms along the bond vector at the start of the step, which
+        // is the direction of the constraint force
+        double inv_ma = state.inv_mass()[a];
+        double inv_mb = state.inv_mass()[b];
+        double rx = ref_x_[icon], ry = ref_y_[icon], rz = ref_z_[icon];
+        double g = diff / (2 * (inv_ma + inv_mb) *
+                           (sx * rx + sy * ry + sz * rz));
+        pos[3 * a] += g * inv_ma * rx;
+        pos[3 * a + 1] += g * inv_ma * ry;
+        pos[3 * a + 2] += g * inv_ma * rz;
+        pos[3 * b] -= g * inv_mb * rx;
+        pos[3 * b + 1] -= g * inv_mb * ry;
+        pos[3 * b + 2] -= g * inv_mb * rz;
+        vel[3 * a] += g * inv_ma * inv_dt * rx;
+        vel[3 * a + 1] += g * inv_ma * inv_dt * ry;
+        vel[3 * a + 2] += g * inv_ma * inv_dt * rz;
+        vel[3 * b] -= g * inv_mb * inv_dt * rx;
+        vel[3 * b + 1] -= g * inv_mb * inv_dt * ry;
+        vel[3 * b + 2] -= g * inv_mb * inv_dt * rz;
+
+        // The displacement is that of a force 2g r / dt^2 acting over the half
+        // kick and drift. The constraint force over the whole step is the mean
+        // of this and that of the second half kick, hence the factor of half
+        virial += g * inv_dt * inv_dt * (rx * rx + ry * ry + rz * rz);
+      }
+    }
+    converged = converged && done;
+
+    // Corrections may have pushed atoms back out of the cell
+    for (std::size_t idx = offsets_[icluster]; idx < offsets_[icluster + 1];
+         ++idx) {
+      const std::size_t icon = cluster_constraints_[idx];
+      cell.pbc(pos[3 * a_[icon]], pos[3 * a_[icon] + 1], pos[3 * a_[icon] + 2]);
+      cell.pbc(pos[3 * b_[icon]], pos[3 * b_[icon] + 1], pos[3 * b_[icon] + 2]);
+    }
+  }
+
+  if (!converged) {
+    throw std::runtime_error("SHAKE failed to converge within " +
+                             std::to_string(max_iterations_) + " iterations.");
+  }
+  virial_ = virial;
+}
+
+// ========================================================================== //
+
+void Constraints::rattle(DynamicAtomicState& state, const Cell& cell,
+                         double dt) {
+  Tensor<double, 2>::const_iterator pos = state.pos();
+  Tensor<double, 2>::iterator vel = state.vel();
+  const std::size_t num_clusters = offsets_.size() - 1;
+  const double inv_dt = 1 / dt;
+
+  double virial = 0;
+  bool converged = true;
+#pragma omp parallel for schedule(dynamic) reduction(+ : virial) \
+    reduction(&& : converged)
+  for (std::size_t icluster = 0; icluster < num_clusters; ++icluster) {
+    bool done = false;
+    for (std::size_t iter = 0; iter < max_iterations_ && !done; ++iter) {
+      done = true;
+      for (std::size_t idx = offsets_[icluster]; idx < offsets_[icluster + 1];
+           ++idx) {
+        const std::size_t icon = cluster_constraints_[idx];
+        const std::size_t a = a_[icon], b = b_[icon];
+        double rx = pos[3 * a] - pos[3 * b];
+        double ry = pos[3 * a + 1] - pos[3 * b + 1];
+        double rz = pos[3 * a + 2] - pos[3 * b + 2];
+        cell.min_image(rx, ry, rz);
+        double rv = rx * (vel[3 * a] - vel[3 * b]) +
+                    ry * (vel[3 * a + 1] - vel[3 * b + 1]) +
+                    rz * (vel[3 * a + 2] - vel[3 * b + 2]);
+        // Relative velocity along the bond should vanish; measure it by how
+        // far it would change the distance over a timestep
+        if (std::abs(rv) * dt <= tolerance_ * dist_sq_[icon]) continue;
+        done = false;
+
+        double inv_ma = state.inv_mass()[a];
+        double inv_mb = state.inv_mass()[b];
+        double k = -rv / ((inv_ma + inv_mb) * dist_sq_[icon]);
+        vel[3 * a] += k * inv_ma * rx;
+        vel[3 * a + 1] += k * inv_ma * ry;
+        vel[3 * a + 2] += k * inv_ma * rz;
+        vel[3 * b] -= k * inv_mb * rx;
+        vel[3 * b + 1] -= k * inv_mb * ry;
+        vel[3 * b + 2] -= k * inv_mb * rz;
+
+        // The velocity change is that of a force 2k r / dt acting over the
+        // half kick, which is averaged with that of the first half kick
+        virial += k * inv_dt * dist_sq_[icon];
+      }
+    }
+    converged = converged && done;
+  }
+
+  if (!converged) {
+    throw std::runtime_error("RATTLE failed to converge within " +
+                             std::to_string(max_iterations_) + " iterations.");
+  }
+  state.add_virial(virial_ + virial);
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,104 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_CONSTRAINTS_HPP
+#define __TYCHE_INTEGRATE_CONSTRAINTS_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/topology.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Holonomic distance constraints, solved with SHAKE for the positions
+ * and RATTLE for the velocities of a Velocity Verlet integrator.
+ *
+ * Constraints are partitioned into clusters which share no atoms, e.g. the
+ * bonds of each molecule. The iterative solution of one cluster doesn't depend
+ * on any other, so the clusters are solved in parallel.
+ *
+ * The constraint forces contribute to the virial of the atomic state, which
+ * must be added after the forces have been evaluated since that resets it.
+ */
+class Constraints {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param topology The topology holding the constraints.
+   * @param tolerance Relative tolerance on each constrained distance.
+   * @param max_iterations The maximum number of iterations to spend on each
+   * cluster before giving up.
+   */
+  Constraints(std::shared_ptr<const Topology> topology, double tolerance,
+              std::size_t max_iterations);
+
+  /**
+   * @brief Store the constrained bond vectors at the start of the step, which
+   * SHAKE corrects the positions along. Must be called before the positions
+   * are updated.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void store(const DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Correct the updated positions, and the half-step velocities that
+   * were used to update them, so that all constraints are satisfied.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param dt The timestep the positions were updated over.
+   */
+  void shake(DynamicAtomicState& state, const Cell& cell, double dt);
+
+  /**
+   * @brief Correct the full-step velocities so that they have no component
+   * along any constrained bond, and add the virial of the constraint forces of
+   * the whole step to the atomic state.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param dt The timestep.
+   */
+  void rattle(DynamicAtomicState& state, const Cell& cell, double dt);
+
+  /**
+   * @brief Getter for the number of constraints, each of which removes a
+   * degree of freedom.
+   * @return The number of constraints.
+   */
+  std::size_t size() const { return a_.size(); }
+
+ protected:
+  std::shared_ptr<const Topology> topology_;
+  double tolerance_;
+  std::size_t max_iterations_;
+
+  //< Atoms and squared distance of each constraint
+  std::vector<std::size_t> a_, b_;
+  std::vector<double> dist_sq_;
+  //< Bond vector of each constraint at the start of the step
+  std::vector<double> ref_x_, ref_y_, ref_z_;
+  //< Virial of the constraint forces accumulated over the step
+  double virial_;
+
+  //< Constraints in each cluster are cluster_constraints_[offsets_[i]] to
+  //< cluster_constraints_[offsets_[i+1]]
+  std::vector<std::size_t> offsets_, cluster_constraints_;
+
+  /**
+   * @brief Partition the constraints into clusters connected through shared
+   * atoms.
+   */
+  void build_clusters();
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_CONSTRAINTS_HPP */
@@ -0,0 +1,74 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/integrate/integrate.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+void Integrate::set_adaptive_timestep(double dt_min, double dt_max,
+                                      double max_displacement) {
+  if (dt_min <= 0 || dt_max < dt_min) {
+    throw std::runtime_error(
+        "Adaptive timestep bounds must be positive, with the smallest no "
+        "larger than the largest.");
+  }
+  if (max_displacement <= 0) {
+    throw std::runtime_error(
+        "Adaptive timestep displacement must be strictly greater than zero.");
+  }
+  spdlog::info(
+      "Adapting timestep on [{}, {}]fs to displace atoms at most {}A a step.",
+      dt_min, dt_max, max_displacement);
+  dt_min_ = dt_min;
+  dt_max_ = dt_max;
+  max_displacement_ = max_displacement;
+  set_dt(std::clamp(dt_, dt_min_, dt_max_));
+}
+
+// ========================================================================== //
+
+void Integrate::end_step(const DynamicAtomicState& state) {
+  count_step();
+  adapt_timestep(state);
+}
+
+// ========================================================================== //
+
+void Integrate::adapt_timestep(const DynamicAtomicState& state) {
+  if (!max_displacement_) return;
+  const std::size_t num_atoms = state.num_atoms();
+  const double* vel = std::to_address(state.vel());
+  const double* force = std::to_address(state.force());
+  const double* inv_mass = state.inv_mass().data();
+  const double d = *max_displacement_;
+  double dt = std::numeric_limits<double>::max();
+#pragma omp parallel for simd schedule(static) reduction(min : dt)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    double vsq = 0, fsq = 0;
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      vsq += vel[idim] * vel[idim];
+      fsq += force[idim] * force[idim];
+    }
+    // Rationalised root of d = v dt + a dt^2 / 2, which is finite when the
+    // atom isn't accelerating
+    const double v = std::sqrt(vsq), a = std::sqrt(fsq) * inv_mass[iatom];
+    const double denom = v + std::sqrt(vsq + 2 * a * d);
+    if (denom > 0) dt = std::min(dt, 2 * d / denom);
+  }
+  set_dt(std::clamp(dt, dt_min_, dt_max_));
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
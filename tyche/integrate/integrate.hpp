@@ -27,7 +27,7 @@ class Integrate {
    * @param num_steps The number of integration steps to perform.
    */
   Integrate(double dt, std::size_t num_steps)
-      : dt_(dt), num_steps_(num_steps), current_step_(0) {}
+      : dt_(dt), num_steps_(num_steps), current_step_(0), time_(0) {}
 
   /**
    * @brief Virtual destructor.
@@ -46,10 +46,29 @@ class Integrate {
    * simulation forward by the time increment.
    * @param state The atomic state to propagate forwards.
    * @param forces The force evaluation object.
-   * @param cell The simulation cell for periodic boundary conditions.
+   * @param cell The simulation cell for periodic boundary conditions, which
+   * integrators at constant pressure resize.
    */
-  virtual void step(DynamicAtomicState& state, Forces& forces,
-                    const Cell& cell) = 0;
+  virtual void step(DynamicAtomicState& state, Forces& forces, Cell& cell) = 0;
+
+  /**
+   * @brief Bring the atomic state up to date with anything the integrator
+   * defers from the end of one step to the start of the next, so that it can
+   * be read between steps. Stepping on is unaffected.
+   * @param state The atomic state being propagated.
+   */
+  virtual void flush(DynamicAtomicState& state) {}
+
+  /**
+   * @brief Getter for the potential energy of the atomic state at the end of
+   * the last step, as the forces last evaluated it. Integrators which may
+   * discard their last evaluation override this.
+   * @param forces The force evaluation object stepped with.
+   * @return The potential energy.
+   */
+  virtual double potential(const Forces& forces) const {
+    return forces.potential();
+  }
 
   /**
    * @brief Getter for the time increment of the integrator.
@@ -57,6 +76,56 @@ class Integrate {
    */
   const double dt() const { return dt_; }
 
+  /**
+   * @brief Set the time increment of the integrator. Integrators with
+   * coefficients that depend on it override this to update them.
+   * @param dt The time increment in femtoseconds.
+   */
+  virtual void set_dt(double dt) { dt_ = dt; }
+
+  /**
+   * @brief Let the time increment adapt at the end of each step, so that no
+   * atom moves further than some distance over the next. Given the speed v and
+   * acceleration a of an atom, its displacement is v dt + a dt^2 / 2, so the
+   * largest time increment keeping that below the distance, d, is
+   *
+   *      dt = 2 d / (v + \sqrt{v^2 + 2 a d})
+   *
+   * The smallest of these over all atoms is used, within some bounds. Forces
+   * which depend on the time increment, such as dissipative particle dynamics,
+   * are told of it before every step through Forces::set_dt.
+   * @param dt_min The smallest time increment.
+   * @param dt_max The largest time increment.
+   * @param max_displacement The largest displacement of any atom in a step.
+   */
+  void set_adaptive_timestep(double dt_min, double dt_max,
+                             double max_displacement);
+
+  /**
+   * @brief Adapt the time increment of the next step to the velocities and
+   * forces of the atoms, if it adapts. This is done at the end of every step,
+   * but should also be done once forces are first evaluated so that the first
+   * step is covered, e.g. if atoms start out overlapping.
+   * @param state The atomic state.
+   */
+  void adapt_timestep(const DynamicAtomicState& state);
+
+  /**
+   * @brief Whether the time increment adapts at the end of each step.
+   * @return True if the time increment adapts.
+   */
+  bool adaptive() const { return max_displacement_.has_value(); }
+
+  /**
+   * @brief Advance the step counter and the simulated time over a step taken
+   * outside of the integrator, e.g. by an InterleavedVelocityVerlet stepping
+   * several replicas at once. The time increment mustn't adapt.
+   */
+  void count_step() {
+    time_ += dt_;
+    ++current_step_;
+  }
+
   /**
    * @brief Getter for the number of timesteps to integrate for.
    * @return The number of timesteps.
@@ -64,13 +133,34 @@ class Integrate {
   const std::size_t num_steps() const { return num_steps_; }
 
   /**
-   *
+   * @brief Getter for the number of timesteps integrated so far.
+   * @return The number of timesteps.
    */
   const std::size_t current_step() const { return current_step_; }
 
+  /**
+   * @brief Getter for the simulated time, which is the sum of the time
+   * increments of all steps so far, and so stays consistent with the current
+   * step when the time increment adapts.
+   * @return The simulated time in femtoseconds.
+   */
+  const double time() const { return time_; }
+
  protected:
   double dt_;
   std::size_t num_steps_, current_step_;
+  double time_;
+  //< Bounds of the time increment and largest displacement of any atom in a
+  //< step, if the time increment adapts
+  double dt_min_, dt_max_;
+  std::optional<double> max_displacement_;
+
+  /**
+   * @brief Finish a step, advancing the step counter and the simulated time,
+   * then adapting the time increment of the next step.
+   * @param state The atomic state at the end of the step.
+   */
+  void end_step(const DynamicAtomicState& state);
 };
 
 }  // namespace tyche
@@ -9,47 +9,135 @@
 // Project Inclusions
 #include "tyche/util/must.hpp"
 #include "tyche/util/maybe.hpp"
+#include "tyche/util/seed.hpp"
 #include "tyche/io/reader.hpp"
 #include "tyche/integrate/integrate_factory.hpp"
 #include "tyche/integrate/velocity_verlet.hpp"
+#include "tyche/integrate/velocity_verlet_fourth_order.hpp"
 #include "tyche/integrate/velocity_verlet_nvt_evans.hpp"
 #include "tyche/integrate/velocity_verlet_nvt_andersen.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_langevin.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_nose_hoover.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_bussi.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_hybrid_monte_carlo.hpp"
+#include "tyche/integrate/velocity_verlet_npt_berendsen.hpp"
+#include "tyche/integrate/velocity_verlet_npt_mtk.hpp"
+#include "tyche/integrate/respa.hpp"
+#include "tyche/integrate/rigid_body.hpp"
+#include "tyche/integrate/rigid_body_nvt_evans.hpp"
+#include "tyche/integrate/rigid_body_nvt_andersen.hpp"
 
 namespace tyche {
 
 // ========================================================================== //
 
-std::unique_ptr<Integrate> IntegrateFactory::create(Reader::Mapping config) {
+std::unique_ptr<Integrate> IntegrateFactory::create(
+    Reader::Mapping config, std::shared_ptr<const Topology> topology) {
   std::unique_ptr<Integrate> integrator;
   auto type = must_find<std::string>(config, "type");
   spdlog::info("Creating integrator of type: " + type);
 
   auto timestep = must_find<double>(config, "timestep");
   auto num_steps = must_find<double>(config, "num_steps");
+  const bool constrained = topology && topology->constraints.size() > 0;
   if (type == "VelocityVerlet") {
-    integrator = std::move(select_velocity_verlet(config, timestep, num_steps));
+    auto velocity_verlet =
+        select_velocity_verlet(config, timestep, num_steps, constrained);
+    if (constrained) {
+      auto tolerance = maybe_find<double>(config, "Constraints.tolerance")
+                           .value_or(default_constraint_tolerance);
+      auto max_iterations =
+          maybe_find<double>(config, "Constraints.max_iterations")
+              .value_or(default_constraint_iterations);
+      velocity_verlet->set_constraints(
+          std::make_unique<Constraints>(topology, tolerance, max_iterations));
+    }
+    integrator = std::move(velocity_verlet);
+  } else if (type == "RESPA") {
+    if (constrained) {
+      throw std::runtime_error("RESPA doesn't support constraints.");
+    }
+    auto inner_steps = must_find<double>(config, "inner_steps");
+    spdlog::info("Creating RESPA integrator with {} inner step/s.",
+                 inner_steps);
+    integrator = std::make_unique<Respa>(timestep, num_steps, inner_steps);
+  } else if (type == "RigidBody") {
+    if (constrained) {
+      throw std::runtime_error(
+          "Rigid-body integrators don't support distance constraints.");
+    }
+    integrator = select_rigid_body(config, timestep, num_steps);
   } else {
     throw std::runtime_error("Unrecognised integrator: " + type);
   }
+
+  // Optionally adapt the timestep to the motion of the atoms
+  auto max_displacement =
+      maybe_find<double>(config, "Adaptive.max_displacement");
+  if (max_displacement) {
+    integrator->set_adaptive_timestep(
+        must_find<double>(config, "Adaptive.dt_min"),
+        must_find<double>(config, "Adaptive.dt_max"), *max_displacement);
+  }
   return integrator;
 }
 
 // ========================================================================== //
 
-std::unique_ptr<Integrate> IntegrateFactory::select_velocity_verlet(
-    Reader::Mapping config, double timestep, std::size_t num_steps) {
-  std::unique_ptr<Integrate> integrator;
+std::unique_ptr<VelocityVerlet> IntegrateFactory::select_velocity_verlet(
+    Reader::Mapping config, double timestep, std::size_t num_steps,
+    bool constrained) {
+  std::unique_ptr<VelocityVerlet> integrator;
 
   auto control = maybe_find<std::string>(config, "Control.type");
+  // Higher-order compositions only conserve energy, so take no controller
+  auto scheme = maybe_find<std::string>(config, "scheme");
+  if (scheme) {
+    if (control) {
+      throw std::runtime_error(
+          "Fourth-order Velocity Verlet can't take an ensemble control.");
+    }
+    // Changing the time increment between steps loses the cancellation of
+    // errors which makes a composition fourth order
+    if (!Reader::remove_prefix(config, "Adaptive.").empty()) {
+      throw std::runtime_error(
+          "Fourth-order Velocity Verlet can't adapt its time increment.");
+    }
+    // Sub-steps with negative weights run backwards, which SHAKE and RATTLE
+    // don't handle
+    if (constrained) {
+      throw std::runtime_error(
+          "Fourth-order Velocity Verlet doesn't support constraints.");
+    }
+    VelocityVerletFourthOrder::Scheme composition;
+    if (*scheme == "Yoshida" || *scheme == "ForestRuth") {
+      composition = VelocityVerletFourthOrder::Yoshida;
+    } else if (*scheme == "Suzuki") {
+      composition = VelocityVerletFourthOrder::Suzuki;
+    } else {
+      throw std::runtime_error("Unrecognised Velocity Verlet scheme: " +
+                               *scheme);
+    }
+    spdlog::info(
+        "Creating fourth-order Velocity Verlet integrator with {} "
+        "composition.",
+        *scheme);
+    integrator = std::make_unique<VelocityVerletFourthOrder>(
+        timestep, num_steps, composition);
+    return integrator;
+  }
+
   // If there's no controller in the configuration, we just initialise a
   // regular Velocity Verlet
   if (control == std::nullopt) {
     spdlog::info("Creating Velocity Verlet integrator with no controller.");
     integrator = std::make_unique<VelocityVerlet>(timestep, num_steps);
+    return integrator;
   }
 
   // If we have a controller, it has to derive from a thermodynamic ensemble
   auto ensemble = must_find<std::string>(config, "Control.ensemble");
+  auto key = resolve_seed(config, "Control.seed");
   if (ensemble == "NVT") {
     auto temperature = must_find<double>(config, "Control.temperature");
     if (control.value() == "Evans") {
@@ -58,7 +146,7 @@ std::unique_ptr<Integrate> IntegrateFactory::select_velocity_verlet(
           "temperature {:.2f}K.",
           temperature);
       integrator = std::make_unique<VelocityVerletNVTEvans>(timestep, num_steps,
-                                                            temperature);
+                                                            temperature, key);
     } else if (control.value() == "Andersen") {
       spdlog::info(
           "Creating Velocity Verlet integrator with Andersen thermostat at "
@@ -67,15 +155,135 @@ std::unique_ptr<Integrate> IntegrateFactory::select_velocity_verlet(
       auto t_relax = must_find<double>(config, "Control.t_relax");
       auto softness = must_find<double>(config, "Control.softness");
       integrator = std::make_unique<VelocityVerletNVTAndersen>(
-          timestep, num_steps, temperature, t_relax, softness);
+          timestep, num_steps, temperature, t_relax, softness, key);
+    } else if (control.value() == "Langevin") {
+      auto t_relax = must_find<double>(config, "Control.t_relax");
+      spdlog::info("Creating BAOAB Langevin integrator at temperature {:.2f}K.",
+                   temperature);
+      integrator = std::make_unique<VelocityVerletNVTLangevin>(
+          timestep, num_steps, temperature, t_relax, key);
+    } else if (control.value() == "NoseHoover") {
+      auto t_relax = must_find<double>(config, "Control.t_relax");
+      auto chain_length = maybe_find<double>(config, "Control.chain_length")
+                              .value_or(default_chain_length);
+      spdlog::info(
+          "Creating Velocity Verlet integrator with Nose-Hoover chain of {} "
+          "thermostat/s at temperature {:.2f}K.",
+          chain_length, temperature);
+      integrator = std::make_unique<VelocityVerletNVTNoseHoover>(
+          timestep, num_steps, temperature, t_relax, chain_length, key);
+    } else if (control.value() == "Bussi") {
+      auto t_relax = must_find<double>(config, "Control.t_relax");
+      spdlog::info(
+          "Creating Velocity Verlet integrator with stochastic velocity "
+          "rescaling at temperature {:.2f}K.",
+          temperature);
+      integrator = std::make_unique<VelocityVerletNVTBussi>(
+          timestep, num_steps, temperature, t_relax, key);
+    } else if (control.value() == "HybridMonteCarlo") {
+      // Trajectories of varying time increments aren't reversible, so
+      // wouldn't be accepted with the right probability
+      if (!Reader::remove_prefix(config, "Adaptive.").empty()) {
+        throw std::runtime_error(
+            "Hybrid Monte Carlo can't adapt its time increment.");
+      }
+      // Velocities drawn afresh wouldn't satisfy the constraints
+      if (constrained) {
+        throw std::runtime_error(
+            "Hybrid Monte Carlo doesn't support constraints.");
+      }
+      auto trajectory_steps =
+          must_find<double>(config, "Control.trajectory_steps");
+      spdlog::info(
+          "Creating hybrid Monte Carlo with trajectories of {} Velocity Verlet "
+          "step/s at temperature {:.2f}K.",
+          trajectory_steps, temperature);
+      integrator = std::make_unique<VelocityVerletNVTHybridMonteCarlo>(
+          timestep, num_steps, temperature, trajectory_steps, key);
     } else {
       throw std::runtime_error("Unrecognised ensemble control: " +
                                control.value());
     }
+  } else if (ensemble == "NPT") {
+    auto temperature = must_find<double>(config, "Control.temperature");
+    auto pressure = must_find<double>(config, "Control.pressure");
+    auto t_relax = must_find<double>(config, "Control.t_relax");
+    auto p_relax = must_find<double>(config, "Control.p_relax");
+    if (control.value() == "Berendsen") {
+      auto compressibility =
+          must_find<double>(config, "Control.compressibility");
+      spdlog::info(
+          "Creating Velocity Verlet integrator with Berendsen barostat at "
+          "pressure {:.2f}bar and stochastic velocity rescaling at "
+          "temperature {:.2f}K.",
+          pressure, temperature);
+      integrator = std::make_unique<VelocityVerletNPTBerendsen>(
+          timestep, num_steps, temperature, t_relax, key, pressure, p_relax,
+          compressibility);
+    } else if (control.value() == "MTK") {
+      auto chain_length = maybe_find<double>(config, "Control.chain_length")
+                              .value_or(default_chain_length);
+      spdlog::info(
+          "Creating Velocity Verlet integrator with MTK barostat at pressure "
+          "{:.2f}bar and Nose-Hoover chain of {} thermostat/s at temperature "
+          "{:.2f}K.",
+          pressure, chain_length, temperature);
+      integrator = std::make_unique<VelocityVerletNPTMTK>(
+          timestep, num_steps, temperature, t_relax, chain_length, pressure,
+          p_relax, key);
+    } else {
+      throw std::runtime_error("Unrecognised ensemble control: " +
+                               control.value());
+    }
+  } else {
+    throw std::runtime_error("Unrecognised ensemble: " + ensemble);
   }
   return integrator;
 }
 
-// ==========================================================================
+// ========================================================================== //
+
+std::unique_ptr<RigidBody> IntegrateFactory::select_rigid_body(
+    Reader::Mapping config, double timestep, std::size_t num_steps) {
+  std::unique_ptr<RigidBody> integrator;
+
+  auto control = maybe_find<std::string>(config, "Control.type");
+  if (control == std::nullopt) {
+    spdlog::info("Creating rigid-body integrator with no controller.");
+    integrator = std::make_unique<RigidBody>(timestep, num_steps);
+    return integrator;
+  }
+
+  auto ensemble = must_find<std::string>(config, "Control.ensemble");
+  auto key = resolve_seed(config, "Control.seed");
+  if (ensemble == "NVT") {
+    auto temperature = must_find<double>(config, "Control.temperature");
+    if (control.value() == "Evans") {
+      spdlog::info(
+          "Creating rigid-body integrator with Evans thermostat at "
+          "temperature {:.2f}K.",
+          temperature);
+      integrator = std::make_unique<RigidBodyNVTEvans>(timestep, num_steps,
+                                                       temperature, key);
+    } else if (control.value() == "Andersen") {
+      spdlog::info(
+          "Creating rigid-body integrator with Andersen thermostat at "
+          "temperature {:.2f}K.",
+          temperature);
+      auto t_relax = must_find<double>(config, "Control.t_relax");
+      auto softness = must_find<double>(config, "Control.softness");
+      integrator = std::make_unique<RigidBodyNVTAndersen>(
+          timestep, num_steps, temperature, t_relax, softness, key);
+    } else {
+      throw std::runtime_error("Unrecognised ensemble control: " +
+                               control.value());
+    }
+  } else {
+    throw std::runtime_error("Unrecognised ensemble: " + ensemble);
+  }
+  return integrator;
+}
+
+// ========================================================================== //
 
 }  // namespace tyche
@@ -10,7 +10,10 @@
 //
 // Project Inclusions
 #include "tyche/io/reader.hpp"
+#include "tyche/atom/topology.hpp"
 #include "tyche/integrate/integrate.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+#include "tyche/integrate/rigid_body.hpp"
 
 namespace tyche {
 
@@ -22,9 +25,13 @@ class IntegrateFactory {
   /**
    * @brief Create an integrator from a map of parameters and their values.
    * @param config Mapping from Integrator parameter keys to values.
+   * @param topology The bonded topology of the system, whose constraints the
+   * integrator must satisfy. Optional; nullptr if the atoms aren't bonded.
    * @return The integrator.
    */
-  static std::unique_ptr<Integrate> create(Reader::Mapping config);
+  static std::unique_ptr<Integrate> create(
+      Reader::Mapping config,
+      std::shared_ptr<const Topology> topology = nullptr);
 
  private:
   /**
@@ -32,10 +39,32 @@ class IntegrateFactory {
    * @param config Mapping from Integrator parameter keys to values.
    * @param timestep The integration timestep.
    * @param num_steps The number of steps to take for the simulation.
+   * @param constrained Whether the topology has distance constraints, which
+   * the integrator must support.
    * @return The integrator.
    */
-  static std::unique_ptr<Integrate> select_velocity_verlet(
-      Reader::Mapping config, double timestep, std::size_t num_steps);
+  static std::unique_ptr<VelocityVerlet> select_velocity_verlet(
+      Reader::Mapping config, double timestep, std::size_t num_steps,
+      bool constrained);
+
+  /**
+   * @brief Create a rigid-body integrator, with the same ensemble controls as
+   * Velocity Verlet.
+   * @param config Mapping from Integrator parameter keys to values.
+   * @param timestep The integration timestep.
+   * @param num_steps The number of steps to take for the simulation.
+   * @return The integrator.
+   */
+  static std::unique_ptr<RigidBody> select_rigid_body(Reader::Mapping config,
+                                                      double timestep,
+                                                      std::size_t num_steps);
+
+  //< Default relative tolerance on constrained distances
+  static constexpr double default_constraint_tolerance = 1E-8;
+  //< Default maximum number of constraint solver iterations
+  static constexpr std::size_t default_constraint_iterations = 500;
+  //< Default number of thermostats in a Nose-Hoover chain
+  static constexpr std::size_t default_chain_length = 3;
 };
 
 }  // namespace tyche
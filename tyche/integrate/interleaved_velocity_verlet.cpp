@@ -0,0 +1,72 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/integrate/interleaved_velocity_verlet.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+const std::vector<double>& InterleavedVelocityVerlet::step(
+    InterleavedAtomicState& state, InterleavedForces& forces) {
+  kick_drift_wrap(state);
+  const auto& pot = forces.evaluate(state);
+  kick(state);
+  return pot;
+}
+
+// ========================================================================== //
+
+void InterleavedVelocityVerlet::kick_drift_wrap(
+    InterleavedAtomicState& state) const {
+  const std::size_t num_replicas = state.num_replicas();
+  double *pos = state.pos(), *vel = state.vel();
+  const double *force = state.force(), *length = state.length();
+  const double* inv_mass = state.inv_mass().data();
+  const double kick_dt = half_dt_, drift_dt = dt_;
+#pragma omp parallel for schedule(static)
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    const double k = kick_dt * inv_mass[iatom];
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      double* x = pos + idim * num_replicas;
+      double* v = vel + idim * num_replicas;
+      const double* f = force + idim * num_replicas;
+#pragma omp simd
+      for (std::size_t r = 0; r < num_replicas; ++r) {
+        v[r] += k * f[r];
+        x[r] += drift_dt * v[r];
+        x[r] -= std::floor(x[r] / length[r]) * length[r];
+      }
+    }
+  }
+}
+
+// ========================================================================== //
+
+void InterleavedVelocityVerlet::kick(InterleavedAtomicState& state) const {
+  const std::size_t num_coords = 3 * state.num_atoms();
+  const std::size_t num_replicas = state.num_replicas();
+  double* vel = state.vel();
+  const double* force = state.force();
+  const double* inv_mass = state.inv_mass().data();
+  const double kick_dt = half_dt_;
+#pragma omp parallel for schedule(static)
+  for (std::size_t idx = 0; idx < num_coords; ++idx) {
+    const double k = kick_dt * inv_mass[idx / 3];
+    double* v = vel + idx * num_replicas;
+    const double* f = force + idx * num_replicas;
+#pragma omp simd
+    for (std::size_t r = 0; r < num_replicas; ++r) {
+      v[r] += k * f[r];
+    }
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
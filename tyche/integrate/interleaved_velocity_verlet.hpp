@@ -0,0 +1,61 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_INTERLEAVED_VELOCITY_VERLET_HPP
+#define __TYCHE_INTEGRATE_INTERLEAVED_VELOCITY_VERLET_HPP
+
+// C++ Standard Libraries
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/atom/interleaved_atomic_state.hpp"
+#include "tyche/force/interleaved_force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Velocity Verlet integrator stepping every replica of an interleaved
+ * atomic state at once, with the kick and drift vectorised across replicas.
+ *
+ * The replicas share the time increment, and each is wrapped back into its
+ * own cubic cell after the drift.
+ */
+class InterleavedVelocityVerlet {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   */
+  explicit InterleavedVelocityVerlet(double dt) : dt_(dt), half_dt_(dt / 2) {}
+
+  /**
+   * @brief Propagate every replica forwards by the time increment, as
+   * VelocityVerlet::step.
+   * @param state The interleaved atomic state to propagate forwards.
+   * @param forces The interleaved force evaluation object.
+   * @return The potential energy of each replica at the end of the step.
+   */
+  const std::vector<double>& step(InterleavedAtomicState& state,
+                                  InterleavedForces& forces);
+
+ private:
+  double dt_, half_dt_;
+
+  /**
+   * @brief Advance velocities by half the time increment and positions by the
+   * whole of it, wrapping them back into the cell.
+   * @param state The interleaved atomic state.
+   */
+  void kick_drift_wrap(InterleavedAtomicState& state) const;
+
+  /**
+   * @brief Advance velocities by half the time increment.
+   * @param state The interleaved atomic state.
+   */
+  void kick(InterleavedAtomicState& state) const;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_INTERLEAVED_VELOCITY_VERLET_HPP */
@@ -0,0 +1,121 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <memory>
+#include <string>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/integrate/respa.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Respa::Respa(double dt, std::size_t num_steps, std::size_t inner_steps)
+    : Integrate(dt, num_steps),
+      inner_steps_(inner_steps),
+      inner_dt_(dt / inner_steps),
+      fast_virial_(0),
+      slow_virial_(0) {
+  if (inner_steps_ == 0) {
+    throw std::runtime_error("RESPA needs at least one inner step.");
+  }
+}
+
+// ========================================================================== //
+
+void Respa::initialise(DynamicAtomicState& state) {}
+
+// ========================================================================== //
+
+void Respa::step(DynamicAtomicState& state, Forces& forces, Cell& cell) {
+  if (forces.num_levels() > 2) {
+    throw std::runtime_error("RESPA supports force levels 0 and 1, but got " +
+                             std::to_string(forces.num_levels()) + " levels.");
+  }
+  // Each level is stepped by its own time increment
+  forces.set_dt(inner_dt_, 0);
+  forces.set_dt(dt_, 1);
+  // Forces are evaluated together before the first step, so split them
+  if (fast_force_.size() != 3 * state.num_atoms()) {
+    evaluate(state, forces, cell, 1, slow_force_, slow_virial_);
+    evaluate(state, forces, cell, 0, fast_force_, fast_virial_);
+  }
+
+  kick(state, slow_force_, dt_ / 2);
+  for (std::size_t istep = 0; istep < inner_steps_; ++istep) {
+    kick(state, fast_force_, inner_dt_ / 2);
+    drift(state, cell);
+    evaluate(state, forces, cell, 0, fast_force_, fast_virial_);
+    kick(state, fast_force_, inner_dt_ / 2);
+  }
+  evaluate(state, forces, cell, 1, slow_force_, slow_virial_);
+  kick(state, slow_force_, dt_ / 2);
+
+  // The atomic state holds the slow forces, so add the fast ones for the total
+  Tensor<double, 2>::iterator force = state.force();
+  for (std::size_t idx = 0; idx < fast_force_.size(); ++idx) {
+    force[idx] += fast_force_[idx];
+  }
+  state.add_virial(fast_virial_);
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void Respa::set_dt(double dt) {
+  dt_ = dt;
+  inner_dt_ = dt / inner_steps_;
+}
+
+// ========================================================================== //
+
+void Respa::evaluate(DynamicAtomicState& state, Forces& forces,
+                     const Cell& cell, std::size_t level,
+                     std::vector<double>& force, double& virial) {
+  forces.evaluate(state, cell, level);
+  Tensor<double, 2>::const_iterator state_force = state.force();
+  force.assign(state_force, state_force + 3 * state.num_atoms());
+  virial = state.virial();
+}
+
+// ========================================================================== //
+
+void Respa::kick(DynamicAtomicState& state, const std::vector<double>& force,
+                 double dt) {
+  const std::size_t num_atoms = state.num_atoms();
+  double* vel = std::to_address(state.vel());
+  const double* inv_mass = state.inv_mass().data();
+#pragma omp parallel for simd schedule(static)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    const double k = dt * inv_mass[iatom];
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      vel[idim] += k * force[idim];
+    }
+  }
+}
+
+// ========================================================================== //
+
+void Respa::drift(DynamicAtomicState& state, const Cell& cell) {
+  const std::size_t num_atoms = state.num_atoms();
+  double* pos = std::to_address(state.pos());
+  const double* vel = std::to_address(state.vel());
+  with_cell_type(cell, [&](const auto& concrete) {
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+        pos[idim] += vel[idim] * inner_dt_;
+      }
+      concrete.pbc(pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]);
+    }
+  });
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
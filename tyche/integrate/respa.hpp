@@ -0,0 +1,113 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_RESPA_HPP
+#define __TYCHE_INTEGRATE_RESPA_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/integrate/integrate.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Reversible reference system propagator algorithm (r-RESPA) multiple
+ * time-step integrator (Tuckerman, Berne and Martyna, J. Chem. Phys. 97, 1990
+ * (1992)).
+ *
+ * Forces at level 0 are fast-varying and integrated with Velocity Verlet at
+ * an inner timestep, dt / inner_steps. Forces at level 1 are slowly-varying,
+ * and are evaluated once per outer timestep, dt, and applied as impulses of
+ * half the outer timestep either side of the inner steps:
+ *
+ * Step 1: v += dt/2 * a_slow
+ * Step 2: repeat inner_steps times,
+ *           v += dt_in/2 * a_fast
+ *           r += dt_in * v
+ *           v += dt_in/2 * a_fast
+ * Step 3: v += dt/2 * a_slow
+ *
+ * After every step the atomic state holds the total force and virial of both
+ * levels.
+ */
+class Respa : public Integrate {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Outer time increment for simulation step, at which slow forces
+   * are evaluated.
+   * @param num_steps Number of outer integration steps to run the simulation
+   * for.
+   * @param inner_steps Number of inner steps per outer step, at which fast
+   * forces are evaluated.
+   */
+  Respa(double dt, std::size_t num_steps, std::size_t inner_steps);
+
+  /**
+   * @brief Post-construction initialisation of the atomic state; nothing to be
+   * done here.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Propagate the atomic state forwards by the outer time increment.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object, with forces at levels 0 and 1.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Set the time increment of the integrator, along with the inner time
+   * increment.
+   * @param dt The time increment in femtoseconds.
+   */
+  void set_dt(double dt) override;
+
+ private:
+  std::size_t inner_steps_;
+  double inner_dt_;
+  //< Most recent forces of each level, along with their virial
+  std::vector<double> fast_force_, slow_force_;
+  double fast_virial_, slow_virial_;
+
+  /**
+   * @brief Evaluate the forces at one level, and store them.
+   * @param state The atomic state.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param level The level of forces to evaluate.
+   * @param force Storage for the forces.
+   * @param virial Storage for the virial.
+   */
+  void evaluate(DynamicAtomicState& state, Forces& forces, const Cell& cell,
+                std::size_t level, std::vector<double>& force, double& virial);
+
+  /**
+   * @brief Advance velocities using stored forces.
+   * @param state The atomic state.
+   * @param force The forces to apply.
+   * @param dt The time increment to apply them over.
+   */
+  void kick(DynamicAtomicState& state, const std::vector<double>& force,
+            double dt);
+
+  /**
+   * @brief Advance positions by an inner time increment.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void drift(DynamicAtomicState& state, const Cell& cell);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_RESPA_HPP */
@@ -0,0 +1,473 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/util/tensor.hpp"
+#include "tyche/integrate/rigid_body.hpp"
+
+namespace tyche {
+
+namespace {
+
+//< Principal moments below this fraction of the largest are taken as zero,
+//< i.e. the axis of a linear body
+constexpr double linear_tolerance = 1E-10;
+
+/**
+ * @brief Diagonalise a symmetric 3x3 matrix with cyclic Jacobi rotations.
+ * @param a The row-major matrix, which is destroyed.
+ * @param vec The row-major matrix whose columns are the eigenvectors.
+ * @return The eigenvalues.
+ */
+std::array<double, 3> diagonalise(std::array<double, 9>& a,
+                                  std::array<double, 9>& vec) {
+  vec = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+  for (std::size_t sweep = 0; sweep < 50; ++sweep) {
+    double off = a[1] * a[1] + a[2] * a[2] + a[5] * a[5];
+    double diag = a[0] * a[0] + a[4] * a[4] + a[8] * a[8];
+    if (off <= 1E-30 * diag) break;
+    for (std::size_t p = 0; p < 2; ++p) {
+      for (std::size_t q = p + 1; q < 3; ++q) {
+        double apq = a[3 * p + q];
+        if (apq == 0) continue;
+        // Rotation angle that zeroes a[p][q]
+        double theta = (a[3 * q + q] - a[3 * p + p]) / (2 * apq);
+        double t = (theta >= 0 ? 1 : -1) /
+                   (std::abs(theta) + std::sqrt(theta * theta + 1));
+        double c = 1 / std::sqrt(t * t + 1), s = t * c;
+        for (std::size_t k = 0; k < 3; ++k) {
+          double akp = a[3 * k + p], akq = a[3 * k + q];
+          a[3 * k + p] = c * akp - s * akq;
+          a[3 * k + q] = s * akp + c * akq;
+        }
+        for (std::size_t k = 0; k < 3; ++k) {
+          double apk = a[3 * p + k], aqk = a[3 * q + k];
+          a[3 * p + k] = c * apk - s * aqk;
+          a[3 * q + k] = s * apk + c * aqk;
+        }
+        for (std::size_t k = 0; k < 3; ++k) {
+          double vkp = vec[3 * k + p], vkq = vec[3 * k + q];
+          vec[3 * k + p] = c * vkp - s * vkq;
+          vec[3 * k + q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+  return {a[0], a[4], a[8]};
+}
+
+/**
+ * @brief Rotate a vector from the body frame to the space frame.
+ * @param rot The row-major rotation matrix of the body.
+ * @param v The vector in the body frame.
+ * @return The vector in the space frame.
+ */
+std::array<double, 3> to_space(const std::array<double, 9>& rot,
+                               const std::array<double, 3>& v) {
+  return {rot[0] * v[0] + rot[1] * v[1] + rot[2] * v[2],
+          rot[3] * v[0] + rot[4] * v[1] + rot[5] * v[2],
+          rot[6] * v[0] + rot[7] * v[1] + rot[8] * v[2]};
+}
+
+/**
+ * @brief Rotate a vector from the space frame to the body frame.
+ * @param rot The row-major rotation matrix of the body.
+ * @param v The vector in the space frame.
+ * @return The vector in the body frame.
+ */
+std::array<double, 3> to_body(const std::array<double, 9>& rot,
+                              const std::array<double, 3>& v) {
+  return {rot[0] * v[0] + rot[3] * v[1] + rot[6] * v[2],
+          rot[1] * v[0] + rot[4] * v[1] + rot[7] * v[2],
+          rot[2] * v[0] + rot[5] * v[1] + rot[8] * v[2]};
+}
+
+/**
+ * @brief Cross product of two vectors.
+ * @param a The left-hand vector.
+ * @param b The right-hand vector.
+ * @return a x b.
+ */
+std::array<double, 3> cross(const std::array<double, 3>& a,
+                            const std::array<double, 3>& b) {
+  return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+          a[0] * b[1] - a[1] * b[0]};
+}
+
+}  // namespace
+
+// ========================================================================== //
+
+RigidBody::RigidBody(double dt, std::size_t num_steps)
+    : Integrate(dt, num_steps), half_dt_{dt_ / 2}, built_{false} {}
+
+// ========================================================================== //
+
+void RigidBody::initialise(DynamicAtomicState& state) {}
+
+// ========================================================================== //
+
+void RigidBody::step(DynamicAtomicState& state, Forces& forces, Cell& cell) {
+  if (!built_) build(state, cell);
+  half_step_one(state, cell);
+  forces.evaluate(state, cell);
+  half_step_two(state);
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void RigidBody::set_dt(double dt) {
+  dt_ = dt;
+  half_dt_ = dt / 2;
+}
+
+// ========================================================================== //
+
+void RigidBody::build(DynamicAtomicState& state, const Cell& cell) {
+  auto topology = state.topology();
+  if (!topology || topology->rigid_bodies.size() == 0) {
+    throw std::runtime_error(
+        "RigidBody integrator requires a Topology with rigid bodies.");
+  }
+  const auto& rigid_bodies = topology->rigid_bodies;
+  const std::size_t num_bodies = rigid_bodies.size();
+
+  bodies_.offsets.assign(1, 0);
+  bodies_.atoms.clear();
+  std::vector<bool> in_body(state.num_atoms(), false);
+  for (std::size_t ibody = 0; ibody < num_bodies; ++ibody) {
+    for (std::size_t iatom : rigid_bodies.atoms(ibody)) {
+      if (in_body[iatom]) {
+        throw std::runtime_error("Atom " + std::to_string(iatom) +
+                                 " belongs to more than one rigid body.");
+      }
+      in_body[iatom] = true;
+      bodies_.atoms.push_back(iatom);
+    }
+    bodies_.offsets.push_back(bodies_.atoms.size());
+  }
+  free_atoms_.clear();
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    if (!in_body[iatom]) free_atoms_.push_back(iatom);
+  }
+
+  bodies_.body_pos.resize(bodies_.atoms.size());
+  bodies_.mass.resize(num_bodies);
+  bodies_.inertia.resize(num_bodies);
+  bodies_.inv_inertia.resize(num_bodies);
+  bodies_.com.resize(num_bodies);
+  bodies_.momentum.resize(num_bodies);
+  bodies_.orientation.resize(num_bodies);
+  bodies_.angular_momentum.resize(num_bodies);
+  bodies_.force.resize(num_bodies);
+  bodies_.torque.resize(num_bodies);
+
+  Tensor<double, 2>::const_iterator pos = state.pos(), vel = state.vel();
+#pragma omp parallel for schedule(static)
+  for (std::size_t ibody = 0; ibody < num_bodies; ++ibody) {
+    const std::size_t begin = bodies_.offsets[ibody];
+    const std::size_t end = bodies_.offsets[ibody + 1];
+    const std::size_t first = bodies_.atoms[begin];
+
+    // Unwrap the body about its first atom, so that it may straddle the cell
+    double mass = 0;
+    std::array<double, 3> com{0, 0, 0}, momentum{0, 0, 0};
+    for (std::size_t idx = begin; idx < end; ++idx) {
+      const std::size_t iatom = bodies_.atoms[idx];
+      const double m = state.atom_type(iatom)->mass();
+      auto& d = bodies_.body_pos[idx];
+      d = {pos[3 * iatom] - pos[3 * first],
+           pos[3 * iatom + 1] - pos[3 * first + 1],
+           pos[3 * iatom + 2] - pos[3 * first + 2]};
+      cell.min_image(d[0], d[1], d[2]);
+      mass += m;
+      for (std::size_t idim = 0; idim < 3; ++idim) {
+        com[idim] += m * d[idim];
+        momentum[idim] += m * vel[3 * iatom + idim];
+      }
+    }
+    for (std::size_t idim = 0; idim < 3; ++idim) com[idim] /= mass;
+
+    // Inertia tensor and angular momentum about the centre of mass
+    std::array<double, 9> inertia{0, 0, 0, 0, 0, 0, 0, 0, 0};
+    std::array<double, 3> angular_momentum{0, 0, 0};
+    for (std::size_t idx = begin; idx < end; ++idx) {
+      const std::size_t iatom = bodies_.atoms[idx];
+      const double m = state.atom_type(iatom)->mass();
+      auto& d = bodies_.body_pos[idx];
+      for (std::size_t idim = 0; idim < 3; ++idim) d[idim] -= com[idim];
+      const double d_sq = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+      for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+          inertia[3 * i + j] += m * ((i == j ? d_sq : 0) - d[i] * d[j]);
+        }
+      }
+      auto l = cross(d, {vel[3 * iatom], vel[3 * iatom + 1],
+                         vel[3 * iatom + 2]});
+      for (std::size_t idim = 0; idim < 3; ++idim) {
+        angular_momentum[idim] += m * l[idim];
+      }
+    }
+
+    // Principal axes, as the columns of a proper rotation matrix
+    std::array<double, 9> rot;
+    auto moments = diagonalise(inertia, rot);
+    const double det =
+        rot[0] * (rot[4] * rot[8] - rot[5] * rot[7]) -
+        rot[1] * (rot[3] * rot[8] - rot[5] * rot[6]) +
+        rot[2] * (rot[3] * rot[7] - rot[4] * rot[6]);
+    if (det < 0) {
+      rot[2] = -rot[2];
+      rot[5] = -rot[5];
+      rot[8] = -rot[8];
+    }
+    const double max_moment = std::max({moments[0], moments[1], moments[2]});
+    bodies_.angular_momentum[ibody] = to_body(rot, angular_momentum);
+    for (std::size_t k = 0; k < 3; ++k) {
+      bool linear = moments[k] <= linear_tolerance * max_moment;
+      bodies_.inertia[ibody][k] = linear ? 0 : moments[k];
+      bodies_.inv_inertia[ibody][k] = linear ? 0 : 1 / moments[k];
+      if (linear) bodies_.angular_momentum[ibody][k] = 0;
+    }
+    for (std::size_t idx = begin; idx < end; ++idx) {
+      bodies_.body_pos[idx] = to_body(rot, bodies_.body_pos[idx]);
+    }
+
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      com[idim] += pos[3 * first + idim];
+    }
+    cell.pbc(com[0], com[1], com[2]);
+    bodies_.mass[ibody] = mass;
+    bodies_.com[ibody] = com;
+    bodies_.momentum[ibody] = momentum;
+    bodies_.orientation[ibody] = Quaternion::from_matrix(rot);
+  }
+
+  reduce_forces(state);
+  update_velocities(state);
+  built_ = true;
+  spdlog::info("Built {} rigid body/ies with {} degrees of freedom.",
+               num_bodies, num_dof());
+}
+
+// ========================================================================== //
+
+void RigidBody::half_step_one(DynamicAtomicState& state, const Cell& cell) {
+  half_kick(state);
+
+  // Translation
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    auto& com = bodies_.com[ibody];
+    const double k = dt_ / bodies_.mass[ibody];
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      com[idim] += k * bodies_.momentum[ibody][idim];
+    }
+    cell.pbc(com[0], com[1], com[2]);
+  }
+  Tensor<double, 2>::iterator pos = state.pos();
+  Tensor<double, 2>::const_iterator vel = state.vel();
+  for (std::size_t iatom : free_atoms_) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      pos[3 * iatom + idim] += dt_ * vel[3 * iatom + idim];
+    }
+    cell.pbc(pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]);
+  }
+
+  // Free rotation, as a symmetric sequence of exact rotations about each
+  // principal axis. Rotating the body by an angle about an axis rotates its
+  // angular momentum in the body frame by the opposite angle.
+  static constexpr std::array<std::size_t, 5> axes{0, 1, 2, 1, 0};
+  static constexpr std::array<double, 5> fractions{0.5, 0.5, 1, 0.5, 0.5};
+#pragma omp parallel for schedule(static)
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    auto& l = bodies_.angular_momentum[ibody];
+    auto& q = bodies_.orientation[ibody];
+    for (std::size_t irot = 0; irot < axes.size(); ++irot) {
+      const std::size_t k = axes[irot];
+      const std::size_t i = (k + 1) % 3, j = (k + 2) % 3;
+      const double angle =
+          fractions[irot] * dt_ * l[k] * bodies_.inv_inertia[ibody][k];
+      const double c = std::cos(angle), s = std::sin(angle);
+      const double li = l[i], lj = l[j];
+      l[i] = c * li + s * lj;
+      l[j] = -s * li + c * lj;
+      q = q * Quaternion::about_axis(k, angle);
+    }
+    q.normalise();
+  }
+
+  update_positions(state, cell);
+  update_velocities(state);
+}
+
+// ========================================================================== //
+
+void RigidBody::half_step_two(DynamicAtomicState& state) {
+  reduce_forces(state);
+  half_kick(state);
+  update_velocities(state);
+
+  // The constraint forces holding each body together contribute
+  // -sum_i d_i . f_i - 2 K_rot to the virial, where d_i is the position of an
+  // atom relative to its centre of mass and K_rot the rotational kinetic energy
+  Tensor<double, 2>::const_iterator force = state.force();
+  double virial = 0;
+#pragma omp parallel for schedule(static) reduction(+ : virial)
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    const auto rot = bodies_.orientation[ibody].matrix();
+    for (std::size_t idx = bodies_.offsets[ibody];
+         idx < bodies_.offsets[ibody + 1]; ++idx) {
+      const std::size_t iatom = bodies_.atoms[idx];
+      auto d = to_space(rot, bodies_.body_pos[idx]);
+      virial -= d[0] * force[3 * iatom] + d[1] * force[3 * iatom + 1] +
+                d[2] * force[3 * iatom + 2];
+    }
+    const auto& l = bodies_.angular_momentum[ibody];
+    const auto& inv_inertia = bodies_.inv_inertia[ibody];
+    virial -= l[0] * l[0] * inv_inertia[0] + l[1] * l[1] * inv_inertia[1] +
+              l[2] * l[2] * inv_inertia[2];
+  }
+  state.add_virial(virial);
+}
+
+// ========================================================================== //
+
+void RigidBody::scale_velocities(DynamicAtomicState& state, double scale) {
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      bodies_.momentum[ibody][idim] *= scale;
+      bodies_.angular_momentum[ibody][idim] *= scale;
+    }
+  }
+  Tensor<double, 2>::iterator vel = state.vel();
+  for (std::size_t iatom : free_atoms_) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      vel[3 * iatom + idim] *= scale;
+    }
+  }
+  update_velocities(state);
+}
+
+// ========================================================================== //
+
+void RigidBody::rescale_temperature(DynamicAtomicState& state,
+                                    double temperature) {
+  const double kinetic = state.kinetic();
+  if (kinetic == 0) return;
+  const double target = 0.5 * num_dof() * constants::boltzmann *
+                        constants::joule_to_internal * temperature;
+  scale_velocities(state, std::sqrt(target / kinetic));
+}
+
+// ========================================================================== //
+
+std::size_t RigidBody::num_dof() const {
+  std::size_t num_dof = 3 * free_atoms_.size();
+  for (const auto& inv_inertia : bodies_.inv_inertia) {
+    num_dof += 3;
+    for (double inv_moment : inv_inertia) num_dof += inv_moment > 0;
+  }
+  return num_dof;
+}
+
+// ========================================================================== //
+
+void RigidBody::half_kick(DynamicAtomicState& state) {
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      bodies_.momentum[ibody][idim] += half_dt_ * bodies_.force[ibody][idim];
+      bodies_.angular_momentum[ibody][idim] +=
+          half_dt_ * bodies_.torque[ibody][idim];
+    }
+  }
+  Tensor<double, 2>::iterator vel = state.vel();
+  Tensor<double, 2>::const_iterator force = state.force();
+  for (std::size_t iatom : free_atoms_) {
+    const double k = half_dt_ * state.inv_mass()[iatom];
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      vel[3 * iatom + idim] += k * force[3 * iatom + idim];
+    }
+  }
+}
+
+// ========================================================================== //
+
+void RigidBody::reduce_forces(const DynamicAtomicState& state) {
+  Tensor<double, 2>::const_iterator force = state.force();
+#pragma omp parallel for schedule(static)
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    const auto rot = bodies_.orientation[ibody].matrix();
+    std::array<double, 3> net{0, 0, 0}, torque{0, 0, 0};
+    for (std::size_t idx = bodies_.offsets[ibody];
+         idx < bodies_.offsets[ibody + 1]; ++idx) {
+      const std::size_t iatom = bodies_.atoms[idx];
+      std::array<double, 3> f{force[3 * iatom], force[3 * iatom + 1],
+                              force[3 * iatom + 2]};
+      auto t = cross(to_space(rot, bodies_.body_pos[idx]), f);
+      for (std::size_t idim = 0; idim < 3; ++idim) {
+        net[idim] += f[idim];
+        torque[idim] += t[idim];
+      }
+    }
+    bodies_.force[ibody] = net;
+    bodies_.torque[ibody] = to_body(rot, torque);
+  }
+}
+
+// ========================================================================== //
+
+void RigidBody::update_positions(DynamicAtomicState& state, const Cell& cell) {
+  Tensor<double, 2>::iterator pos = state.pos();
+#pragma omp parallel for schedule(static)
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    const auto rot = bodies_.orientation[ibody].matrix();
+    const auto& com = bodies_.com[ibody];
+    for (std::size_t idx = bodies_.offsets[ibody];
+         idx < bodies_.offsets[ibody + 1]; ++idx) {
+      const std::size_t iatom = bodies_.atoms[idx];
+      auto d = to_space(rot, bodies_.body_pos[idx]);
+      double* r = &pos[3 * iatom];
+      r[0] = com[0] + d[0];
+      r[1] = com[1] + d[1];
+      r[2] = com[2] + d[2];
+      cell.pbc(r[0], r[1], r[2]);
+    }
+  }
+}
+
+// ========================================================================== //
+
+void RigidBody::update_velocities(DynamicAtomicState& state) {
+  Tensor<double, 2>::iterator vel = state.vel();
+#pragma omp parallel for schedule(static)
+  for (std::size_t ibody = 0; ibody < bodies_.mass.size(); ++ibody) {
+    const auto rot = bodies_.orientation[ibody].matrix();
+    const auto& l = bodies_.angular_momentum[ibody];
+    const auto& inv_inertia = bodies_.inv_inertia[ibody];
+    auto omega = to_space(rot, {l[0] * inv_inertia[0], l[1] * inv_inertia[1],
+                                l[2] * inv_inertia[2]});
+    const double inv_mass = 1 / bodies_.mass[ibody];
+    for (std::size_t idx = bodies_.offsets[ibody];
+         idx < bodies_.offsets[ibody + 1]; ++idx) {
+      const std::size_t iatom = bodies_.atoms[idx];
+      auto v = cross(omega, to_space(rot, bodies_.body_pos[idx]));
+      for (std::size_t idim = 0; idim < 3; ++idim) {
+        vel[3 * iatom + idim] =
+            bodies_.momentum[ibody][idim] * inv_mass + v[idim];
+      }
+    }
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
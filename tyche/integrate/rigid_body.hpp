@@ -0,0 +1,175 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_RIGID_BODY_HPP
+#define __TYCHE_INTEGRATE_RIGID_BODY_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/quaternion.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/integrate/integrate.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Rigid-body integrator for the rigid bodies of the atomic state's
+ * topology.
+ *
+ * Each body is propagated through the position and momentum of its centre of
+ * mass, and its orientation, as a quaternion from the principal axis frame to
+ * the space frame, and angular momentum in the principal axis frame. Atomic
+ * forces are reduced to a net force and torque on each body, and atomic
+ * positions and velocities are rebuilt from the body after every update so
+ * that forces, thermostats and writers see a consistent atomic state.
+ *
+ * Translation follows Velocity Verlet. Free rotation is split into exact
+ * rotations about each principal axis, applied symmetrically as
+ * x(dt/2) y(dt/2) z(dt) y(dt/2) x(dt/2), which is symplectic and
+ * time-reversible (Dullweber, Leimkuhler and McLachlan, J. Chem. Phys. 107,
+ * 5840 (1997)). Atoms outside of any body are integrated with Velocity Verlet.
+ */
+class RigidBody : public Integrate {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   */
+  RigidBody(double dt, std::size_t num_steps);
+
+  /**
+   * @brief Post-construction initialisation of the atomic state; nothing to be
+   * done here since the bodies are built on the first step.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Set the time increment of the integrator, along with its half.
+   * @param dt The time increment in femtoseconds.
+   */
+  void set_dt(double dt) override;
+
+ protected:
+  double half_dt_;
+  bool built_;
+
+  /**
+   * @brief State of all rigid bodies.
+   */
+  struct Bodies {
+    //< Atoms of body i are atoms[offsets[i]] to atoms[offsets[i+1]]
+    std::vector<std::size_t> offsets, atoms;
+    //< Position of each atom relative to the centre of mass, in the principal
+    //< axis frame
+    std::vector<std::array<double, 3>> body_pos;
+    //< Total mass of each body
+    std::vector<double> mass;
+    //< Principal moments of inertia and their inverses, the latter of which
+    //< is zero about the axis of a linear body
+    std::vector<std::array<double, 3>> inertia, inv_inertia;
+    //< Centre of mass position and momentum
+    std::vector<std::array<double, 3>> com, momentum;
+    //< Orientation, and angular momentum in the principal axis frame
+    std::vector<Quaternion> orientation;
+    std::vector<std::array<double, 3>> angular_momentum;
+    //< Net force, and torque in the principal axis frame
+    std::vector<std::array<double, 3>> force, torque;
+  } bodies_;
+  //< Atoms that aren't part of any rigid body
+  std::vector<std::size_t> free_atoms_;
+
+  /**
+   * @brief Build bodies from the topology, atomic positions and atomic
+   * velocities, and the net force and torque on each from the atomic forces.
+   * Called on the first step, when the cell and forces are available.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  virtual void build(DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Advance momenta by half a timestep and positions by a timestep,
+   * using forces at the current time increment.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void half_step_one(DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Advance momenta by half a timestep using forces at the next time
+   * increment.
+   * @param state The atomic state.
+   */
+  void half_step_two(DynamicAtomicState& state);
+
+  /**
+   * @brief Scale all momenta, angular momenta and free atom velocities by
+   * the same factor, e.g. for thermostatting.
+   * @param state The atomic state.
+   * @param scale The factor to scale by.
+   */
+  void scale_velocities(DynamicAtomicState& state, double scale);
+
+  /**
+   * @brief Scale all velocities so that the kinetic temperature over the
+   * degrees of freedom of the bodies and free atoms is as given.
+   * @param state The atomic state.
+   * @param temperature The temperature to scale to.
+   */
+  void rescale_temperature(DynamicAtomicState& state, double temperature);
+
+  /**
+   * @brief Getter for the number of degrees of freedom of the bodies and free
+   * atoms.
+   * @return The number of degrees of freedom.
+   */
+  std::size_t num_dof() const;
+
+  /**
+   * @brief Set atomic velocities from the bodies.
+   * @param state The atomic state.
+   */
+  void update_velocities(DynamicAtomicState& state);
+
+ private:
+  /**
+   * @brief Advance body momenta and angular momenta, and free atom velocities,
+   * by half a timestep.
+   * @param state The atomic state.
+   */
+  void half_kick(DynamicAtomicState& state);
+
+  /**
+   * @brief Reduce atomic forces onto the net force and torque of each body.
+   * @param state The atomic state.
+   */
+  void reduce_forces(const DynamicAtomicState& state);
+
+  /**
+   * @brief Set atomic positions from the bodies.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void update_positions(DynamicAtomicState& state, const Cell& cell);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_RIGID_BODY_HPP */
@@ -0,0 +1,112 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/util/tensor.hpp"
+#include "tyche/integrate/rigid_body_nvt_andersen.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+RigidBodyNVTAndersen::RigidBodyNVTAndersen(double dt, std::size_t num_steps,
+                                           double temperature, double t_relax,
+                                           double softness, std::uint64_t seed)
+    : RigidBody(dt, num_steps),
+      Thermostat(temperature, seed),
+      t_relax_(t_relax),
+      softness_(softness),
+      mix_new_(std::sqrt(1 - softness * softness)),
+      random_(seed, RandomStream::Andersen) {}
+
+// ========================================================================== //
+
+void RigidBodyNVTAndersen::initialise(DynamicAtomicState& state) {
+  initialise_velocities(state);
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTAndersen::step(DynamicAtomicState& state, Forces& forces,
+                                Cell& cell) {
+  if (!built_) build(state, cell);
+  half_step_one(state, cell);
+  forces.evaluate(state, cell);
+  half_step_two(state);
+  thermostat(state);
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTAndersen::build(DynamicAtomicState& state,
+                                 const Cell& cell) {
+  RigidBody::build(state, cell);
+  rescale_temperature(state, temp_);
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTAndersen::thermostat(DynamicAtomicState& state) {
+  const std::size_t num_bodies = bodies_.mass.size();
+  const std::size_t num_free = free_atoms_.size();
+  collide_.resize(num_bodies + num_free);
+  random_.fill_uniform(3 * current_step_, collide_.data(), collide_.size());
+
+  // Probability of a collision for each body or free atom at this timestep
+  const double prob_collision = 1 - std::exp(-dt_ / t_relax_);
+  const double kt = constants::boltzmann * constants::joule_to_internal * temp_;
+
+#pragma omp parallel for schedule(static)
+  for (std::size_t ibody = 0; ibody < num_bodies; ++ibody) {
+    if (collide_[ibody] > prob_collision) continue;
+    double normal[6];
+    for (std::size_t k = 0; k < 3; ++k) {
+      auto pair = random_.normal(3 * current_step_ + 1, 3 * ibody + k);
+      normal[2 * k] = pair[0];
+      normal[2 * k + 1] = pair[1];
+    }
+    const double pscale = std::sqrt(kt * bodies_.mass[ibody]);
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      auto& p = bodies_.momentum[ibody][idim];
+      p = softness_ * p + mix_new_ * pscale * normal[idim];
+      // No angular momentum about the axis of a linear body
+      auto& l = bodies_.angular_momentum[ibody][idim];
+      const double lscale = std::sqrt(kt * bodies_.inertia[ibody][idim]);
+      l = softness_ * l + mix_new_ * lscale * normal[3 + idim];
+    }
+  }
+
+  Tensor<double, 2>::iterator vel = state.vel();
+#pragma omp parallel for schedule(static)
+  for (std::size_t ifree = 0; ifree < num_free; ++ifree) {
+    if (collide_[num_bodies + ifree] > prob_collision) continue;
+    const std::size_t iatom = free_atoms_[ifree];
+    auto xy = random_.normal(3 * current_step_ + 2, 2 * iatom);
+    auto z = random_.normal(3 * current_step_ + 2, 2 * iatom + 1);
+    const double normal[3] = {xy[0], xy[1], z[0]};
+    const double vscale = std::sqrt(kt * state.inv_mass()[iatom]);
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      auto& v = vel[3 * iatom + idim];
+      v = softness_ * v + mix_new_ * vscale * normal[idim];
+    }
+  }
+  update_velocities(state);
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTAndersen::set_temperature(DynamicAtomicState& state,
+                                           double temp) {
+  if (built_) scale_velocities(state, std::sqrt(temp / temp_));
+  temp_ = temp;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
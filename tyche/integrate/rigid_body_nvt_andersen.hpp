@@ -0,0 +1,107 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_RIGID_BODY_NVT_ANDERSEN_HPP
+#define __TYCHE_INTEGRATE_RIGID_BODY_NVT_ANDERSEN_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/rigid_body.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Rigid-body integrator using the Andersen thermostat, where each body
+ * collides with fictitious particles which transfer both linear and angular
+ * momentum.
+ */
+class RigidBodyNVTAndersen : public RigidBody, public Thermostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param temperature The kinetic temperature to keep constant during
+   * simulation.
+   * @param t_relax Amount of time between collisions.
+   * @param softness How much of the body's momenta to retain during collision
+   * event.
+   * @param seed Seed of the random numbers.
+   */
+  RigidBodyNVTAndersen(double dt, std::size_t num_steps, double temperature,
+                       double t_relax, double softness, std::uint64_t seed);
+
+  /**
+   * @brief Various post-construction initialisation tasks for the atomic state.
+   *
+   * For this case, atomic velocities will be initialised from the
+   * Maxwell-Boltzmann distribution at a given temperature. The part of them
+   * that isn't rigid motion is removed when the bodies are built.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment with
+   * Andersen thermostat.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Change the temperature of the heat bath. Once the bodies are
+   * built, atomic velocities follow them, so their momenta, angular momenta
+   * and the velocities of free atoms are scaled instead; before, the bodies
+   * are rescaled to the new temperature when built.
+   * @param state The atomic state being thermostatted.
+   * @param temp The new temperature to maintain.
+   */
+  void set_temperature(DynamicAtomicState& state, double temp) override;
+
+ protected:
+  /**
+   * @brief Build the bodies, then rescale their velocities to the temperature
+   * of the thermostat.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void build(DynamicAtomicState& state, const Cell& cell) override;
+
+ private:
+  double t_relax_;
+  double softness_, mix_new_;
+  Philox random_;
+  //< Uniform random numbers deciding which bodies, then free atoms, collide
+  //< this step
+  std::vector<double> collide_;
+
+  /**
+   * @brief Thermostat using the Andersen thermostat. Each body that collides
+   * mixes its momentum with that of a fictitious body drawn from the
+   * Maxwell-Boltzmann distribution, and likewise its angular momentum about
+   * each principal axis; free atoms are treated as in Velocity Verlet.
+   *
+   * Collisions are decided by a bulk draw of uniform numbers at counter
+   * (3 * step, index / 2). The new momenta of a body are drawn at
+   * (3 * step + 1, 3 * body + k) and the new velocity of a free atom at
+   * (3 * step + 2, 2 * atom + k), so bodies and atoms are thermostatted in
+   * parallel reproducibly.
+   * @param state The atomic state to thermostat.
+   */
+  void thermostat(DynamicAtomicState& state);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_RIGID_BODY_NVT_ANDERSEN_HPP */
@@ -0,0 +1,79 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <limits>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/integrate/rigid_body_nvt_evans.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+RigidBodyNVTEvans::RigidBodyNVTEvans(double dt, std::size_t num_steps,
+                                     double temperature, std::uint64_t seed)
+    : RigidBody(dt, num_steps), Thermostat(temperature, seed) {}
+
+// ========================================================================== //
+
+void RigidBodyNVTEvans::initialise(DynamicAtomicState& state) {
+  initialise_velocities(state);
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTEvans::step(DynamicAtomicState& state, Forces& forces,
+                             Cell& cell) {
+  if (!built_) build(state, cell);
+  thermostat(state);
+  half_step_one(state, cell);
+  forces.evaluate(state, cell);
+  half_step_two(state);
+  thermostat(state);
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTEvans::build(DynamicAtomicState& state, const Cell& cell) {
+  RigidBody::build(state, cell);
+  rescale_temperature(state, temp_);
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTEvans::thermostat(DynamicAtomicState& state) {
+  scale_velocities(state, std::exp(-chi(state) * half_dt_));
+}
+
+// ========================================================================== //
+
+double RigidBodyNVTEvans::chi(DynamicAtomicState& state) {
+  double power = 0;
+  Tensor<double, 2>::const_iterator vel = state.vel(), force = state.force();
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      power += *vel++ * *force++;
+    }
+  }
+  // If velocities are just zero-initialised, then we need to avoid the
+  // division by zero
+  return 0.5 * power /
+         (state.kinetic() + std::numeric_limits<double>::epsilon());
+}
+
+// ========================================================================== //
+
+void RigidBodyNVTEvans::set_temperature(DynamicAtomicState& state,
+                                        double temp) {
+  if (built_) scale_velocities(state, std::sqrt(temp / temp_));
+  temp_ = temp;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
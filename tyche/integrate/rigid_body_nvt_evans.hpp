@@ -0,0 +1,95 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_RIGID_BODY_NVT_EVANS_HPP
+#define __TYCHE_INTEGRATE_RIGID_BODY_NVT_EVANS_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/rigid_body.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Rigid-body integrator using the Evans thermostat, which holds the
+ * translational and rotational kinetic energy of the bodies, along with that
+ * of any free atoms, constant.
+ */
+class RigidBodyNVTEvans : public RigidBody, public Thermostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param temperature The kinetic temperature to keep constant during
+   * simulation.
+   * @param seed Seed of the random numbers of the initial velocities.
+   */
+  RigidBodyNVTEvans(double dt, std::size_t num_steps, double temperature,
+                    std::uint64_t seed);
+
+  /**
+   * @brief Various post-construction initialisation tasks for the atomic state.
+   *
+   * For this case, atomic velocities will be initialised from the
+   * Maxwell-Boltzmann distribution at a given temperature. The part of them
+   * that isn't rigid motion is removed when the bodies are built.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment with
+   * Evans thermostat.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Change the temperature of the heat bath. Once the bodies are
+   * built, atomic velocities follow them, so their momenta, angular momenta
+   * and the velocities of free atoms are scaled instead; before, the bodies
+   * are rescaled to the new temperature when built.
+   * @param state The atomic state being thermostatted.
+   * @param temp The new temperature to maintain.
+   */
+  void set_temperature(DynamicAtomicState& state, double temp) override;
+
+ protected:
+  /**
+   * @brief Build the bodies, then rescale their velocities to the temperature
+   * of the thermostat.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void build(DynamicAtomicState& state, const Cell& cell) override;
+
+  /**
+   * @brief Thermostat the bodies and free atoms using the kinetic temperature
+   * constraint, chi.
+   * @param state The atomic state to thermostat.
+   */
+  void thermostat(DynamicAtomicState& state);
+
+  /**
+   * @brief Compute the kinetic temperature constraint at an instant. Since
+   * atomic velocities follow the bodies, the atomic power sum_i v_i . f_i is
+   * that of the net forces and torques, sum_I V_I . F_I + w_I . T_I.
+   * @param state The atomic state to thermostat.
+   * @return The kinetic temperature constraint.
+   */
+  double chi(DynamicAtomicState& state);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_RIGID_BODY_NVT_EVANS_HPP */
@@ -2,7 +2,7 @@
  * @brief
  */
 // C++ Standard Libraries
-//
+#include <memory>
 // Third-Party Libraries
 //
 // Project Inclusions
@@ -23,45 +23,84 @@ void VelocityVerlet::initialise(DynamicAtomicState& state) {}
 // ========================================================================== //
 
 void VelocityVerlet::step(DynamicAtomicState& state, Forces& forces,
-                          const Cell& cell) {
+                          Cell& cell) {
   half_step_one(state, cell);
   forces.evaluate(state, cell);
   half_step_two(state, cell);
-  ++current_step_;
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerlet::set_dt(double dt) {
+  dt_ = dt;
+  half_dt_ = dt / 2;
 }
 
 // ========================================================================== //
 
-void VelocityVerlet::half_step_one(DynamicAtomicState& state,
-                                   const Cell& cell) {
-  Tensor<double, 2>::iterator pos = state.pos(), vel = state.vel();
-  Tensor<double, 2>::const_iterator force = state.force();
+void VelocityVerlet::half_step_one(DynamicAtomicState& state, const Cell& cell,
+                                   double scale) {
+  if (constraints_) constraints_->store(state, cell);
   // Advance velocity by half timestep and position by full timestep
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
-    double k = half_dt_ / state.atom_type(iatom)->mass();
-    for (std::size_t idim = 0; idim < 3; ++idim) {
-      *vel += k * *force++;
-      pos[idim] += *vel++ * dt_;
-    }
-    // Apply periodic boundary conditions
-    cell.pbc(pos[0], pos[1], pos[2]);
-    pos += 3;
-  }
+  kick_drift_wrap(state, cell, scale, half_dt_, 1, dt_);
+  if (constraints_) constraints_->shake(state, cell, dt_);
 }
 
 // ========================================================================== //
 
-void VelocityVerlet::half_step_two(DynamicAtomicState& state,
-                                   const Cell& cell) {
-  Tensor<double, 2>::iterator vel = state.vel();
-  Tensor<double, 2>::const_iterator force = state.force();
+double VelocityVerlet::half_step_two(DynamicAtomicState& state,
+                                     const Cell& cell) {
   // Advance velocity to full timestep
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
-    double k = half_dt_ / state.atom_type(iatom)->mass();
-    for (std::size_t idim = 0; idim < 3; ++idim) {
-      *vel++ += k * *force++;
+  double kinetic = kick(state, 1, half_dt_);
+  if (constraints_) constraints_->rattle(state, cell, dt_);
+  return kinetic;
+}
+
+// ========================================================================== //
+
+void VelocityVerlet::kick_drift_wrap(DynamicAtomicState& state,
+                                     const Cell& cell, double vel_scale,
+                                     double kick_dt, double pos_scale,
+                                     double drift_dt) {
+  const std::size_t num_atoms = state.num_atoms();
+  double* pos = std::to_address(state.pos());
+  double* vel = std::to_address(state.vel());
+  const double* force = std::to_address(state.force());
+  const double* inv_mass = state.inv_mass().data();
+  with_cell_type(cell, [&](const auto& concrete) {
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      const double k = kick_dt * inv_mass[iatom];
+      for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+        vel[idim] = vel_scale * vel[idim] + k * force[idim];
+        pos[idim] = pos_scale * pos[idim] + drift_dt * vel[idim];
+      }
+      concrete.pbc(pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]);
+    }
+  });
+}
+
+// ========================================================================== //
+
+double VelocityVerlet::kick(DynamicAtomicState& state, double vel_scale,
+                            double kick_dt) {
+  const std::size_t num_atoms = state.num_atoms();
+  double* vel = std::to_address(state.vel());
+  const double* force = std::to_address(state.force());
+  const double *mass = state.mass().data(), *inv_mass = state.inv_mass().data();
+  double kinetic = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : kinetic)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    const double k = kick_dt * inv_mass[iatom];
+    double vsq = 0;
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      vel[idim] = vel_scale * vel[idim] + k * force[idim];
+      vsq += vel[idim] * vel[idim];
     }
+    kinetic += mass[iatom] * vsq;
   }
+  return 0.5 * kinetic;
 }
 
 // ========================================================================== //
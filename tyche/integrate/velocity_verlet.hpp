@@ -5,6 +5,7 @@
 #define __TYCHE_INTEGRATE_VELOCITY_VERLET_HPP
 
 // C++ Standard Libraries
+#include <memory>
 #include <cstdint>
 // Third-Party Libraries
 //
@@ -13,6 +14,7 @@
 #include "tyche/atom/dynamic_atomic_state.hpp"
 #include "tyche/force/force.hpp"
 #include "tyche/integrate/integrate.hpp"
+#include "tyche/integrate/constraints.hpp"
 
 namespace tyche {
 
@@ -49,11 +51,32 @@ class VelocityVerlet : public Integrate {
    * @param forces The force evaluation object.
    * @param cell The simulation cell for periodic boundary conditions.
    */
-  virtual void step(DynamicAtomicState& state, Forces& forces,
-                    const Cell& cell);
+  virtual void step(DynamicAtomicState& state, Forces& forces, Cell& cell);
+
+  /**
+   * @brief Set the time increment of the integrator, along with its half.
+   * @param dt The time increment in femtoseconds.
+   */
+  void set_dt(double dt) override;
+
+  /**
+   * @brief Hold some bonds at a fixed length during propagation, using SHAKE
+   * for the positions and RATTLE for the velocities.
+   * @param constraints The constraints to satisfy.
+   */
+  void set_constraints(std::unique_ptr<Constraints> constraints) {
+    constraints_ = std::move(constraints);
+  }
+
+  /**
+   * @brief Whether any bonds are held at a fixed length.
+   * @return True if there are constraints.
+   */
+  bool constrained() const { return constraints_ != nullptr; }
 
  protected:
   double half_dt_;
+  std::unique_ptr<Constraints> constraints_;
 
   /**
    * @brief Propagate the atomic state forwards by the time increment using
@@ -62,10 +85,15 @@ class VelocityVerlet : public Integrate {
    * Step 1: v(t + dt/2) = v(t) + dt/2 * a(t)
    * Step 2: r(t + dt) = r(t) + dt * v(t + dt/2)
    *
+   * If there are constraints, the positions and half-step velocities are then
+   * corrected to satisfy them.
    * @param state The atomic state to propagate forwards.
    * @param cell The simulation cell for periodic boundary conditions.
+   * @param scale Factor to scale velocities by before step 1, so that a
+   * thermostat can rescale them without another pass over the atoms.
    */
-  void half_step_one(DynamicAtomicState& state, const Cell& cell);
+  void half_step_one(DynamicAtomicState& state, const Cell& cell,
+                     double scale = 1);
 
   /**
    * @brief Propagate the atomic state forwards by the time increment using
@@ -73,10 +101,44 @@ class VelocityVerlet : public Integrate {
    *
    * Step 3: v(t + dt) = v(t + dt/2) + dt/2 * a(t + dt)
    *
+   * If there are constraints, the velocities are then corrected to satisfy
+   * them, and the constraint virial is added to the atomic state.
    * @param state The atomic state to propagate forwards.
    * @param cell The simulation cell for periodic boundary conditions.
+   * @return The kinetic energy, accumulated in the same pass as step 3. This
+   * excludes any correction from constraints.
+   */
+  double half_step_two(DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Kick, drift and wrap every atom in one threaded and vectorised sweep
+   * over contiguous arrays:
+   *
+   * v <- vel_scale * v + kick_dt * f / m
+   * r <- pos_scale * r + drift_dt * v
+   *
+   * after which periodic boundary conditions are applied to r.
+   * @param state The atomic state to propagate.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param vel_scale Factor to scale velocities by before the kick.
+   * @param kick_dt Time increment of the kick.
+   * @param pos_scale Factor to scale positions by before the drift.
+   * @param drift_dt Time increment of the drift.
+   */
+  static void kick_drift_wrap(DynamicAtomicState& state, const Cell& cell,
+                              double vel_scale, double kick_dt,
+                              double pos_scale, double drift_dt);
+
+  /**
+   * @brief Kick every atom in one threaded and vectorised sweep over contiguous
+   * arrays, v <- vel_scale * v + kick_dt * f / m.
+   * @param state The atomic state to propagate.
+   * @param vel_scale Factor to scale velocities by before the kick.
+   * @param kick_dt Time increment of the kick.
+   * @return The kinetic energy after the kick.
    */
-  void half_step_two(DynamicAtomicState& state, const Cell& cell);
+  static double kick(DynamicAtomicState& state, double vel_scale,
+                     double kick_dt);
 };
 
 }  // namespace tyche
@@ -0,0 +1,49 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/integrate/velocity_verlet_fourth_order.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+VelocityVerletFourthOrder::VelocityVerletFourthOrder(double dt,
+                                                     std::size_t num_steps,
+                                                     Scheme scheme)
+    : VelocityVerlet(dt, num_steps) {
+  if (scheme == Yoshida) {
+    const double outer = 1 / (2 - std::cbrt(2.0));
+    weights_ = {outer, 1 - 2 * outer, outer};
+  } else if (scheme == Suzuki) {
+    const double outer = 1 / (4 - std::cbrt(4.0));
+    weights_ = {outer, outer, 1 - 4 * outer, outer, outer};
+  } else {
+    throw std::runtime_error("Unrecognised fourth-order composition.");
+  }
+}
+
+// ========================================================================== //
+
+void VelocityVerletFourthOrder::step(DynamicAtomicState& state, Forces& forces,
+                                     Cell& cell) {
+  const double dt = dt_;
+  for (double weight : weights_) {
+    VelocityVerlet::set_dt(weight * dt);
+    half_step_one(state, cell);
+    forces.evaluate(state, cell);
+    half_step_two(state, cell);
+  }
+  // Restore the time increment before it's added to the simulated time
+  VelocityVerlet::set_dt(dt);
+  end_step(state);
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,83 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_FOURTH_ORDER_HPP
+#define __TYCHE_INTEGRATE_VELOCITY_VERLET_FOURTH_ORDER_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Fourth-order symplectic integrator, composed of Velocity Verlet
+ * sub-steps whose time increments are fractions w_i of the time increment,
+ * summing to one.
+ *
+ * Velocity Verlet is symmetric and second order, so chaining sub-steps with
+ * suitable weights cancels its third-order error, leaving an error of fourth
+ * order that's still symplectic and time reversible. Each step costs one force
+ * evaluation per sub-step, but for smooth potentials the time increment can
+ * grow enough that fewer forces are evaluated per unit simulated time for the
+ * same energy conservation.
+ *
+ * The Yoshida (or Forest-Ruth) triple jump takes three sub-steps, with
+ *
+ *      w_1 = w_3 = 1 / (2 - 2^{1/3}),   w_2 = 1 - 2 w_1
+ *
+ * so the middle one steps backwards in time. Suzuki's fractal takes five
+ * sub-steps, with
+ *
+ *      w_1 = w_2 = w_4 = w_5 = 1 / (4 - 4^{1/3}),   w_3 = 1 - 4 w_1
+ *
+ * which costs more per step but has a much smaller error, as no sub-step is
+ * longer than the time increment (H. Yoshida, Phys. Lett. A 150, 262 (1990);
+ * M. Suzuki, Phys. Lett. A 146, 319 (1990)).
+ */
+class VelocityVerletFourthOrder : public VelocityVerlet {
+ public:
+  /**
+   * @brief Compositions of Velocity Verlet sub-steps.
+   */
+  enum Scheme { Yoshida = 0, Suzuki };
+
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param scheme The composition of sub-steps.
+   */
+  VelocityVerletFourthOrder(double dt, std::size_t num_steps,
+                            Scheme scheme = Yoshida);
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment with a
+   * Velocity Verlet sub-step for each weight of the composition, evaluating
+   * the forces after each.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Getter for the fractions of the time increment of the sub-steps.
+   * @return The weights of the sub-steps.
+   */
+  const std::vector<double>& weights() const { return weights_; }
+
+ protected:
+  std::vector<double> weights_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_FOURTH_ORDER_HPP */
@@ -0,0 +1,49 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/util/constants.hpp"
+#include "tyche/integrate/velocity_verlet_npt_berendsen.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+VelocityVerletNPTBerendsen::VelocityVerletNPTBerendsen(
+    double dt, std::size_t num_steps, double temperature, double t_relax,
+    std::uint64_t seed, double pressure, double p_relax,
+    double compressibility)
+    : VelocityVerletNVTBussi(dt, num_steps, temperature, t_relax, seed),
+      Barostat(pressure),
+      coupling_(compressibility / constants::bar_to_internal / p_relax) {}
+
+// ========================================================================== //
+
+void VelocityVerletNPTBerendsen::step(DynamicAtomicState& state,
+                                      Forces& forces, Cell& cell) {
+  CubicCell& cubic = Barostat::cubic(cell);
+  // The step may adapt the timestep of the next
+  const double dt = dt_;
+  VelocityVerletNVTBussi::step(state, forces, cell);
+
+  // Kinetic energy is that before the thermostat rescales it at the start of
+  // the next step, matching the virial from the last force evaluation
+  double current =
+      Barostat::pressure(*kinetic_, state.virial(), cubic.volume());
+  double scale = std::cbrt(1 - coupling_ * dt * (pressure_ - current));
+  cubic.scale(scale);
+  Tensor<double, 2>::iterator pos = state.pos();
+#pragma omp parallel for simd schedule(static)
+  for (std::size_t idx = 0; idx < 3 * state.num_atoms(); ++idx) {
+    pos[idx] *= scale;
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,73 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NPT_BERENDSEN_HPP
+#define __TYCHE_INTEGRATE_VELOCITY_VERLET_NPT_BERENDSEN_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/barostat.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_bussi.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Velocity-Verlet integrator using the weak-coupling barostat of
+ * Berendsen et al. (J. Chem. Phys. 81, 3684 (1984)), with the temperature held
+ * by stochastic velocity rescaling.
+ *
+ * At the end of each step the cell and atomic positions are scaled by
+ *
+ *      \mu = [1 - \beta dt / \tau_P (P_0 - P)]^{1/3},
+ *
+ * so the pressure relaxes exponentially towards the target. The pressure comes
+ * from the kinetic energy of the final kick and the virial of the force
+ * evaluation, so only the scaling itself costs a pass over the atoms. This
+ * relaxes the pressure quickly and robustly, but doesn't sample the correct
+ * volume fluctuations of the NPT ensemble; it suits equilibration.
+ */
+class VelocityVerletNPTBerendsen : public VelocityVerletNVTBussi,
+                                   public Barostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param temperature The temperature of the heat bath.
+   * @param t_relax Relaxation time of the kinetic energy.
+   * @param seed Seed of the random numbers of the thermostat.
+   * @param pressure The pressure of the bath, in bar.
+   * @param p_relax Relaxation time of the pressure.
+   * @param compressibility Isothermal compressibility of the system, in
+   * inverse bar.
+   */
+  VelocityVerletNPTBerendsen(double dt, std::size_t num_steps,
+                             double temperature, double t_relax,
+                             std::uint64_t seed, double pressure,
+                             double p_relax, double compressibility);
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment using the
+   * Velocity Verlet method with stochastic velocity rescaling, then rescale
+   * the cell towards the target pressure.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell, which must be cubic.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+ protected:
+  //< Rate of change in relative volume per unit pressure difference,
+  //< \beta / \tau_P
+  double coupling_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NPT_BERENDSEN_HPP */
@@ -0,0 +1,119 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/integrate/velocity_verlet_npt_mtk.hpp"
+
+namespace tyche {
+
+namespace {
+
+/**
+ * @brief Compute sinh(x) / x, by its Taylor series where x is so small that
+ * the quotient loses precision.
+ * @param x The argument.
+ * @return sinh(x) / x.
+ */
+double sinhc(double x) {
+  return std::abs(x) < 1E-4 ? 1 + x * x / 6 : std::sinh(x) / x;
+}
+
+}  // namespace
+
+// ========================================================================== //
+
+VelocityVerletNPTMTK::VelocityVerletNPTMTK(double dt, std::size_t num_steps,
+                                           double temperature, double t_relax,
+                                           std::size_t chain_length,
+                                           double pressure, double p_relax,
+                                           std::uint64_t seed)
+    : VelocityVerletNVTNoseHoover(dt, num_steps, temperature, t_relax,
+                                  chain_length, seed),
+      Barostat(pressure),
+      p_relax_(p_relax),
+      baro_mass_(0),
+      v_eps_(0),
+      alpha_(1) {}
+
+// ========================================================================== //
+
+void VelocityVerletNPTMTK::step(DynamicAtomicState& state, Forces& forces,
+                                Cell& cell) {
+  CubicCell& cubic = Barostat::cubic(cell);
+  double scale = 1;
+  if (!kinetic_) {
+    // The atoms have every degree of freedom less the centre of mass motion and
+    // any constraints, and the chain is also coupled to the barostat's one
+    std::size_t num_atom_dof = 3 * state.num_atoms() - 3;
+    if (constraints_) num_atom_dof -= constraints_->size();
+    alpha_ = 1 + 3.0 / num_atom_dof;
+    baro_mass_ = (num_atom_dof + 3) * kt_ * p_relax_ * p_relax_;
+    num_dof_ = num_atom_dof + 1;
+    mass_[0] = num_dof_ * kt_ * t_relax_ * t_relax_;
+    for (std::size_t k = 1; k < mass_.size(); ++k) {
+      mass_[k] = kt_ * t_relax_ * t_relax_;
+    }
+    kinetic_ = state.kinetic();
+  } else {
+    // Half-step deferred from the end of the last step
+    scale = thermostat_half_step(*kinetic_, last_half_dt_);
+  }
+  scale *= thermostat_half_step(*kinetic_, half_dt_);
+  barostat_half_step(*kinetic_, state.virial(), cubic.volume());
+
+  // The barostat damps the velocities over each kick, and scales the positions
+  // along with the cell over the drift
+  const double a = alpha_ * v_eps_ * half_dt_;
+  const double kick_scale = std::exp(-a);
+  const double kick_force = std::exp(-a / 2) * sinhc(a / 2) * half_dt_;
+  const double b = v_eps_ * dt_;
+  const double drift_scale = std::exp(b);
+  const double drift_vel = std::exp(b / 2) * sinhc(b / 2) * dt_;
+  cubic.scale(drift_scale);
+
+  if (constraints_) constraints_->store(state, cell);
+  kick_drift_wrap(state, cell, scale * kick_scale, kick_force, drift_scale,
+                  drift_vel);
+  if (constraints_) constraints_->shake(state, cell, dt_);
+
+  forces.evaluate(state, cell);
+
+  kinetic_ = kick(state, kick_scale, kick_force);
+  if (constraints_) {
+    constraints_->rattle(state, cell, dt_);
+    kinetic_ = state.kinetic();
+  }
+
+  barostat_half_step(*kinetic_, state.virial(), cubic.volume());
+  last_half_dt_ = half_dt_;
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNPTMTK::barostat_half_step(double kinetic, double virial,
+                                              double volume) {
+  v_eps_ += half_dt_ *
+            (2 * alpha_ * kinetic + virial - 3 * volume * pressure_) /
+            baro_mass_;
+}
+
+// ========================================================================== //
+
+double VelocityVerletNPTMTK::thermostat_half_step(double& kinetic,
+                                                  double half_dt) {
+  double total = kinetic + 0.5 * baro_mass_ * v_eps_ * v_eps_;
+  double scale = chain_half_step(total, half_dt);
+  kinetic *= scale * scale;
+  v_eps_ *= scale;
+  return scale;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,98 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NPT_MTK_HPP
+#define __TYCHE_INTEGRATE_VELOCITY_VERLET_NPT_MTK_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/barostat.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_nose_hoover.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Velocity-Verlet integrator for the isotropic NPT ensemble of Martyna,
+ * Tobias and Klein (J. Chem. Phys. 101, 4177 (1994)), using the reversible
+ * factorisation of Tuckerman et al. (J. Phys. A 39, 5629 (2006)).
+ *
+ * The logarithm of the cell volume is a dynamical variable with a velocity and
+ * a mass, driven by the difference between the instantaneous and target
+ * pressures. Its motion scales the atomic velocities in each kick and the
+ * positions and cell in the drift, which are applied exactly within the same
+ * loops as plain Velocity Verlet. A single Nose-Hoover chain thermostats both
+ * the atoms and the barostat, with the half-step at the end of each step
+ * deferred to the start of the next, as in VelocityVerletNVTNoseHoover.
+ */
+class VelocityVerletNPTMTK : public VelocityVerletNVTNoseHoover,
+                             public Barostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param temperature The temperature of the heat bath.
+   * @param t_relax Period of the thermostat's oscillations.
+   * @param chain_length Number of thermostats in the chain.
+   * @param pressure The pressure of the bath, in bar.
+   * @param p_relax Period of the barostat's oscillations, which sets its mass.
+   * @param seed Seed of the random numbers of the initial velocities.
+   */
+  VelocityVerletNPTMTK(double dt, std::size_t num_steps, double temperature,
+                       double t_relax, std::size_t chain_length,
+                       double pressure, double p_relax, std::uint64_t seed);
+
+  /**
+   * @brief Propagate the atomic state and cell forwards by the time increment.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell, which must be cubic.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Getter for the energy of the barostat, its kinetic energy plus the
+   * work P V done against the bath. Added to the total energy of the atoms and
+   * the energy of the thermostat chain, this is conserved by the dynamics.
+   * @param cell The simulation cell.
+   * @return The energy of the barostat.
+   */
+  double barostat_energy(const Cell& cell) const {
+    return 0.5 * baro_mass_ * v_eps_ * v_eps_ + pressure_ * cell.volume();
+  }
+
+ protected:
+  double p_relax_;
+  //< Mass and velocity of the logarithm of the volume, over three
+  double baro_mass_, v_eps_;
+  //< Coupling of the barostat to the atomic velocities, 1 + 3 / N_f
+  double alpha_;
+
+  /**
+   * @brief Propagate the barostat velocity by half a timestep.
+   * @param kinetic The kinetic energy of the atoms.
+   * @param virial The virial of the last force evaluation.
+   * @param volume The volume of the cell.
+   */
+  void barostat_half_step(double kinetic, double virial, double volume);
+
+  /**
+   * @brief Propagate the thermostat chain by half a timestep, coupled to both
+   * the atoms and the barostat, and scale the barostat velocity.
+   * @param kinetic The kinetic energy of the atoms, which is updated to that
+   * after scaling.
+   * @param half_dt Half of the timestep.
+   * @return The factor to scale the atomic velocities by.
+   */
+  double thermostat_half_step(double& kinetic, double half_dt);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NPT_MTK_HPP */
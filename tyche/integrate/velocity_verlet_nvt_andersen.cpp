@@ -3,7 +3,6 @@
  */
 // C++ Standard Libraries
 #include <cmath>
-#include <random>
 // Third-Party Libraries
 //
 // Project Inclusions
@@ -19,12 +18,14 @@ VelocityVerletNVTAndersen::VelocityVerletNVTAndersen(double dt,
                                                      std::size_t num_steps,
                                                      double temperature,
                                                      double t_relax,
-                                                     double softness)
+                                                     double softness,
+                                                     std::uint64_t seed)
     : VelocityVerlet(dt, num_steps),
-      Thermostat(temperature),
+      Thermostat(temperature, seed),
       t_relax_(t_relax),
       softness_(softness),
-      mix_new_(std::sqrt(1 - softness * softness)) {}
+      mix_new_(std::sqrt(1 - softness * softness)),
+      random_(seed, RandomStream::Andersen) {}
 
 // ========================================================================== //
 
@@ -35,43 +36,44 @@ void VelocityVerletNVTAndersen::initialise(DynamicAtomicState& state) {
 // ========================================================================== //
 
 void VelocityVerletNVTAndersen::step(DynamicAtomicState& state, Forces& forces,
-                                     const Cell& cell) {
+                                     Cell& cell) {
   half_step_one(state, cell);
   forces.evaluate(state, cell);
   half_step_two(state, cell);
   thermostat(state);
-  ++current_step_;
+  end_step(state);
 }
 
 // ========================================================================== //
 
 void VelocityVerletNVTAndersen::thermostat(DynamicAtomicState& state) {
-  std::random_device rd;
-  std::mt19937 generator(rd());
-  std::uniform_real_distribution<double> uniform(0.0, 1.0);
-  std::normal_distribution<double> normal(0.0, 1.0);
+  const std::size_t num_atoms = state.num_atoms();
+  collide_.resize(num_atoms);
+  random_.fill_uniform(2 * current_step_, collide_.data(), num_atoms);
 
   // Probability of a collision for each particle at this timestep
   const double prob_collision = 1 - std::exp(-dt_ / t_relax_);
 
   Tensor<double, 2>::iterator vel = state.vel();
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+#pragma omp parallel for schedule(static)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
     // If a collision has occured, do momentum transfer with fictitious particle
-    if (uniform(generator) <= prob_collision) {
-      // Is this correct? The DL POLY manual says the denominator should be (2 *
-      // mass), but this just damps the instantaneous temperature way below what
-      // it should be. The following appears to give qualitatively decent
-      // results.
-      const double vscale =
-          std::sqrt(constants::boltzmann * constants::joule_to_internal *
-                    temp_ / (state.atom_type(iatom)->mass()));
-      // Mix velocity with that of fictitious particle
-      for (std::size_t idim = 0; idim < 3; ++idim) {
-        double vnew = vscale * normal(generator);
-        vel[idim] = softness_ * vel[idim] + mix_new_ * vnew;
-      }
+    if (collide_[iatom] > prob_collision) continue;
+    // Is this correct? The DL POLY manual says the denominator should be (2 *
+    // mass), but this just damps the instantaneous temperature way below what
+    // it should be. The following appears to give qualitatively decent
+    // results.
+    const double vscale =
+        std::sqrt(constants::boltzmann * constants::joule_to_internal * temp_ *
+                  state.inv_mass()[iatom]);
+    auto xy = random_.normal(2 * current_step_ + 1, 2 * iatom);
+    auto z = random_.normal(2 * current_step_ + 1, 2 * iatom + 1);
+    const double vnew[3] = {xy[0], xy[1], z[0]};
+    // Mix velocity with that of fictitious particle
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      auto& v = vel[3 * iatom + idim];
+      v = softness_ * v + mix_new_ * vscale * vnew[idim];
     }
-    vel += 3;
   }
 }
 
@@ -5,10 +5,12 @@
 #define __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_ANDERSEN_HPP
 
 // C++ Standard Libraries
+#include <vector>
 #include <cstdint>
 // Third-Party Libraries
 //
 // Project Inclusions
+#include "tyche/util/random.hpp"
 #include "tyche/system/cell.hpp"
 #include "tyche/atom/dynamic_atomic_state.hpp"
 #include "tyche/force/force.hpp"
@@ -32,10 +34,11 @@ class VelocityVerletNVTAndersen : public VelocityVerlet, public Thermostat {
    * @param t_relax Amount of time between collisions.
    * @param softness How much of the particle's velocity to retain during
    * collision event.
+   * @param seed Seed of the random numbers.
    */
   VelocityVerletNVTAndersen(double dt, std::size_t num_steps,
                             double temperature, double t_relax,
-                            double softness);
+                            double softness, std::uint64_t seed);
 
   /**
    * @brief Various post-construction initialisation tasks for the atomic state.
@@ -53,11 +56,14 @@ class VelocityVerletNVTAndersen : public VelocityVerlet, public Thermostat {
    * @param forces The force evaluation object.
    * @param cell The simulation cell for periodic boundary conditions.
    */
-  void step(DynamicAtomicState& state, Forces& forces, const Cell& cell);
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell);
 
  private:
   double t_relax_;
   double softness_, mix_new_;
+  Philox random_;
+  //< Uniform random numbers deciding which atoms collide this step
+  std::vector<double> collide_;
 
   /**
    * @brief Thermostat the atomic velocities using the Andersen thermostat.
@@ -66,6 +72,11 @@ class VelocityVerletNVTAndersen : public VelocityVerlet, public Thermostat {
    * fictitious particle whose velocity is taken from the Maxwell-Boltzmann
    * distribution. If it does, mix the fictitious particle's velocity with the
    * actual particle's velocity, i.e. momentum transfer during collision.
+   *
+   * Whether each atom collides is decided by a bulk draw of uniform numbers at
+   * counter (2 * step, atom / 2), and the new velocity of an atom that does by
+   * those at (2 * step + 1, 2 * atom) and (2 * step + 1, 2 * atom + 1), so the
+   * atoms are thermostatted in parallel reproducibly.
    * @param state The atomic state to thermostat.
    */
   void thermostat(DynamicAtomicState& state);
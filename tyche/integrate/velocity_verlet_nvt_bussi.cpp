@@ -0,0 +1,105 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_bussi.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+VelocityVerletNVTBussi::VelocityVerletNVTBussi(double dt,
+                                               std::size_t num_steps,
+                                               double temperature,
+                                               double t_relax,
+                                               std::uint64_t seed)
+    : VelocityVerlet(dt, num_steps),
+      Thermostat(temperature, seed),
+      t_relax_(t_relax),
+      decay_(std::exp(-dt / t_relax)),
+      random_(seed, RandomStream::Bussi),
+      num_dof_(0),
+      target_kinetic_(0),
+      thermostat_energy_(0) {}
+
+// ========================================================================== //
+
+void VelocityVerletNVTBussi::initialise(DynamicAtomicState& state) {
+  initialise_velocities(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTBussi::step(DynamicAtomicState& state, Forces& forces,
+                                  Cell& cell) {
+  if (!kinetic_) {
+    // Rescaling conserves the centre of mass motion and any constraints
+    num_dof_ = 3 * state.num_atoms() - 3;
+    if (constraints_) num_dof_ -= constraints_->size();
+    target_kinetic_ = 0.5 * num_dof_ * constants::boltzmann *
+                      constants::joule_to_internal * temp_;
+    kinetic_ = state.kinetic();
+  }
+
+  half_step_one(state, cell, rescale(*kinetic_));
+  forces.evaluate(state, cell);
+  kinetic_ = half_step_two(state, cell);
+  if (constraints_) kinetic_ = state.kinetic();
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTBussi::set_dt(double dt) {
+  VelocityVerlet::set_dt(dt);
+  decay_ = std::exp(-dt / t_relax_);
+}
+
+// ========================================================================== //
+
+double VelocityVerletNVTBussi::rescale(double kinetic) {
+  if (kinetic <= 0) return 1;
+
+  // Sum of num_dof_ squared standard normals, r1^2 + chi^2_{num_dof_ - 1},
+  // where the latter is twice a Gamma variate
+  const double r1 = random_.normal(2 * current_step_ + 1, 0)[0];
+  const double chi_sq =
+      num_dof_ > 1 ? 2 * random_.gamma(0.5 * (num_dof_ - 1), 2 * current_step_)
+                   : 0;
+  const double noise = (r1 * r1 + chi_sq) / num_dof_;
+  const double new_kinetic =
+      kinetic + (1 - decay_) * (target_kinetic_ * noise - kinetic) +
+      2 * r1 *
+          std::sqrt(decay_ * (1 - decay_) * kinetic * target_kinetic_ /
+                    num_dof_);
+  thermostat_energy_ -= new_kinetic - kinetic;
+
+  // Velocities reverse in the rare case the noise takes the kinetic energy
+  // through zero
+  double scale = std::sqrt(new_kinetic / kinetic);
+  if (r1 + std::sqrt(decay_ * num_dof_ * kinetic /
+                     ((1 - decay_) * target_kinetic_)) <
+      0) {
+    scale = -scale;
+  }
+  return scale;
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTBussi::set_temperature(DynamicAtomicState& state,
+                                             double temp) {
+  const double ratio = temp / temp_;
+  Thermostat::set_temperature(state, temp);
+  target_kinetic_ *= ratio;
+  if (kinetic_) *kinetic_ *= ratio;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,113 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_BUSSI_HPP
+#define __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_BUSSI_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <optional>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Velocity-Verlet integrator using the stochastic velocity rescaling
+ * thermostat of Bussi, Donadio and Parrinello (J. Chem. Phys. 126, 014101
+ * (2007)), which samples the NVT ensemble by rescaling all velocities so the
+ * kinetic energy follows a stochastic differential equation with the canonical
+ * distribution as its steady state.
+ *
+ * The rescaling is applied once per step and needs only the total kinetic
+ * energy, one normal and one Gamma-distributed random number. The kinetic
+ * energy comes out of the final kick of each step, and the scale factor is
+ * folded into the first kick of the next, so there are no extra passes over
+ * the atoms. The state between steps is therefore taken just before each
+ * rescaling.
+ */
+class VelocityVerletNVTBussi : public VelocityVerlet, public Thermostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param temperature The temperature of the heat bath.
+   * @param t_relax Relaxation time of the kinetic energy.
+   * @param seed Seed of the random numbers.
+   */
+  VelocityVerletNVTBussi(double dt, std::size_t num_steps, double temperature,
+                         double t_relax, std::uint64_t seed);
+
+  /**
+   * @brief Various post-construction initialisation tasks for the atomic state.
+   *
+   * For this case, atomic velocities will be initialised from the
+   * Maxwell-Boltzmann distribution at a given temperature.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment using the
+   * Velocity Verlet method with stochastic velocity rescaling.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Getter for the energy the thermostat has taken out of the atoms.
+   * Added to the total energy of the atoms, this is conserved by the dynamics.
+   * @return The energy of the thermostat.
+   */
+  double thermostat_energy() const { return thermostat_energy_; }
+
+  /**
+   * @brief Set the time increment of the integrator, along with the decay
+   * factor of the kinetic energy.
+   * @param dt The time increment in femtoseconds.
+   */
+  void set_dt(double dt) override;
+
+  /**
+   * @brief Change the temperature of the heat bath, scaling the velocities
+   * along with the target kinetic energy and that carried over from the last
+   * step.
+   * @param state The atomic state being thermostatted.
+   * @param temp The new temperature to maintain.
+   */
+  void set_temperature(DynamicAtomicState& state, double temp) override;
+
+ protected:
+  double t_relax_;
+  //< Decay factor of the kinetic energy over a timestep, \exp(-dt / \tau)
+  double decay_;
+  Philox random_;
+  //< Number of degrees of freedom coupled to the thermostat, and the average
+  //< kinetic energy over them at the target temperature
+  std::size_t num_dof_;
+  double target_kinetic_, thermostat_energy_;
+  //< Kinetic energy of the atoms at the end of the last step
+  std::optional<double> kinetic_;
+
+  /**
+   * @brief Draw the factor to rescale velocities by from the current kinetic
+   * energy, and account for the energy it exchanges with the heat bath.
+   * @param kinetic The kinetic energy of the atoms.
+   * @return The factor to scale velocities by.
+   */
+  double rescale(double kinetic);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_BUSSI_HPP */
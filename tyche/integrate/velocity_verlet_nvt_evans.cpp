@@ -4,6 +4,7 @@
 // C++ Standard Libraries
 #include <cmath>
 #include <limits>
+#include <memory>
 // Third-Party Libraries
 //
 // Project Inclusions
@@ -15,53 +16,118 @@ namespace tyche {
 // ========================================================================== //
 
 VelocityVerletNVTEvans::VelocityVerletNVTEvans(double dt, std::size_t num_steps,
-                                               double temperature)
-    : VelocityVerlet(dt, num_steps), Thermostat(temperature) {}
+                                               double temperature,
+                                               std::uint64_t seed)
+    : VelocityVerlet(dt, num_steps),
+      Thermostat(temperature, seed),
+      closing_(1) {}
 
 // ========================================================================== //
 
 void VelocityVerletNVTEvans::initialise(DynamicAtomicState& state) {
   initialise_velocities(state);
+  chi_.reset();
 }
 
 // ========================================================================== //
 
 void VelocityVerletNVTEvans::step(DynamicAtomicState& state, Forces& forces,
-                                  const Cell& cell) {
-  thermostat(state);
-  half_step_one(state, cell);
+                                  Cell& cell) {
+  // The closing half-step of the last step scales velocities by some factor,
+  // which scales chi of the opening half-step of this one by its inverse
+  double scale;
+  if (chi_) {
+    scale = closing_ * std::exp(-*chi_ / closing_ * half_dt_);
+  } else {
+    scale = std::exp(-chi(state) * half_dt_);
+  }
+  half_step_one(state, cell, scale);
   forces.evaluate(state, cell);
-  half_step_two(state, cell);
-  thermostat(state);
-  ++current_step_;
+  chi_ = kick_chi(state);
+  if (constraints_) {
+    constraints_->rattle(state, cell, dt_);
+    chi_ = chi(state);
+  }
+  closing_ = std::exp(-*chi_ * half_dt_);
+
+  // Nothing follows the last step to take the closing half-step, and adapting
+  // the time increment reads the velocities
+  if (current_step_ + 1 >= num_steps_ || adaptive()) flush(state);
+  end_step(state);
 }
 
 // ========================================================================== //
 
-void VelocityVerletNVTEvans::thermostat(DynamicAtomicState& state) {
-  double scale = std::exp(-chi(state) * half_dt_);
-  Tensor<double, 2>::iterator vel = state.vel();
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
-    for (std::size_t idim = 0; idim < 3; ++idim) {
-      *vel++ *= scale;
+double VelocityVerletNVTEvans::chi(DynamicAtomicState& state) {
+  const std::size_t num_atoms = state.num_atoms();
+  const double* vel = std::to_address(state.vel());
+  const double* force = std::to_address(state.force());
+  const double* mass = state.mass().data();
+  // Power, and twice the kinetic energy
+  double power = 0, mv2 = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : power, mv2)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    double vf = 0, vsq = 0;
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      vf += vel[idim] * force[idim];
+      vsq += vel[idim] * vel[idim];
     }
+    power += vf;
+    mv2 += mass[iatom] * vsq;
   }
+  // If velocities are just zero-initialised, then we need to avoid the
+  // division by zero
+  return power / (mv2 + std::numeric_limits<double>::epsilon());
 }
 
 // ========================================================================== //
 
-double VelocityVerletNVTEvans::chi(DynamicAtomicState& state) {
-  double power = 0;
-  Tensor<double, 2>::const_iterator vel = state.vel(), force = state.force();
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
-    for (std::size_t idim = 0; idim < 3; ++idim) {
-      power += *vel++ * *force++;
+double VelocityVerletNVTEvans::kick_chi(DynamicAtomicState& state) {
+  const std::size_t num_atoms = state.num_atoms();
+  double* vel = std::to_address(state.vel());
+  const double* force = std::to_address(state.force());
+  const double *mass = state.mass().data(), *inv_mass = state.inv_mass().data();
+  // Power, and twice the kinetic energy
+  double power = 0, mv2 = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : power, mv2)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    const double k = half_dt_ * inv_mass[iatom];
+    double vf = 0, vsq = 0;
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      vel[idim] += k * force[idim];
+      vf += vel[idim] * force[idim];
+      vsq += vel[idim] * vel[idim];
     }
+    power += vf;
+    mv2 += mass[iatom] * vsq;
   }
-  // If velocities are just zero-initialised, then we need to avoid the
-  // division by zero
-  return 0.5 * power /
-         (state.kinetic() + std::numeric_limits<double>::epsilon());
+  return power / (mv2 + std::numeric_limits<double>::epsilon());
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTEvans::thermostat(DynamicAtomicState& state,
+                                        double scale) {
+  const std::size_t num_values = 3 * state.num_atoms();
+  double* vel = std::to_address(state.vel());
+#pragma omp parallel for simd schedule(static)
+  for (std::size_t idx = 0; idx < num_values; ++idx) vel[idx] *= scale;
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTEvans::flush(DynamicAtomicState& state) {
+  if (!chi_) return;
+  thermostat(state, closing_);
+  chi_.reset();
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTEvans::set_temperature(DynamicAtomicState& state,
+                                             double temp) {
+  flush(state);
+  Thermostat::set_temperature(state, temp);
 }
 
 // ========================================================================== //
@@ -6,6 +6,7 @@
 
 // C++ Standard Libraries
 #include <cstdint>
+#include <optional>
 // Third-Party Libraries
 //
 // Project Inclusions
@@ -21,6 +22,16 @@ namespace tyche {
  * @brief Velocity-Verlet integrator using the Evans thermostat, where Ekin is
  * maintained as an integration constant (i.e. technically it generates
  * trajectories in the NVEkin ensemble).
+ *
+ * The thermostat is split into half-steps either side of the Velocity Verlet
+ * step. Rather than making extra passes over the atoms, the power and kinetic
+ * energy that chi needs are accumulated in the closing kick of each step, and
+ * the closing half-step of the thermostat is deferred and applied alongside
+ * the opening half-step of the next, in its kick. The trajectory is unchanged,
+ * but between steps the velocities are those before the closing half-step of
+ * the thermostat until flush() applies it, which anything reading them between
+ * steps must call first. The last step, and every step when the time increment
+ * adapts to the velocities, applies it itself.
  */
 class VelocityVerletNVTEvans : public VelocityVerlet, public Thermostat {
  public:
@@ -30,8 +41,10 @@ class VelocityVerletNVTEvans : public VelocityVerlet, public Thermostat {
    * @param num_steps Number of integration steps to run the simulation for.
    * @param temperature The kinetic temperature to keep constant during
    * simulation.
+   * @param seed Seed of the random numbers of the initial velocities.
    */
-  VelocityVerletNVTEvans(double dt, std::size_t num_steps, double temperature);
+  VelocityVerletNVTEvans(double dt, std::size_t num_steps, double temperature,
+                         std::uint64_t seed);
 
   /**
    * @brief Various post-construction initialisation tasks for the atomic state.
@@ -49,18 +62,35 @@ class VelocityVerletNVTEvans : public VelocityVerlet, public Thermostat {
    * @param forces The force evaluation object.
    * @param cell The simulation cell for periodic boundary conditions.
    */
-  void step(DynamicAtomicState& state, Forces& forces, const Cell& cell);
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell);
 
- protected:
   /**
-   * @brief Thermostat the atomic velocities using the kinetic temperature
-   * constraint, chi.
-   * @param state The atomic state to thermostat.
+   * @brief Take the closing half-step of the thermostat deferred from the last
+   * step, if it hasn't been taken, so that the velocities are at the kinetic
+   * temperature.
+   * @param state The atomic state being thermostatted.
+   */
+  void flush(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Change the kinetic temperature to keep constant. The velocities
+   * are flushed first, so the next step starts afresh from the scaled
+   * velocities.
+   * @param state The atomic state being thermostatted.
+   * @param temp The new temperature to maintain.
    */
-  void thermostat(DynamicAtomicState& state);
+  void set_temperature(DynamicAtomicState& state, double temp) override;
+
+ protected:
+  //< Kinetic temperature constraint at the end of the last step, before its
+  //< closing half-step of the thermostat was applied, and the factor that
+  //< half-step scales velocities by
+  std::optional<double> chi_;
+  double closing_;
 
   /**
-   * @brief Compute the kinetic temperature constraint at an instant:
+   * @brief Compute the kinetic temperature constraint at an instant, in a
+   * single pass over the atoms:
    *
    *      \chi(t) = \frac{\sum_i v_i(t) \cdot f_i(t)}{\sum_i m_i v_i(t)^2}
    *              = \frac{\sum_i v_i(t) \cdot f_i(t)}{2 \cdot E_kin}
@@ -69,6 +99,22 @@ class VelocityVerletNVTEvans : public VelocityVerlet, public Thermostat {
    * @return The kinetic temperature constraint.
    */
   double chi(DynamicAtomicState& state);
+
+  /**
+   * @brief Advance velocities to the full timestep, as in step 3 of Velocity
+   * Verlet, accumulating the kinetic temperature constraint of the new
+   * velocities in the same pass.
+   * @param state The atomic state to propagate forwards.
+   * @return The kinetic temperature constraint.
+   */
+  double kick_chi(DynamicAtomicState& state);
+
+  /**
+   * @brief Thermostat the atomic velocities by scaling them.
+   * @param state The atomic state to thermostat.
+   * @param scale The factor to scale velocities by.
+   */
+  void thermostat(DynamicAtomicState& state, double scale);
 };
 
 }  // namespace tyche
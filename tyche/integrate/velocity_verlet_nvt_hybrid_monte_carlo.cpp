@@ -0,0 +1,114 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_hybrid_monte_carlo.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+VelocityVerletNVTHybridMonteCarlo::VelocityVerletNVTHybridMonteCarlo(
+    double dt, std::size_t num_steps, double temperature,
+    std::size_t trajectory_steps, std::uint64_t seed)
+    : VelocityVerlet(dt, num_steps),
+      Thermostat(temperature, seed),
+      trajectory_steps_(trajectory_steps),
+      random_(seed, RandomStream::HybridMonteCarlo),
+      accepted_(0),
+      virial_(0) {
+  if (trajectory_steps_ == 0) {
+    throw std::runtime_error(
+        "Hybrid Monte Carlo needs at least one step per trajectory.");
+  }
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTHybridMonteCarlo::initialise(DynamicAtomicState& state) {
+  initialise_velocities(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTHybridMonteCarlo::step(DynamicAtomicState& state,
+                                             Forces& forces, Cell& cell) {
+  if (!potential_) potential_ = forces.evaluate(state, cell);
+  draw_velocities(state);
+  snapshot(state, false);
+
+  const double initial = *potential_ + state.kinetic();
+  double potential = 0, kinetic = 0;
+  for (std::size_t istep = 0; istep < trajectory_steps_; ++istep) {
+    half_step_one(state, cell);
+    potential = forces.evaluate(state, cell);
+    kinetic = half_step_two(state, cell);
+  }
+
+  const double kt = constants::boltzmann * constants::joule_to_internal * temp_;
+  const double delta = potential + kinetic - initial;
+  if (delta <= 0 ||
+      random_.uniform(2 * current_step_ + 1, 0)[0] < std::exp(-delta / kt)) {
+    potential_ = potential;
+    ++accepted_;
+  } else {
+    snapshot(state, true);
+  }
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTHybridMonteCarlo::draw_velocities(
+    DynamicAtomicState& state) {
+  const std::size_t num_atoms = state.num_atoms();
+  double* vel = std::to_address(state.vel());
+  const double* inv_mass = state.inv_mass().data();
+  random_.fill_normal(2 * current_step_, vel, 3 * num_atoms);
+  const double kt = constants::boltzmann * constants::joule_to_internal * temp_;
+#pragma omp parallel for simd schedule(static)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    const double vscale = std::sqrt(kt * inv_mass[iatom]);
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      vel[idim] *= vscale;
+    }
+  }
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTHybridMonteCarlo::snapshot(DynamicAtomicState& state,
+                                                 bool restore) {
+  const std::size_t num_atoms = state.num_atoms();
+  if (pos_.size(0) != num_atoms) {
+    pos_ = Tensor<double, 2>(num_atoms, 3);
+    vel_ = Tensor<double, 2>(num_atoms, 3);
+    force_ = Tensor<double, 2>(num_atoms, 3);
+  }
+  const std::size_t size = 3 * num_atoms;
+  if (restore) {
+    std::copy(pos_.begin(), pos_.end(), state.pos());
+    std::copy(vel_.begin(), vel_.end(), state.vel());
+    // The virial can only be added to, so is zeroed along with the forces
+    state.zero_forces();
+    std::copy(force_.begin(), force_.end(), state.force());
+    state.add_virial(virial_);
+  } else {
+    std::copy(state.pos(), state.pos() + size, pos_.begin());
+    std::copy(state.vel(), state.vel() + size, vel_.begin());
+    std::copy(state.force(), state.force() + size, force_.begin());
+    virial_ = state.virial();
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
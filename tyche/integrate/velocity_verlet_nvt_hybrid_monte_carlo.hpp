@@ -0,0 +1,130 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_HYBRID_MONTE_CARLO_HPP
+#define __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_HYBRID_MONTE_CARLO_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <optional>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/util/tensor.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Hybrid Monte Carlo (Duane et al., Phys. Lett. B 195, 216 (1987)),
+ * sampling the NVT ensemble with trajectories of Velocity Verlet.
+ *
+ * Each step draws every velocity afresh from the Maxwell-Boltzmann
+ * distribution, then integrates a short trajectory in the NVE ensemble and
+ * accepts its end with probability min(1, \exp(-\Delta H / kT)), where \Delta
+ * H is the change in total energy over the trajectory. Velocity Verlet is
+ * time reversible and conserves volume in phase space, so this samples the
+ * canonical ensemble exactly whatever the time increment, which only sets how
+ * often trajectories are accepted. Time increments well beyond those that
+ * conserve energy in molecular dynamics then decorrelate samples in far fewer
+ * force evaluations.
+ *
+ * On rejection, the positions, velocities, forces and virial return to those
+ * at the start of the trajectory, which are copied into storage that's kept
+ * across steps, so nothing is reallocated. The potential energy at the end of
+ * an accepted trajectory is kept as that at the start of the next, so each
+ * step costs one force evaluation for each step of its trajectory.
+ *
+ * Velocities are drawn at counter (2 * step, atom pair) of the hybrid Monte
+ * Carlo stream, and the acceptance at (2 * step + 1, 0). Constraints aren't
+ * supported, as the drawn velocities wouldn't satisfy them.
+ */
+class VelocityVerletNVTHybridMonteCarlo : public VelocityVerlet,
+                                          public Thermostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment of the steps of each trajectory.
+   * @param num_steps Number of trajectories to run the simulation for.
+   * @param temperature The temperature to sample at.
+   * @param trajectory_steps Number of steps of each trajectory.
+   * @param seed Seed of the random numbers.
+   */
+  VelocityVerletNVTHybridMonteCarlo(double dt, std::size_t num_steps,
+                                    double temperature,
+                                    std::size_t trajectory_steps,
+                                    std::uint64_t seed);
+
+  /**
+   * @brief Various post-construction initialisation tasks for the atomic state.
+   *
+   * For this case, atomic velocities will be initialised from the
+   * Maxwell-Boltzmann distribution at a given temperature.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Run one trajectory from freshly drawn velocities, and accept or
+   * reject its end.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Getter for the potential energy of the atomic state at the end of
+   * the last step, which is that of the trajectory's start if it was rejected.
+   * @param forces The force evaluation object stepped with.
+   * @return The potential energy.
+   */
+  double potential(const Forces& forces) const override {
+    return potential_.value_or(forces.potential());
+  }
+
+  /**
+   * @brief Getter for the number of steps of each trajectory.
+   * @return The number of steps.
+   */
+  std::size_t trajectory_steps() const { return trajectory_steps_; }
+
+  /**
+   * @brief Getter for the number of trajectories accepted.
+   * @return The number of trajectories accepted, out of current_step().
+   */
+  std::size_t accepted() const { return accepted_; }
+
+ private:
+  std::size_t trajectory_steps_;
+  Philox random_;
+  std::size_t accepted_;
+  //< Potential energy of the atomic state, once evaluated
+  std::optional<double> potential_;
+  //< Atomic state at the start of the trajectory
+  Tensor<double, 2> pos_, vel_, force_;
+  double virial_;
+
+  /**
+   * @brief Draw every velocity from the Maxwell-Boltzmann distribution.
+   * @param state The atomic state.
+   */
+  void draw_velocities(DynamicAtomicState& state);
+
+  /**
+   * @brief Copy the atomic state into, or back from, the start of the
+   * trajectory.
+   * @param state The atomic state.
+   * @param restore Whether to copy back from the start of the trajectory.
+   */
+  void snapshot(DynamicAtomicState& state, bool restore);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_HYBRID_MONTE_CARLO_HPP */
@@ -0,0 +1,101 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/util/tensor.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_langevin.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+VelocityVerletNVTLangevin::VelocityVerletNVTLangevin(double dt,
+                                                     std::size_t num_steps,
+                                                     double temperature,
+                                                     double t_relax,
+                                                     std::uint64_t seed)
+    : VelocityVerlet(dt, num_steps),
+      Thermostat(temperature, seed),
+      t_relax_(t_relax),
+      c1_(std::exp(-dt / t_relax)),
+      c2_(std::sqrt((1 - c1_ * c1_) * constants::boltzmann *
+                    constants::joule_to_internal * temperature)),
+      random_(seed, RandomStream::Langevin) {}
+
+// ========================================================================== //
+
+void VelocityVerletNVTLangevin::initialise(DynamicAtomicState& state) {
+  initialise_velocities(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTLangevin::step(DynamicAtomicState& state, Forces& forces,
+                                     Cell& cell) {
+  kick_drift_collide_drift(state, cell);
+  forces.evaluate(state, cell);
+  half_step_two(state, cell);
+  end_step(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTLangevin::set_dt(double dt) {
+  VelocityVerlet::set_dt(dt);
+  c1_ = std::exp(-dt / t_relax_);
+  c2_ = std::sqrt((1 - c1_ * c1_) * constants::boltzmann *
+                  constants::joule_to_internal * temp_);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTLangevin::kick_drift_collide_drift(
+    DynamicAtomicState& state, const Cell& cell) {
+  if (constraints_) constraints_->store(state, cell);
+
+  noise_.resize(3 * state.num_atoms());
+  random_.fill_normal(current_step_, noise_.data(), noise_.size());
+
+  const std::size_t num_atoms = state.num_atoms();
+  double* pos = std::to_address(state.pos());
+  double* vel = std::to_address(state.vel());
+  const double* force = std::to_address(state.force());
+  const double* inv_mass = state.inv_mass().data();
+  const double* noise = noise_.data();
+  with_cell_type(cell, [&](const auto& concrete) {
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      const double k = half_dt_ * inv_mass[iatom];
+      const double sigma = c2_ * std::sqrt(inv_mass[iatom]);
+      for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+        double v = vel[idim] + k * force[idim];
+        pos[idim] += half_dt_ * v;
+        v = c1_ * v + sigma * noise[idim];
+        pos[idim] += half_dt_ * v;
+        vel[idim] = v;
+      }
+      concrete.pbc(pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]);
+    }
+  });
+
+  if (constraints_) constraints_->shake(state, cell, dt_);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTLangevin::set_temperature(DynamicAtomicState& state,
+                                                double temp) {
+  Thermostat::set_temperature(state, temp);
+  c2_ = std::sqrt((1 - c1_ * c1_) * constants::boltzmann *
+                  constants::joule_to_internal * temp_);
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,106 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_LANGEVIN_HPP
+#define __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_LANGEVIN_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Langevin dynamics using the BAOAB splitting of Leimkuhler and
+ * Matthews (Appl. Math. Res. Express 2013, 34 (2013)):
+ *
+ * B: v += dt/2 * a(t)
+ * A: r += dt/2 * v
+ * O: v = c_1 v + \sqrt{(1 - c_1^2) k_B T / m} \xi, with c_1 = \exp(-dt / \tau)
+ * A: r += dt/2 * v
+ * B: v += dt/2 * a(t + dt)
+ *
+ * The friction and noise act on every atom at every step, rather than
+ * randomising a few atoms as the Andersen thermostat does, and configurational
+ * averages stay accurate at larger timesteps than other Langevin splittings.
+ * The first four stages are fused into a single pass over the atoms, and the
+ * Gaussian noise for all 3N velocity components is drawn beforehand in bulk
+ * from a counter-based generator keyed on the step, so trajectories don't
+ * depend on the number of threads.
+ */
+class VelocityVerletNVTLangevin : public VelocityVerlet, public Thermostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param temperature The temperature of the heat bath.
+   * @param t_relax Relaxation time of velocities, i.e. inverse friction.
+   * @param seed Seed of the random noise and initial velocities.
+   */
+  VelocityVerletNVTLangevin(double dt, std::size_t num_steps,
+                            double temperature, double t_relax,
+                            std::uint64_t seed);
+
+  /**
+   * @brief Various post-construction initialisation tasks for the atomic state.
+   *
+   * For this case, atomic velocities will be initialised from the
+   * Maxwell-Boltzmann distribution at a given temperature.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment using
+   * the BAOAB splitting.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Set the time increment of the integrator, along with the
+   * coefficients of the O stage.
+   * @param dt The time increment in femtoseconds.
+   */
+  void set_dt(double dt) override;
+
+  /**
+   * @brief Change the temperature of the heat bath, scaling the velocities
+   * along with the amplitude of the noise.
+   * @param state The atomic state being thermostatted.
+   * @param temp The new temperature to maintain.
+   */
+  void set_temperature(DynamicAtomicState& state, double temp) override;
+
+ private:
+  double t_relax_;
+  //< Velocity damping factor and noise amplitude, without the mass, of the
+  //< O stage
+  double c1_, c2_;
+  Philox random_;
+  std::vector<double> noise_;
+
+  /**
+   * @brief Propagate the atomic state through the B, A, O and A stages using
+   * forces at the current time increment.
+   * @param state The atomic state to propagate forwards.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void kick_drift_collide_drift(DynamicAtomicState& state, const Cell& cell);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_LANGEVIN_HPP */
@@ -0,0 +1,130 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/integrate/velocity_verlet_nvt_nose_hoover.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+VelocityVerletNVTNoseHoover::VelocityVerletNVTNoseHoover(
+    double dt, std::size_t num_steps, double temperature, double t_relax,
+    std::size_t chain_length, std::uint64_t seed)
+    : VelocityVerlet(dt, num_steps),
+      Thermostat(temperature, seed),
+      t_relax_(t_relax),
+      kt_(constants::boltzmann * constants::joule_to_internal * temperature),
+      num_dof_(0),
+      mass_(chain_length),
+      xi_(chain_length),
+      v_xi_(chain_length),
+      last_half_dt_(half_dt_) {
+  if (chain_length == 0) {
+    throw std::runtime_error(
+        "Nose-Hoover chain needs at least one thermostat.");
+  }
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTNoseHoover::initialise(DynamicAtomicState& state) {
+  initialise_velocities(state);
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTNoseHoover::step(DynamicAtomicState& state,
+                                       Forces& forces, Cell& cell) {
+  double scale = 1;
+  if (!kinetic_) {
+    // The first thermostat is coupled to every degree of freedom, less the
+    // centre of mass motion and any constraints, and the rest to the one
+    // before them
+    num_dof_ = 3 * state.num_atoms() - 3;
+    if (constraints_) num_dof_ -= constraints_->size();
+    mass_[0] = num_dof_ * kt_ * t_relax_ * t_relax_;
+    for (std::size_t k = 1; k < mass_.size(); ++k) {
+      mass_[k] = kt_ * t_relax_ * t_relax_;
+    }
+    kinetic_ = state.kinetic();
+  } else {
+    // Half-step deferred from the end of the last step
+    scale = chain_half_step(*kinetic_, last_half_dt_);
+  }
+  scale *= chain_half_step(*kinetic_, half_dt_);
+
+  half_step_one(state, cell, scale);
+  forces.evaluate(state, cell);
+  kinetic_ = half_step_two(state, cell);
+  if (constraints_) kinetic_ = state.kinetic();
+  last_half_dt_ = half_dt_;
+  end_step(state);
+}
+
+// ========================================================================== //
+
+double VelocityVerletNVTNoseHoover::chain_half_step(double& kinetic,
+                                                    double half_dt) {
+  const std::size_t m = mass_.size() - 1;
+  // Fractions of the whole timestep, dt = 2 half_dt, of the Trotter splitting
+  const double dt2 = half_dt, dt4 = half_dt / 2, dt8 = half_dt / 4;
+  // Force on each thermostat, from the one before it in the chain
+  auto g = [&](std::size_t k) {
+    return k == 0 ? (2 * kinetic - num_dof_ * kt_) / mass_[0]
+                  : (mass_[k - 1] * v_xi_[k - 1] * v_xi_[k - 1] - kt_) /
+                        mass_[k];
+  };
+
+  // Thermostat velocities from the end of the chain to the start
+  v_xi_[m] += g(m) * dt4;
+  for (std::size_t k = m; k-- > 0;) {
+    double damp = std::exp(-v_xi_[k + 1] * dt8);
+    v_xi_[k] = (v_xi_[k] * damp + g(k) * dt4) * damp;
+  }
+
+  // Atomic velocities and thermostat positions
+  double scale = std::exp(-v_xi_[0] * dt2);
+  kinetic *= scale * scale;
+  for (std::size_t k = 0; k <= m; ++k) xi_[k] += v_xi_[k] * dt2;
+
+  // Thermostat velocities from the start of the chain to the end
+  for (std::size_t k = 0; k < m; ++k) {
+    double damp = std::exp(-v_xi_[k + 1] * dt8);
+    v_xi_[k] = (v_xi_[k] * damp + g(k) * dt4) * damp;
+  }
+  v_xi_[m] += g(m) * dt4;
+  return scale;
+}
+
+// ========================================================================== //
+
+double VelocityVerletNVTNoseHoover::thermostat_energy() const {
+  double energy = num_dof_ * kt_ * xi_[0];
+  for (std::size_t k = 0; k < mass_.size(); ++k) {
+    energy += 0.5 * mass_[k] * v_xi_[k] * v_xi_[k];
+    if (k > 0) energy += kt_ * xi_[k];
+  }
+  return energy;
+}
+
+// ========================================================================== //
+
+void VelocityVerletNVTNoseHoover::set_temperature(DynamicAtomicState& state,
+                                                  double temp) {
+  const double ratio = temp / temp_;
+  Thermostat::set_temperature(state, temp);
+  kt_ *= ratio;
+  for (double& mass : mass_) mass *= ratio;
+  if (kinetic_) *kinetic_ *= ratio;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,110 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_NOSE_HOOVER_HPP
+#define __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_NOSE_HOOVER_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+#include <optional>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/system/thermostat.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Velocity-Verlet integrator coupled to a Nose-Hoover chain thermostat
+ * (Martyna, Klein and Tuckerman, J. Chem. Phys. 97, 2635 (1992)), which
+ * generates trajectories in the NVT ensemble deterministically.
+ *
+ * The chain is propagated by half a timestep either side of the Verlet step,
+ * following Martyna et al., Mol. Phys. 87, 1117 (1996). Its only coupling to
+ * the atoms is a uniform velocity scale, which depends on the kinetic energy
+ * alone. The kinetic energy comes out of the final kick of each step, and the
+ * scale is folded into the first kick of the next. The chain half-step at the
+ * end of a step is therefore deferred to the start of the next, so the state
+ * between steps is taken just before it. That keeps the cost at that of plain
+ * Velocity Verlet.
+ */
+class VelocityVerletNVTNoseHoover : public VelocityVerlet, public Thermostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param dt Time increment for simulation step.
+   * @param num_steps Number of integration steps to run the simulation for.
+   * @param temperature The temperature of the heat bath.
+   * @param t_relax Period of the thermostat's oscillations, which sets the
+   * masses of the thermostats in the chain.
+   * @param chain_length Number of thermostats in the chain.
+   * @param seed Seed of the random numbers of the initial velocities.
+   */
+  VelocityVerletNVTNoseHoover(double dt, std::size_t num_steps,
+                              double temperature, double t_relax,
+                              std::size_t chain_length, std::uint64_t seed);
+
+  /**
+   * @brief Various post-construction initialisation tasks for the atomic state.
+   *
+   * For this case, atomic velocities will be initialised from the
+   * Maxwell-Boltzmann distribution at a given temperature.
+   * @param state The atomic state to initialise.
+   */
+  void initialise(DynamicAtomicState& state) override;
+
+  /**
+   * @brief Propagate the atomic state forwards by the time increment using the
+   * Velocity Verlet method with a Nose-Hoover chain thermostat.
+   * @param state The atomic state to propagate forwards.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+  /**
+   * @brief Getter for the energy of the thermostat chain. Added to the total
+   * energy of the atoms, this is conserved by the dynamics.
+   * @return The energy of the chain.
+   */
+  double thermostat_energy() const;
+
+  /**
+   * @brief Change the temperature of the heat bath, scaling the velocities
+   * and the kinetic energy carried over from the last step. The masses of the
+   * chain are proportional to kT, so scale with it to keep the relaxation
+   * time.
+   * @param state The atomic state being thermostatted.
+   * @param temp The new temperature to maintain.
+   */
+  void set_temperature(DynamicAtomicState& state, double temp) override;
+
+ protected:
+  double t_relax_, kt_;
+  //< Number of degrees of freedom coupled to the thermostat
+  std::size_t num_dof_;
+  //< Mass, position and velocity of each thermostat in the chain
+  std::vector<double> mass_, xi_, v_xi_;
+  //< Kinetic energy of the atoms at the end of the last step, and its half
+  //< timestep, which may differ from this step's if the timestep adapts
+  std::optional<double> kinetic_;
+  double last_half_dt_;
+
+  /**
+   * @brief Propagate the chain by half a timestep.
+   * @param kinetic The kinetic energy of the atoms, which is updated to that
+   * after scaling.
+   * @param half_dt Half of the timestep.
+   * @return The factor to scale the atomic velocities by.
+   */
+  double chain_half_step(double& kinetic, double half_dt);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_INTEGRATE_VELOCITY_VERLET_NVT_NOSE_HOOVER_HPP */
@@ -71,7 +71,9 @@ class TOMLReader : public Reader {
         std::vector<std::any> contents;
         for (auto&& elem : *val.as_array()) {
           elem.visit([&](auto&& el) {
-            if constexpr (toml::is_string<decltype(el)>) {
+            if constexpr (toml::is_number<decltype(el)>) {
+              contents.push_back(static_cast<double>(el.get()));
+            } else if constexpr (toml::is_string<decltype(el)>) {
               contents.push_back(*el);
             } else if constexpr (toml::is_table<decltype(el)>) {
               contents.push_back(parse_table(el));
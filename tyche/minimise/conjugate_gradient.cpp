@@ -0,0 +1,92 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <limits>
+#include <memory>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/minimise/conjugate_gradient.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+ConjugateGradient::ConjugateGradient(std::size_t max_steps,
+                                     double energy_tolerance,
+                                     double force_tolerance,
+                                     double max_displacement)
+    : LineSearch(max_steps, energy_tolerance, force_tolerance,
+                 max_displacement, curvature),
+      step_length_(0),
+      prev_slope_(0) {}
+
+// ========================================================================== //
+
+void ConjugateGradient::initialise(DynamicAtomicState& state, double energy) {
+  LineSearch::initialise(state, energy);
+  prev_force_.assign(3 * state.num_atoms(), 0);
+}
+
+// ========================================================================== //
+
+void ConjugateGradient::step(DynamicAtomicState& state, Forces& forces,
+                             Cell& cell) {
+  const std::size_t num_coords = 3 * state.num_atoms();
+  const double* force = std::to_address(state.force());
+  const double* prev_force = prev_force_.data();
+
+  // Polak-Ribiere weight, restarting from steepest descent on the first step
+  double beta = 0;
+  if (current_step_ > 0) {
+    double numerator = 0, denominator = 0;
+#pragma omp parallel for simd schedule(static) \
+    reduction(+ : numerator, denominator)
+    for (std::size_t idx = 0; idx < num_coords; ++idx) {
+      numerator += force[idx] * (force[idx] - prev_force[idx]);
+      denominator += prev_force[idx] * prev_force[idx];
+    }
+    if (denominator > 0) beta = std::max(0.0, numerator / denominator);
+  }
+  update_direction(state, beta);
+  if (start_search(state) >= 0) {
+    update_direction(state, 0);
+    start_search(state);
+  }
+
+  // Expect the same decrease as the last step to set the first step length,
+  // or go as far as the largest displacement allows on the first step
+  double energy;
+  const double first = step_length_ > 0
+                           ? step_length_ * prev_slope_ / slope_
+                           : std::numeric_limits<double>::max();
+  step_length_ = search(state, forces, cell, first, energy);
+  if (step_length_ == 0 && beta > 0) {
+    update_direction(state, 0);
+    start_search(state);
+    step_length_ = search(state, forces, cell, first, energy);
+  }
+  prev_slope_ = slope_;
+  end_step(state, energy);
+}
+
+// ========================================================================== //
+
+void ConjugateGradient::update_direction(const DynamicAtomicState& state,
+                                         double beta) {
+  const std::size_t num_coords = 3 * state.num_atoms();
+  const double* force = std::to_address(state.force());
+  double* prev_force = prev_force_.data();
+  double* direction = direction_.data();
+#pragma omp parallel for simd schedule(static)
+  for (std::size_t idx = 0; idx < num_coords; ++idx) {
+    direction[idx] = force[idx] + beta * direction[idx];
+    prev_force[idx] = force[idx];
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,80 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MINIMISE_CONJUGATE_GRADIENT_HPP
+#define __TYCHE_MINIMISE_CONJUGATE_GRADIENT_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/minimise/line_search.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Nonlinear conjugate gradient minimiser, using the Polak-Ribiere
+ * update with restarts, beta = max(0, F.(F - F_prev) / F_prev.F_prev).
+ *
+ * Each direction is d = F + beta d_prev, which falls back to steepest descent
+ * whenever it doesn't point downhill or the line search along it fails. The
+ * first step length tried along each direction expects the same decrease in
+ * energy to first order as the last step (Nocedal and Wright, Numerical
+ * Optimization, Sec. 3.5).
+ */
+class ConjugateGradient : public LineSearch {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param max_steps The largest number of steps to take.
+   * @param energy_tolerance Relative change in potential energy over a step
+   * below which the minimiser has converged.
+   * @param force_tolerance Largest force on any atom below which the minimiser
+   * has converged.
+   * @param max_displacement The largest displacement of any atom in a step.
+   */
+  ConjugateGradient(std::size_t max_steps, double energy_tolerance,
+                    double force_tolerance, double max_displacement);
+
+  /**
+   * @brief Get ready to minimise an atomic state, sizing the previous forces
+   * and starting from steepest descent.
+   * @param state The atomic state, whose forces have been evaluated.
+   * @param energy The potential energy of the atomic state.
+   */
+  void initialise(DynamicAtomicState& state, double energy) override;
+
+  /**
+   * @brief Update the search direction and line search along it.
+   * @param state The atomic state to minimise.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+ private:
+  //< Forces at the start of the last step
+  std::vector<double> prev_force_;
+  //< Last step length taken, and the slope along the last direction
+  double step_length_, prev_slope_;
+
+  //< Nonlinear conjugate gradients need a fairly exact line search
+  static constexpr double curvature = 0.1;
+
+  /**
+   * @brief Set the search direction to d = F + beta d_prev, saving the forces
+   * for the next update.
+   * @param state The atomic state.
+   * @param beta The weight of the previous direction.
+   */
+  void update_direction(const DynamicAtomicState& state, double beta);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MINIMISE_CONJUGATE_GRADIENT_HPP */
@@ -0,0 +1,223 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/minimise/elastic_band.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+ElasticBand::ElasticBand(
+    std::vector<std::shared_ptr<DynamicAtomicState>> images,
+    std::vector<std::unique_ptr<Forces>> forces, double spring)
+    : images_(std::move(images)),
+      forces_(std::move(forces)),
+      spring_(spring),
+      energy_(images_.size()),
+      evaluated_(false),
+      climbing_(false),
+      highest_(1) {
+  if (images_.size() < 3) {
+    throw std::runtime_error(
+        "Nudged elastic band needs at least one image between its ends.");
+  }
+  if (forces_.size() != images_.size()) {
+    throw std::runtime_error(
+        "Nudged elastic band needs forces for every image.");
+  }
+  const std::size_t num_atoms = images_[0]->num_atoms();
+  for (const auto& image : images_) {
+    if (image->num_atoms() != num_atoms) {
+      throw std::runtime_error(
+          "Nudged elastic band needs the same atoms in every image.");
+    }
+  }
+
+  // Gather the moving images into the band, in order
+  const std::size_t num_moving = images_.size() - 2;
+  std::vector<std::shared_ptr<AtomType>> types;
+  Tensor<double, 2> pos(num_moving * num_atoms, 3);
+  for (std::size_t image = 1; image + 1 < images_.size(); ++image) {
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      types.push_back(images_[image]->atom_type(iatom));
+    }
+    std::copy(images_[image]->pos(), images_[image]->pos() + 3 * num_atoms,
+              pos.begin() + 3 * num_atoms * (image - 1));
+  }
+  band_ = std::make_shared<DynamicAtomicState>();
+  band_->add(std::move(types), std::move(pos));
+  tangent_.resize(3 * num_moving * num_atoms);
+}
+
+// ========================================================================== //
+
+double ElasticBand::evaluate(DynamicAtomicState& state, const Cell& cell) {
+  if (&state != band_.get()) {
+    throw std::runtime_error(
+        "Nudged elastic band can only evaluate its own band state.");
+  }
+  const std::size_t num_images = images_.size();
+  const std::size_t size = 3 * images_[0]->num_atoms();
+  for (std::size_t image = 1; image + 1 < num_images; ++image) {
+    std::copy(state.pos() + size * (image - 1),
+              state.pos() + size * image, images_[image]->pos());
+  }
+  // The end points stay put, so their forces are only evaluated once
+  if (evaluated_) {
+    evaluate_images(cell, 1, num_images - 1);
+  } else {
+    evaluate_images(cell, 0, num_images);
+    evaluated_ = true;
+  }
+  highest_ = std::max_element(energy_.begin() + 1, energy_.end() - 1) -
+             energy_.begin();
+
+  double* force = std::to_address(state.force());
+#pragma omp parallel for schedule(dynamic, 1)
+  for (std::size_t image = 1; image < num_images - 1; ++image) {
+    project(cell, image, force + size * (image - 1));
+  }
+  return std::accumulate(energy_.begin() + 1, energy_.end() - 1, 0.0);
+}
+
+// ========================================================================== //
+
+void ElasticBand::evaluate_images(const Cell& cell, std::size_t first,
+                                  std::size_t last) {
+  // Exceptions can't leave a parallel region, so hold them until it's done
+  std::vector<std::exception_ptr> errors(images_.size());
+#pragma omp parallel for schedule(dynamic, 1)
+  for (std::size_t image = first; image < last; ++image) {
+    // Regions nested within the image's kernels run on this thread alone
+    omp_set_num_threads(1);
+    try {
+      energy_[image] = forces_[image]->evaluate(*images_[image], cell);
+    } catch (...) {
+      errors[image] = std::current_exception();
+    }
+  }
+  for (auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+// ========================================================================== //
+
+void ElasticBand::project(const Cell& cell, std::size_t image, double* force) {
+  const std::size_t size = 3 * images_[image]->num_atoms();
+  const double* prev = std::to_address(images_[image - 1]->pos());
+  const double* pos = std::to_address(images_[image]->pos());
+  const double* next = std::to_address(images_[image + 1]->pos());
+  const double* true_force = std::to_address(images_[image]->force());
+  double* tangent = tangent_.data() + size * (image - 1);
+
+  // Weight the separations to the images either side by the energy, leaning
+  // on the higher one, and mixing the two smoothly about extrema
+  const double e_prev = energy_[image - 1], e = energy_[image];
+  const double e_next = energy_[image + 1];
+  double w_prev, w_next;
+  if (e_next > e && e > e_prev) {
+    w_prev = 0;
+    w_next = 1;
+  } else if (e_next < e && e < e_prev) {
+    w_prev = 1;
+    w_next = 0;
+  } else {
+    const double d_max = std::max(std::abs(e_next - e), std::abs(e_prev - e));
+    const double d_min = std::min(std::abs(e_next - e), std::abs(e_prev - e));
+    w_prev = e_next > e_prev ? d_min : d_max;
+    w_next = e_next > e_prev ? d_max : d_min;
+    if (d_max == 0) w_prev = w_next = 1;
+  }
+
+  double dist_prev = 0, dist_next = 0, norm = 0;
+  with_cell_type(cell, [&](const auto& concrete) {
+    for (std::size_t idx = 0; idx < size; idx += 3) {
+      double dp[3] = {pos[idx] - prev[idx], pos[idx + 1] - prev[idx + 1],
+                      pos[idx + 2] - prev[idx + 2]};
+      double dn[3] = {next[idx] - pos[idx], next[idx + 1] - pos[idx + 1],
+                      next[idx + 2] - pos[idx + 2]};
+      concrete.min_image(dp[0], dp[1], dp[2]);
+      concrete.min_image(dn[0], dn[1], dn[2]);
+      for (std::size_t idim = 0; idim < 3; ++idim) {
+        tangent[idx + idim] = w_prev * dp[idim] + w_next * dn[idim];
+        dist_prev += dp[idim] * dp[idim];
+        dist_next += dn[idim] * dn[idim];
+        norm += tangent[idx + idim] * tangent[idx + idim];
+      }
+    }
+  });
+  norm = norm > 0 ? 1 / std::sqrt(norm) : 0;
+
+  double parallel = 0;
+#pragma omp simd reduction(+ : parallel)
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    tangent[idx] *= norm;
+    parallel += true_force[idx] * tangent[idx];
+  }
+  // The climbing image has the true force along the path inverted, otherwise
+  // it's replaced by the springs
+  const double along =
+      climbing_ && image == highest_
+          ? -2 * parallel
+          : spring_ * (std::sqrt(dist_next) - std::sqrt(dist_prev)) - parallel;
+#pragma omp simd
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    force[idx] += true_force[idx] + along * tangent[idx];
+  }
+}
+
+// ========================================================================== //
+
+std::vector<std::shared_ptr<DynamicAtomicState>> ElasticBand::interpolate(
+    const DynamicAtomicState& initial, const std::vector<double>& final_pos,
+    std::size_t num_images, const Cell& cell) {
+  const std::size_t size = 3 * initial.num_atoms();
+  if (final_pos.size() != size) {
+    throw std::runtime_error(
+        "Nudged elastic band needs a final position for every atom.");
+  }
+  if (num_images < 3) {
+    throw std::runtime_error(
+        "Nudged elastic band needs at least one image between its ends.");
+  }
+  std::vector<double> displacement(size);
+  for (std::size_t idx = 0; idx < size; idx += 3) {
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      displacement[idx + idim] =
+          final_pos[idx + idim] - initial.pos()[idx + idim];
+    }
+    cell.min_image(displacement[idx], displacement[idx + 1],
+                   displacement[idx + 2]);
+  }
+
+  std::vector<std::shared_ptr<DynamicAtomicState>> images;
+  for (std::size_t image = 0; image < num_images; ++image) {
+    auto state = std::make_shared<DynamicAtomicState>(initial);
+    const double frac = double(image) / (num_images - 1);
+    double* pos = std::to_address(state->pos());
+    for (std::size_t idx = 0; idx < size; idx += 3) {
+      for (std::size_t idim = 0; idim < 3; ++idim) {
+        pos[idx + idim] += frac * displacement[idx + idim];
+      }
+      cell.pbc(pos[idx], pos[idx + 1], pos[idx + 2]);
+    }
+    images.push_back(std::move(state));
+  }
+  return images;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,153 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MINIMISE_ELASTIC_BAND_HPP
+#define __TYCHE_MINIMISE_ELASTIC_BAND_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <cstddef>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Forces of a nudged elastic band (Henkelman et al., J. Chem. Phys.
+ * 113, 9901 (2000)), for finding minimum energy paths between two states.
+ *
+ * A path is discretised into images of the atomic state, each its own
+ * DynamicAtomicState with its own forces, whose end points stay fixed. The
+ * images between them are gathered into one band state, so that any minimiser
+ * can move them all at once. Evaluating the band scatters its positions back
+ * into the images and evaluates the forces on every image concurrently, one
+ * image per thread, then projects each image's forces onto the band:
+ *
+ *      F_i = F_i^\perp + k (|R_{i+1} - R_i| - |R_i - R_{i-1}|) \tau_i
+ *
+ * i.e. the true force perpendicular to the path, plus springs between
+ * neighbouring images acting only along it. The tangent \tau_i is that to the
+ * neighbouring image higher in energy, mixed with the other near extrema of
+ * the energy (Henkelman and Jonsson, J. Chem. Phys. 113, 9978 (2000)). With
+ * climbing on, the highest image feels no springs, and the true force along
+ * the path inverted, F = F - 2 (F . \tau) \tau, so that it climbs to the
+ * saddle point.
+ *
+ * The projected forces aren't the gradient of any energy, so the band is best
+ * minimised with FIRE. The energy of the band is taken as the sum of those of
+ * its moving images.
+ */
+class ElasticBand : public Force {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param images The images along the path, including its fixed end points.
+   * @param forces The forces on each image.
+   * @param spring The spring constant between neighbouring images.
+   */
+  ElasticBand(std::vector<std::shared_ptr<DynamicAtomicState>> images,
+              std::vector<std::unique_ptr<Forces>> forces, double spring);
+
+  /**
+   * @brief Evaluate the projected forces on the band state, whose positions
+   * are first copied into the images.
+   * @param state The band state, as from band().
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The sum of the potential energies of the moving images.
+   */
+  double evaluate(DynamicAtomicState& state, const Cell& cell) override;
+
+  /**
+   * @brief Getter for the band state, which gathers the atoms of every image
+   * between the end points.
+   * @return The band state.
+   */
+  std::shared_ptr<DynamicAtomicState> band() { return band_; }
+
+  /**
+   * @brief Getter for the images along the path.
+   * @return The images, including the end points.
+   */
+  const std::vector<std::shared_ptr<DynamicAtomicState>>& images() const {
+    return images_;
+  }
+
+  /**
+   * @brief Getter for the potential energy of each image at the last
+   * evaluation.
+   * @return The potential energies, including the end points.
+   */
+  const std::vector<double>& energies() const { return energy_; }
+
+  /**
+   * @brief Set whether the highest image climbs to the saddle point.
+   * @param climbing Whether the highest image climbs.
+   */
+  void set_climbing(bool climbing) { climbing_ = climbing; }
+
+  /**
+   * @brief Getter for whether the highest image climbs to the saddle point.
+   * @return Whether the highest image climbs.
+   */
+  bool climbing() const { return climbing_; }
+
+  /**
+   * @brief Getter for the image highest in energy at the last evaluation,
+   * which climbs if climbing is on.
+   * @return The index of the highest moving image.
+   */
+  std::size_t highest_image() const { return highest_; }
+
+  /**
+   * @brief Interpolate images linearly between two end points, taking the
+   * minimum image of each atom's displacement.
+   * @param initial The initial atomic state, which each image copies.
+   * @param final_pos The positions of the atoms in the final state.
+   * @param num_images The number of images, including the end points.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return The images.
+   */
+  static std::vector<std::shared_ptr<DynamicAtomicState>> interpolate(
+      const DynamicAtomicState& initial, const std::vector<double>& final_pos,
+      std::size_t num_images, const Cell& cell);
+
+ private:
+  std::vector<std::shared_ptr<DynamicAtomicState>> images_;
+  std::vector<std::unique_ptr<Forces>> forces_;
+  double spring_;
+  std::shared_ptr<DynamicAtomicState> band_;
+  //< Potential energy of each image, and whether the end points' are known
+  std::vector<double> energy_;
+  bool evaluated_;
+  bool climbing_;
+  std::size_t highest_;
+  //< Tangent to the path at each moving image
+  std::vector<double> tangent_;
+
+  /**
+   * @brief Evaluate the forces on a range of images concurrently, one image
+   * per thread.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param first The index of the first image.
+   * @param last One past the index of the last image.
+   */
+  void evaluate_images(const Cell& cell, std::size_t first, std::size_t last);
+
+  /**
+   * @brief Project the forces on a moving image onto the band.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param image The index of the image.
+   * @param force The forces on the image's atoms in the band, which the
+   * projected forces are added to.
+   */
+  void project(const Cell& cell, std::size_t image, double* force);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MINIMISE_ELASTIC_BAND_HPP */
@@ -0,0 +1,81 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/minimise/fire.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Fire::Fire(std::size_t max_steps, double energy_tolerance,
+           double force_tolerance, double dt, double dt_max)
+    : Minimise(max_steps, energy_tolerance, force_tolerance),
+      dt_(dt),
+      dt_max_(dt_max),
+      alpha_(alpha_start),
+      num_positive_(0) {}
+
+// ========================================================================== //
+
+void Fire::initialise(DynamicAtomicState& state, double energy) {
+  Minimise::initialise(state, energy);
+  std::fill(state.vel(), state.vel() + 3 * state.num_atoms(), 0.0);
+}
+
+// ========================================================================== //
+
+void Fire::step(DynamicAtomicState& state, Forces& forces, Cell& cell) {
+  const std::size_t num_atoms = state.num_atoms();
+  double* pos = std::to_address(state.pos());
+  double* vel = std::to_address(state.vel());
+  const double* force = std::to_address(state.force());
+  const double* inv_mass = state.inv_mass().data();
+
+  double power = 0, vsq = 0, fsq = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : power, vsq, fsq)
+  for (std::size_t idx = 0; idx < 3 * num_atoms; ++idx) {
+    power += force[idx] * vel[idx];
+    vsq += vel[idx] * vel[idx];
+    fsq += force[idx] * force[idx];
+  }
+
+  // v <- (1 - alpha) v + alpha |v| F / |F| while going downhill, otherwise stop
+  double vel_scale = 0, force_scale = 0;
+  if (power > 0) {
+    vel_scale = 1 - alpha_;
+    force_scale = fsq > 0 ? alpha_ * std::sqrt(vsq / fsq) : 0;
+    if (++num_positive_ > n_min) {
+      dt_ = std::min(dt_ * f_inc, dt_max_);
+      alpha_ *= f_alpha;
+    }
+  } else {
+    num_positive_ = 0;
+    dt_ *= f_dec;
+    alpha_ = alpha_start;
+  }
+
+  // Mix, then kick and drift with a semi-implicit Euler step
+  with_cell_type(cell, [&](const auto& concrete) {
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      const double k = force_scale + dt_ * inv_mass[iatom];
+      for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+        vel[idim] = vel_scale * vel[idim] + k * force[idim];
+        pos[idim] += dt_ * vel[idim];
+      }
+      concrete.pbc(pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]);
+    }
+  });
+  end_step(state, forces.evaluate(state, cell));
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
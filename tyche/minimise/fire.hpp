@@ -0,0 +1,76 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MINIMISE_FIRE_HPP
+#define __TYCHE_MINIMISE_FIRE_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/minimise/minimise.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Fast inertial relaxation engine (Bitzek et al., Phys. Rev. Lett. 97,
+ * 170201 (2006)).
+ *
+ * Atoms move under damped dynamics, with velocities steered towards the forces
+ * by a mixing factor alpha. While the power, P = F.v, stays positive, the
+ * timestep grows and alpha decays; as soon as it turns negative, the atoms are
+ * stopped, the timestep shrinks and alpha is reset. The mixing, kick and drift
+ * are done in one sweep over the atoms, after a sweep accumulating the power
+ * and the norms of the velocities and forces.
+ */
+class Fire : public Minimise {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param max_steps The largest number of steps to take.
+   * @param energy_tolerance Relative change in potential energy over a step
+   * below which the minimiser has converged.
+   * @param force_tolerance Largest force on any atom below which the minimiser
+   * has converged.
+   * @param dt The initial timestep in femtoseconds.
+   * @param dt_max The largest timestep in femtoseconds.
+   */
+  Fire(std::size_t max_steps, double energy_tolerance, double force_tolerance,
+       double dt, double dt_max);
+
+  /**
+   * @brief Get ready to minimise an atomic state, starting it at rest.
+   * @param state The atomic state, whose forces have been evaluated.
+   * @param energy The potential energy of the atomic state.
+   */
+  void initialise(DynamicAtomicState& state, double energy) override;
+
+  /**
+   * @brief Take one step of damped dynamics, adapting the timestep and mixing
+   * factor to the power.
+   * @param state The atomic state to minimise.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+ private:
+  double dt_, dt_max_;
+  //< Mixing factor of the forces into the velocities
+  double alpha_;
+  //< Number of steps since the power was last negative
+  std::size_t num_positive_;
+
+  //< Parameters recommended by Bitzek et al.
+  static constexpr std::size_t n_min = 5;
+  static constexpr double f_inc = 1.1, f_dec = 0.5;
+  static constexpr double alpha_start = 0.1, f_alpha = 0.99;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MINIMISE_FIRE_HPP */
@@ -0,0 +1,147 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <memory>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/minimise/lbfgs.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Lbfgs::Lbfgs(std::size_t max_steps, double energy_tolerance,
+             double force_tolerance, double max_displacement,
+             std::size_t memory)
+    : LineSearch(max_steps, energy_tolerance, force_tolerance,
+                 max_displacement, curvature),
+      memory_(memory),
+      rho_(memory),
+      coeff_(memory),
+      latest_(0),
+      num_stored_(0),
+      gamma_(1) {}
+
+// ========================================================================== //
+
+void Lbfgs::initialise(DynamicAtomicState& state, double energy) {
+  LineSearch::initialise(state, energy);
+  s_.assign(memory_ * 3 * state.num_atoms(), 0);
+  y_.assign(memory_ * 3 * state.num_atoms(), 0);
+  latest_ = memory_ - 1;
+  num_stored_ = 0;
+}
+
+// ========================================================================== //
+
+void Lbfgs::step(DynamicAtomicState& state, Forces& forces, Cell& cell) {
+  update_direction(state);
+  // Hold the forces at the start of the step in the next free row of y, to be
+  // differenced once the step is taken
+  const std::size_t num_coords = 3 * state.num_atoms();
+  const std::size_t next = (latest_ + 1) % memory_;
+  std::copy(state.force(), state.force() + num_coords,
+            y_.begin() + next * num_coords);
+
+  double energy;
+  start_search(state);
+  double step_length = search(state, forces, cell, 1, energy);
+  if (step_length == 0 && num_stored_ > 0) {
+    num_stored_ = 0;
+    update_direction(state);
+    start_search(state);
+    step_length = search(state, forces, cell, 1, energy);
+  }
+  if (step_length > 0) {
+    update_history(state, step_length);
+  } else {
+    num_stored_ = 0;
+  }
+  end_step(state, energy);
+}
+
+// ========================================================================== //
+
+void Lbfgs::update_direction(const DynamicAtomicState& state) {
+  const std::size_t num_coords = 3 * state.num_atoms();
+  const double* force = std::to_address(state.force());
+  double* direction = direction_.data();
+  std::copy(force, force + num_coords, direction);
+
+  // Newest to oldest, q <- q - rho s.q y
+  for (std::size_t k = 0; k < num_stored_; ++k) {
+    const std::size_t row = (latest_ + memory_ - k) % memory_;
+    const double* s = s_.data() + row * num_coords;
+    const double* y = y_.data() + row * num_coords;
+    double sq = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : sq)
+    for (std::size_t idx = 0; idx < num_coords; ++idx) {
+      sq += s[idx] * direction[idx];
+    }
+    const double coeff = coeff_[row] = rho_[row] * sq;
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t idx = 0; idx < num_coords; ++idx) {
+      direction[idx] -= coeff * y[idx];
+    }
+  }
+
+  // Oldest to newest, r <- r + (coeff - rho y.r) s, starting from gamma q
+  const double gamma = num_stored_ > 0 ? gamma_ : 1;
+#pragma omp parallel for simd schedule(static)
+  for (std::size_t idx = 0; idx < num_coords; ++idx) {
+    direction[idx] *= gamma;
+  }
+  for (std::size_t k = num_stored_; k-- > 0;) {
+    const std::size_t row = (latest_ + memory_ - k) % memory_;
+    const double* s = s_.data() + row * num_coords;
+    const double* y = y_.data() + row * num_coords;
+    double yr = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : yr)
+    for (std::size_t idx = 0; idx < num_coords; ++idx) {
+      yr += y[idx] * direction[idx];
+    }
+    const double weight = coeff_[row] - rho_[row] * yr;
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t idx = 0; idx < num_coords; ++idx) {
+      direction[idx] += weight * s[idx];
+    }
+  }
+}
+
+// ========================================================================== //
+
+void Lbfgs::update_history(const DynamicAtomicState& state,
+                           double step_length) {
+  const std::size_t num_coords = 3 * state.num_atoms();
+  const std::size_t next = (latest_ + 1) % memory_;
+  const double* force = std::to_address(state.force());
+  const double* direction = direction_.data();
+  double* s = s_.data() + next * num_coords;
+  double* y = y_.data() + next * num_coords;
+
+  // The step is along the direction, so needs no minimum image
+  double sy = 0, yy = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : sy, yy)
+  for (std::size_t idx = 0; idx < num_coords; ++idx) {
+    s[idx] = step_length * direction[idx];
+    y[idx] -= force[idx];
+    sy += s[idx] * y[idx];
+    yy += y[idx] * y[idx];
+  }
+  if (sy > 0) {
+    rho_[next] = 1 / sy;
+    gamma_ = sy / yy;
+    latest_ = next;
+    num_stored_ = std::min(num_stored_ + 1, memory_);
+  } else {
+    // The row we wrote over was the oldest pair if the buffer is full
+    num_stored_ = std::min(num_stored_, memory_ - 1);
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
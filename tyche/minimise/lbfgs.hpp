@@ -0,0 +1,96 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MINIMISE_LBFGS_HPP
+#define __TYCHE_MINIMISE_LBFGS_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/minimise/line_search.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Limited-memory BFGS minimiser (Nocedal, Math. Comp. 35, 773 (1980)).
+ *
+ * The inverse Hessian is approximated from the last few steps, s = x - x_prev,
+ * and changes in gradient, y = F_prev - F, by the two-loop recursion, starting
+ * from the identity scaled by s.y / y.y of the latest pair. The pairs are kept
+ * in a ring buffer sized once on initialisation, so stepping doesn't allocate.
+ * A unit step along each direction is tried first. The curvature condition of
+ * the line search keeps s.y positive, but any pair without would lose
+ * positive-definiteness so is skipped, and the history is cleared whenever the
+ * line search fails.
+ */
+class Lbfgs : public LineSearch {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param max_steps The largest number of steps to take.
+   * @param energy_tolerance Relative change in potential energy over a step
+   * below which the minimiser has converged.
+   * @param force_tolerance Largest force on any atom below which the minimiser
+   * has converged.
+   * @param max_displacement The largest displacement of any atom in a step.
+   * @param memory The number of steps to remember.
+   */
+  Lbfgs(std::size_t max_steps, double energy_tolerance, double force_tolerance,
+        double max_displacement, std::size_t memory);
+
+  /**
+   * @brief Get ready to minimise an atomic state, sizing the history and
+   * clearing it.
+   * @param state The atomic state, whose forces have been evaluated.
+   * @param energy The potential energy of the atomic state.
+   */
+  void initialise(DynamicAtomicState& state, double energy) override;
+
+  /**
+   * @brief Find the quasi-Newton direction and line search along it.
+   * @param state The atomic state to minimise.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void step(DynamicAtomicState& state, Forces& forces, Cell& cell) override;
+
+ private:
+  std::size_t memory_;
+  //< Steps and changes in gradient, one row of all atomic coordinates per
+  //< step remembered
+  std::vector<double> s_, y_;
+  //< 1 / s.y of each pair, and the coefficients of the first loop
+  std::vector<double> rho_, coeff_;
+  //< Index of the latest pair in the ring buffer, and the number stored
+  std::size_t latest_, num_stored_;
+  //< Scale of the initial inverse Hessian
+  double gamma_;
+
+  //< A loose line search suffices, since unit steps are usually accepted
+  static constexpr double curvature = 0.9;
+
+  /**
+   * @brief Set the search direction to the approximate inverse Hessian
+   * applied to the forces, by the two-loop recursion.
+   * @param state The atomic state.
+   */
+  void update_direction(const DynamicAtomicState& state);
+
+  /**
+   * @brief Remember the step just taken and the change in gradient over it,
+   * if s.y is positive.
+   * @param state The atomic state at the end of the step.
+   * @param step_length The step length taken along the direction.
+   */
+  void update_history(const DynamicAtomicState& state, double step_length);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MINIMISE_LBFGS_HPP */
@@ -0,0 +1,149 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/minimise/line_search.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+LineSearch::LineSearch(std::size_t max_steps, double energy_tolerance,
+                       double force_tolerance, double max_displacement,
+                       double curvature)
+    : Minimise(max_steps, energy_tolerance, force_tolerance),
+      max_displacement_(max_displacement),
+      curvature_(curvature) {}
+
+// ========================================================================== //
+
+void LineSearch::initialise(DynamicAtomicState& state, double energy) {
+  Minimise::initialise(state, energy);
+  direction_.assign(3 * state.num_atoms(), 0);
+  start_.resize(3 * state.num_atoms());
+}
+
+// ========================================================================== //
+
+double LineSearch::start_search(const DynamicAtomicState& state) {
+  const std::size_t num_atoms = state.num_atoms();
+  const double* pos = std::to_address(state.pos());
+  const double* force = std::to_address(state.force());
+  const double* direction = direction_.data();
+  double* start = start_.data();
+
+  double slope = 0, max_dsq = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : slope) \
+    reduction(max : max_dsq)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    double dsq = 0;
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      slope -= force[idim] * direction[idim];
+      dsq += direction[idim] * direction[idim];
+      start[idim] = pos[idim];
+    }
+    max_dsq = std::max(max_dsq, dsq);
+  }
+  slope_ = slope;
+  max_step_length_ = max_dsq > 0 ? max_displacement_ / std::sqrt(max_dsq) : 0;
+  return slope_;
+}
+
+// ========================================================================== //
+
+double LineSearch::search(DynamicAtomicState& state, Forces& forces,
+                          Cell& cell, double step_length, double& energy) {
+  energy = energy_;
+  if (slope_ >= 0 || max_step_length_ == 0) return 0;
+  step_length = std::min(step_length, max_step_length_);
+
+  // Move a step along the direction from the start, returning the energy and
+  // the slope there
+  const std::size_t num_atoms = state.num_atoms();
+  double* pos = std::to_address(state.pos());
+  const double* force = std::to_address(state.force());
+  const double* direction = direction_.data();
+  const double* start = start_.data();
+  auto move = [&](double length, double& slope) {
+    with_cell_type(cell, [&](const auto& concrete) {
+#pragma omp parallel for simd schedule(static)
+      for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+        for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+          pos[idim] = start[idim] + length * direction[idim];
+        }
+        concrete.pbc(pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]);
+      }
+    });
+    double pot = forces.evaluate(state, cell);
+    slope = 0;
+#pragma omp parallel for simd schedule(static) reduction(+ : slope)
+    for (std::size_t idx = 0; idx < 3 * num_atoms; ++idx) {
+      slope -= force[idx] * direction[idx];
+    }
+    return pot;
+  };
+
+  // The minimum is bracketed by the longest step known to go downhill far
+  // enough, lo, and the shortest known to have gone past it, hi
+  double lo = 0, energy_lo = energy_, slope_lo = slope_;
+  std::optional<double> hi;
+  double energy_hi = 0, slope_hi = 0;
+  for (std::size_t n = 0; n < max_iterations; ++n) {
+    double slope;
+    double trial = move(step_length, slope);
+    if (trial > energy_ + armijo * step_length * slope_ || trial >= energy_lo) {
+      hi = step_length;
+      energy_hi = trial;
+      slope_hi = std::numeric_limits<double>::quiet_NaN();
+    } else if (std::abs(slope) <= -curvature_ * slope_) {
+      energy = trial;
+      return step_length;
+    } else if (slope > 0) {
+      hi = step_length;
+      energy_hi = trial;
+      slope_hi = slope;
+    } else {
+      lo = step_length;
+      energy_lo = trial;
+      slope_lo = slope;
+      // Still steeply downhill, so go further unless we've reached the cap
+      if (!hi) {
+        if (lo == max_step_length_) break;
+        step_length = std::min(2 * lo, max_step_length_);
+        continue;
+      }
+    }
+
+    // Interpolate within the bracket, by the secant of the slopes if both ends
+    // have one, else by the minimum of the quadratic through the energies and
+    // the slope at lo, keeping clear of either end
+    double width = *hi - lo, next;
+    if (!std::isnan(slope_hi)) {
+      next = lo - slope_lo * width / (slope_hi - slope_lo);
+    } else {
+      double curvature = energy_hi - energy_lo - slope_lo * width;
+      next = lo - 0.5 * slope_lo * width * width / curvature;
+    }
+    step_length = std::clamp(next, lo + 0.1 * width, *hi - 0.1 * width);
+  }
+
+  // Settle for the best step found, if any
+  if (step_length != lo) {
+    double slope;
+    energy_lo = move(lo, slope);
+  }
+  energy = energy_lo;
+  return lo;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
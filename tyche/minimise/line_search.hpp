@@ -0,0 +1,101 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MINIMISE_LINE_SEARCH_HPP
+#define __TYCHE_MINIMISE_LINE_SEARCH_HPP
+
+// C++ Standard Libraries
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/minimise/minimise.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Base class for minimisers that choose a search direction each step,
+ * then move along it by a line search satisfying the strong Wolfe conditions.
+ *
+ * A step is accepted once the energy has fallen by at least a fraction of what
+ * the slope along the direction predicts (the Armijo condition), and the
+ * magnitude of the slope there has fallen to some fraction of that at the
+ * start (the curvature condition). Steps are doubled while they fall short of
+ * the minimum, and are capped so that no atom moves further than the largest
+ * displacement. Once the minimum is bracketed, the next step is interpolated
+ * by the secant of the slopes at either end, or by a quadratic in the energy
+ * if the far end overshot uphill. Forces are evaluated at every trial anyway,
+ * so the slope there costs only a dot product.
+ */
+class LineSearch : public Minimise {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param max_steps The largest number of steps to take.
+   * @param energy_tolerance Relative change in potential energy over a step
+   * below which the minimiser has converged.
+   * @param force_tolerance Largest force on any atom below which the minimiser
+   * has converged.
+   * @param max_displacement The largest displacement of any atom in a step.
+   * @param curvature Fraction the magnitude of the slope must fall by for a
+   * step to be accepted; small values give a more exact search.
+   */
+  LineSearch(std::size_t max_steps, double energy_tolerance,
+             double force_tolerance, double max_displacement,
+             double curvature);
+
+  /**
+   * @brief Get ready to minimise an atomic state, sizing the search direction
+   * and the positions the search starts from.
+   * @param state The atomic state, whose forces have been evaluated.
+   * @param energy The potential energy of the atomic state.
+   */
+  void initialise(DynamicAtomicState& state, double energy) override;
+
+ protected:
+  double max_displacement_, curvature_;
+  //< Search direction and positions at the start of the search, over all
+  //< atomic coordinates
+  std::vector<double> direction_, start_;
+  //< Slope of the energy along the direction at the start of the search, and
+  //< the step length that'd move some atom by the largest displacement
+  double slope_, max_step_length_;
+
+  /**
+   * @brief Find the slope of the energy along the direction and the largest
+   * step length, saving the positions the search starts from.
+   * @param state The atomic state.
+   * @return The slope, which is negative if the direction is downhill.
+   */
+  double start_search(const DynamicAtomicState& state);
+
+  /**
+   * @brief Search along the direction for a step that lowers the energy
+   * enough, leaving the atomic state there with its forces evaluated. If the
+   * conditions can't be met, the best step found that lowers the energy
+   * enough is taken; if there's none, or the direction isn't downhill, the
+   * atomic state is left where it started. Must follow start_search.
+   * @param state The atomic state.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param step_length The first step length to try, before it's capped by
+   * the largest displacement.
+   * @param energy The potential energy where the search stops.
+   * @return The step length taken, or zero if the search failed.
+   */
+  double search(DynamicAtomicState& state, Forces& forces, Cell& cell,
+                double step_length, double& energy);
+
+  //< Fraction of the predicted decrease that must be achieved
+  static constexpr double armijo = 1E-4;
+  //< Largest number of step lengths tried in a search
+  static constexpr std::size_t max_iterations = 30;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MINIMISE_LINE_SEARCH_HPP */
@@ -0,0 +1,70 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/minimise/minimise.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Minimise::Minimise(std::size_t max_steps, double energy_tolerance,
+                   double force_tolerance)
+    : max_steps_(max_steps),
+      current_step_(0),
+      energy_tolerance_(energy_tolerance),
+      force_tolerance_(force_tolerance),
+      energy_(0),
+      max_force_(0),
+      converged_(false) {}
+
+// ========================================================================== //
+
+void Minimise::initialise(DynamicAtomicState& state, double energy) {
+  energy_ = energy;
+  max_force_ = max_force(state);
+  converged_ = force_tolerance_ > 0 && max_force_ <= force_tolerance_;
+}
+
+// ========================================================================== //
+
+double Minimise::max_force(const DynamicAtomicState& state) {
+  const std::size_t num_atoms = state.num_atoms();
+  const double* force = std::to_address(state.force());
+  double max = 0;
+#pragma omp parallel for simd schedule(static) reduction(max : max)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    double fsq = 0;
+    for (std::size_t idim = 3 * iatom; idim < 3 * iatom + 3; ++idim) {
+      fsq += force[idim] * force[idim];
+    }
+    max = std::max(max, fsq);
+  }
+  return std::sqrt(max);
+}
+
+// ========================================================================== //
+
+void Minimise::end_step(const DynamicAtomicState& state, double energy) {
+  ++current_step_;
+  max_force_ = max_force(state);
+  // Change relative to the mean magnitude of the energies, with a floor in
+  // case both are zero
+  double change = std::abs(energy - energy_);
+  double scale = 0.5 * (std::abs(energy) + std::abs(energy_)) +
+                 std::numeric_limits<double>::epsilon();
+  energy_ = energy;
+  converged_ = (force_tolerance_ > 0 && max_force_ <= force_tolerance_) ||
+               (energy_tolerance_ > 0 && change <= energy_tolerance_ * scale);
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
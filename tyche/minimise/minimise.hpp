@@ -0,0 +1,116 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MINIMISE_MINIMISE_HPP
+#define __TYCHE_MINIMISE_MINIMISE_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/force.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Base virtual class for all energy minimisers.
+ *
+ * Minimisation stops when the largest force on any atom falls to the force
+ * tolerance, or the change in potential energy over a step relative to its
+ * magnitude falls to the energy tolerance, or after the largest number of
+ * steps. Either tolerance is ignored if it's zero.
+ */
+class Minimise {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param max_steps The largest number of steps to take.
+   * @param energy_tolerance Relative change in potential energy over a step
+   * below which the minimiser has converged.
+   * @param force_tolerance Largest force on any atom below which the minimiser
+   * has converged.
+   */
+  Minimise(std::size_t max_steps, double energy_tolerance,
+           double force_tolerance);
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~Minimise() = default;
+
+  /**
+   * @brief Get ready to minimise an atomic state, sizing any work arrays so
+   * that stepping doesn't allocate.
+   * @param state The atomic state, whose forces have been evaluated.
+   * @param energy The potential energy of the atomic state.
+   */
+  virtual void initialise(DynamicAtomicState& state, double energy);
+
+  /**
+   * @brief Move the atomic state towards a minimum of the potential energy,
+   * leaving its forces evaluated at the new positions.
+   * @param state The atomic state to minimise.
+   * @param forces The force evaluation object.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  virtual void step(DynamicAtomicState& state, Forces& forces, Cell& cell) = 0;
+
+  /**
+   * @brief Whether minimisation should stop, either because it's converged or
+   * it's run out of steps.
+   * @return Whether minimisation is finished.
+   */
+  bool finished() const { return converged_ || current_step_ >= max_steps_; }
+
+  /**
+   * @brief Whether either convergence criterion has been met.
+   * @return Whether the minimiser has converged.
+   */
+  bool converged() const { return converged_; }
+
+  /**
+   * @brief Getter for the number of steps taken so far.
+   * @return The number of steps.
+   */
+  const std::size_t current_step() const { return current_step_; }
+
+  /**
+   * @brief Getter for the potential energy after the last step.
+   * @return The potential energy.
+   */
+  const double energy() const { return energy_; }
+
+  /**
+   * @brief Getter for the largest force on any atom after the last step.
+   * @return The largest force.
+   */
+  const double max_force() const { return max_force_; }
+
+  /**
+   * @brief Find the largest force on any atom.
+   * @param state The atomic state.
+   * @return The magnitude of the largest force.
+   */
+  static double max_force(const DynamicAtomicState& state);
+
+ protected:
+  std::size_t max_steps_, current_step_;
+  double energy_tolerance_, force_tolerance_;
+  //< Potential energy and largest force after the last step
+  double energy_, max_force_;
+  bool converged_;
+
+  /**
+   * @brief Finish a step, advancing the step counter and testing convergence.
+   * @param state The atomic state at the end of the step.
+   * @param energy The potential energy at the end of the step.
+   */
+  void end_step(const DynamicAtomicState& state, double energy);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MINIMISE_MINIMISE_HPP */
@@ -0,0 +1,62 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <string>
+#include <stdexcept>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/must.hpp"
+#include "tyche/util/maybe.hpp"
+#include "tyche/io/reader.hpp"
+#include "tyche/minimise/minimise_factory.hpp"
+#include "tyche/minimise/fire.hpp"
+#include "tyche/minimise/conjugate_gradient.hpp"
+#include "tyche/minimise/lbfgs.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+std::unique_ptr<Minimise> MinimiseFactory::create(Reader::Mapping config) {
+  std::unique_ptr<Minimise> minimiser;
+  auto type = must_find<std::string>(config, "type");
+  spdlog::info("Creating minimiser of type: " + type);
+
+  auto max_steps = must_find<double>(config, "max_steps");
+  auto force_tolerance = must_find<double>(config, "force_tolerance");
+  auto energy_tolerance = maybe_find<double>(config, "energy_tolerance")
+                              .value_or(default_energy_tolerance);
+  spdlog::info(
+      "Minimising for at most {} steps, until the largest force is {} or the "
+      "relative change in energy is {}.",
+      max_steps, force_tolerance, energy_tolerance);
+  if (type == "FIRE") {
+    auto timestep = must_find<double>(config, "timestep");
+    auto dt_max = maybe_find<double>(config, "dt_max")
+                      .value_or(default_dt_max_factor * timestep);
+    minimiser = std::make_unique<Fire>(max_steps, energy_tolerance,
+                                       force_tolerance, timestep, dt_max);
+  } else if (type == "ConjugateGradient" || type == "LBFGS") {
+    auto max_displacement = maybe_find<double>(config, "max_displacement")
+                                .value_or(default_max_displacement);
+    if (type == "ConjugateGradient") {
+      minimiser = std::make_unique<ConjugateGradient>(
+          max_steps, energy_tolerance, force_tolerance, max_displacement);
+    } else {
+      auto memory =
+          maybe_find<double>(config, "memory").value_or(default_memory);
+      minimiser =
+          std::make_unique<Lbfgs>(max_steps, energy_tolerance, force_tolerance,
+                                  max_displacement, memory);
+    }
+  } else {
+    throw std::runtime_error("Unrecognised minimiser: " + type);
+  }
+  return minimiser;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
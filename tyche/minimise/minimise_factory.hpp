@@ -0,0 +1,43 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MINIMISE_MINIMISE_FACTORY_HPP
+#define __TYCHE_MINIMISE_MINIMISE_FACTORY_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/reader.hpp"
+#include "tyche/minimise/minimise.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Factory pattern to return a minimiser.
+ */
+class MinimiseFactory {
+ public:
+  /**
+   * @brief Create a minimiser from a map of parameters and their values.
+   * @param config Mapping from Minimiser parameter keys to values.
+   * @return The minimiser.
+   */
+  static std::unique_ptr<Minimise> create(Reader::Mapping config);
+
+ private:
+  //< Default relative change in energy for convergence; off unless given
+  static constexpr double default_energy_tolerance = 0;
+  //< Default largest displacement of any atom in a line search step
+  static constexpr double default_max_displacement = 0.1;
+  //< Default number of steps remembered by L-BFGS
+  static constexpr std::size_t default_memory = 10;
+  //< Default largest FIRE timestep, as a multiple of the initial one
+  static constexpr double default_dt_max_factor = 10;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MINIMISE_MINIMISE_FACTORY_HPP */
@@ -0,0 +1,187 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+#include <omp.h>
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/montecarlo/displacement.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Displacement::Displacement(double temperature, double step, double max_step,
+                           double target_acceptance, std::size_t adjust_sweeps,
+                           bool checkerboard, std::uint64_t seed)
+    : kt_(constants::boltzmann * constants::joule_to_internal * temperature),
+      step_(std::min(step, max_step)),
+      max_step_(max_step),
+      target_acceptance_(target_acceptance),
+      adjust_sweeps_(adjust_sweeps),
+      checkerboard_(checkerboard),
+      random_(seed, RandomStream::MonteCarlo),
+      current_sweep_(0),
+      attempted_(0),
+      accepted_(0),
+      num_domains_(0),
+      length_(0),
+      width_(0),
+      shift_({0, 0, 0}) {
+  if (temperature <= 0) {
+    throw std::runtime_error("Monte Carlo needs a positive temperature.");
+  }
+  if (step <= 0 || max_step <= 0) {
+    throw std::runtime_error("Monte Carlo needs positive displacements.");
+  }
+  if (target_acceptance <= 0 || target_acceptance >= 1) {
+    throw std::runtime_error(
+        "Monte Carlo needs a target acceptance on (0,1).");
+  }
+}
+
+// ========================================================================== //
+
+void Displacement::sweep(DynamicAtomicState& state, const Cell& cell,
+                         EnergyCache& cache) {
+  cache.update(state, cell);
+  const std::size_t num_atoms = state.num_atoms();
+  buffers_.resize(omp_get_max_threads());
+  std::size_t num_accepted = 0;
+
+  if (!checkerboard_) {
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      num_accepted += attempt(state, cell, cache, iatom, buffers_[0]);
+    }
+  } else {
+    auto cubic = dynamic_cast<const CubicCell*>(&cell);
+    if (!cubic) {
+      throw std::runtime_error(
+          "Monte Carlo in a checkerboard needs a cubic cell.");
+    }
+    decompose(state, *cubic, cache);
+    const std::size_t half = num_domains_ / 2;
+    const std::size_t num_coloured = half * half * half;
+#pragma omp parallel
+    {
+      auto& energies = buffers_[omp_get_thread_num()];
+      for (std::size_t colour = 0; colour < 8; ++colour) {
+        // Domains of a colour are the same parity as it along each dimension,
+        // and the loop's barrier keeps colours apart
+#pragma omp for schedule(dynamic, 1) reduction(+ : num_accepted)
+        for (std::size_t icoloured = 0; icoloured < num_coloured; ++icoloured) {
+          const std::size_t ix = 2 * (icoloured / (half * half)) + colour % 2;
+          const std::size_t iy = 2 * (icoloured / half % half) + colour / 2 % 2;
+          const std::size_t iz = 2 * (icoloured % half) + colour / 4;
+          const std::size_t idomain =
+              (ix * num_domains_ + iy) * num_domains_ + iz;
+          for (std::size_t n = domain_offsets_[idomain];
+               n < domain_offsets_[idomain + 1]; ++n) {
+            num_accepted +=
+                attempt(state, cell, cache, domain_atoms_[n], energies);
+          }
+        }
+      }
+    }
+  }
+
+  ++current_sweep_;
+  if (current_sweep_ <= adjust_sweeps_) {
+    const double acceptance = num_atoms ? double(num_accepted) / num_atoms : 0;
+    step_ *= std::clamp(acceptance / target_acceptance_, 0.5, 2.0);
+    step_ = std::min(step_, max_step_);
+    // Only moves at the final step sample the ensemble
+    return;
+  }
+  attempted_ += num_atoms;
+  accepted_ += num_accepted;
+}
+
+// ========================================================================== //
+
+bool Displacement::attempt(DynamicAtomicState& state, const Cell& cell,
+                           EnergyCache& cache, std::size_t iatom,
+                           std::array<std::vector<double>, 2>& energies) {
+  const double* pos = std::to_address(state.pos(iatom));
+  const auto u = random_.uniform(3 * current_sweep_, iatom);
+  const auto v = random_.uniform(3 * current_sweep_ + 1, iatom);
+  std::array<double, 3> trial = {pos[0] + step_ * (2 * u[0] - 1),
+                                 pos[1] + step_ * (2 * u[1] - 1),
+                                 pos[2] + step_ * (2 * v[0] - 1)};
+  cell.pbc(trial[0], trial[1], trial[2]);
+  // Moves out of a domain could reach atoms of another of the same colour
+  if (checkerboard_ && domain(trial) != domain_of_[iatom]) return false;
+
+  const double energy = cache.pair_energies(state, cell, iatom, trial,
+                                            energies[0]);
+  const double delta = energy - cache.energy(iatom);
+  if (delta > 0 && v[1] > std::exp(-delta / kt_)) return false;
+  cache.move(state, cell, iatom, trial, energy, energies[0], energies[1]);
+  return true;
+}
+
+// ========================================================================== //
+
+void Displacement::decompose(const DynamicAtomicState& state,
+                             const CubicCell& cell, const EnergyCache& cache) {
+  // Atoms listed as neighbours were within the list's range at its last build.
+  // Since then each has moved less than half the skin, or the list would have
+  // been rebuilt, but each is allowed the whole skin to be safe. Each then
+  // moves once more in this sweep, by at most sqrt(3) times the step
+  const double min_width = cache.list_range() + 2 * cache.skin() +
+                           2 * std::sqrt(3.0) * max_step_;
+  length_ = cell.length();
+  num_domains_ = std::size_t(length_ / min_width);
+  num_domains_ -= num_domains_ % 2;
+  if (num_domains_ < 2) {
+    throw std::runtime_error(
+        "Cell is too small for Monte Carlo in a checkerboard.");
+  }
+  width_ = length_ / num_domains_;
+  const auto u = random_.uniform(3 * current_sweep_ + 2, 0);
+  const auto v = random_.uniform(3 * current_sweep_ + 2, 1);
+  shift_ = {width_ * u[0], width_ * u[1], width_ * v[0]};
+
+  // Sort the atoms by domain, in order within each
+  const std::size_t num_atoms = state.num_atoms();
+  const double* pos = std::to_address(state.pos());
+  const std::size_t total = num_domains_ * num_domains_ * num_domains_;
+  domain_of_.resize(num_atoms);
+  domain_offsets_.assign(total + 1, 0);
+  domain_atoms_.resize(num_atoms);
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    domain_of_[iatom] =
+        domain({pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]});
+    ++domain_offsets_[domain_of_[iatom] + 1];
+  }
+  for (std::size_t idomain = 0; idomain < total; ++idomain) {
+    domain_offsets_[idomain + 1] += domain_offsets_[idomain];
+  }
+  std::vector<std::size_t> next(domain_offsets_.begin(),
+                                domain_offsets_.end() - 1);
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    domain_atoms_[next[domain_of_[iatom]]++] = iatom;
+  }
+}
+
+// ========================================================================== //
+
+std::size_t Displacement::domain(const std::array<double, 3>& pos) const {
+  std::size_t idomain = 0;
+  for (std::size_t idim = 0; idim < 3; ++idim) {
+    double x = pos[idim] - shift_[idim];
+    x -= std::floor(x / length_) * length_;
+    idomain = idomain * num_domains_ +
+              std::min(std::size_t(x / width_), num_domains_ - 1);
+  }
+  return idomain;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,161 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MONTECARLO_DISPLACEMENT_HPP
+#define __TYCHE_MONTECARLO_DISPLACEMENT_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/montecarlo/energy_cache.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Metropolis Monte Carlo moves of single atoms in the NVT ensemble.
+ *
+ * Each sweep tries to move every atom once, by a displacement drawn uniformly
+ * from a cube of some half-width, and accepts with probability
+ * min(1, \exp(-\Delta U / kT)). The change in energy comes from an EnergyCache,
+ * so costs a pass over the moved atom's neighbours. Over some first sweeps,
+ * the half-width is scaled after each by the ratio of the acceptance to its
+ * target, within a largest half-width, and is then held fixed so that the
+ * moves sample the canonical ensemble exactly.
+ *
+ * Atoms are either swept in order, or in a checkerboard of spatial domains
+ * which are updated concurrently. The cell is split into an even number of
+ * domains along each dimension, each wider than the range over which atoms can
+ * be listed as neighbours, and coloured in eight alternating classes. No atom
+ * in a domain can then neighbour one in another domain of the same colour, so
+ * each colour's domains are swept in parallel, with moves out of their domain
+ * rejected. The domains are shifted by a random offset every sweep so that
+ * atoms aren't kept to any one.
+ *
+ * Random numbers are keyed on the sweep and the atom, so for a given mode each
+ * atom's moves don't depend on the number of threads.
+ */
+class Displacement {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param temperature The temperature to sample at.
+   * @param step The initial half-width of the displacements.
+   * @param max_step The largest half-width of the displacements.
+   * @param target_acceptance The fraction of moves to accept while the
+   * half-width adjusts.
+   * @param adjust_sweeps The number of sweeps over which the half-width
+   * adjusts.
+   * @param checkerboard Whether to sweep spatial domains concurrently.
+   * @param seed Seed of the random numbers.
+   */
+  Displacement(double temperature, double step, double max_step,
+               double target_acceptance, std::size_t adjust_sweeps,
+               bool checkerboard, std::uint64_t seed);
+
+  /**
+   * @brief Try to move every atom once.
+   * @param state The atomic state.
+   * @param cell The simulation cell, which must be cubic to sweep in a
+   * checkerboard.
+   * @param cache The energy of each atom with its neighbours.
+   */
+  void sweep(DynamicAtomicState& state, const Cell& cell, EnergyCache& cache);
+
+  /**
+   * @brief Getter for the number of sweeps taken.
+   * @return The number of sweeps.
+   */
+  std::size_t current_sweep() const { return current_sweep_; }
+
+  /**
+   * @brief Getter for the current half-width of the displacements.
+   * @return The half-width.
+   */
+  double step() const { return step_; }
+
+  /**
+   * @brief Getter for the largest half-width of the displacements.
+   * @return The largest half-width.
+   */
+  double max_step() const { return max_step_; }
+
+  /**
+   * @brief Getter for the number of moves tried since the half-width was
+   * fixed, or in total if it never adjusted.
+   * @return The number of moves tried.
+   */
+  std::size_t attempted() const { return attempted_; }
+
+  /**
+   * @brief Getter for the number of moves accepted since the half-width was
+   * fixed, or in total if it never adjusted.
+   * @return The number of moves accepted.
+   */
+  std::size_t accepted() const { return accepted_; }
+
+  /**
+   * @brief Getter for the number of domains of the checkerboard along each
+   * dimension at the last sweep.
+   * @return The number of domains, or 0 if there's been no checkerboard.
+   */
+  std::size_t num_domains() const { return num_domains_; }
+
+ private:
+  double kt_, step_, max_step_, target_acceptance_;
+  std::size_t adjust_sweeps_;
+  bool checkerboard_;
+  Philox random_;
+  std::size_t current_sweep_, attempted_, accepted_;
+  //< Energies of the pairs of a moved atom at its new and old positions, for
+  //< each thread
+  std::vector<std::array<std::vector<double>, 2>> buffers_;
+
+  //< Number of domains along each dimension, the length of the cell, the
+  //< width of the domains and their offset along each dimension this sweep
+  std::size_t num_domains_;
+  double length_, width_;
+  std::array<double, 3> shift_;
+  //< Domain of each atom, and the atoms of each domain, laid out contiguously
+  std::vector<std::size_t> domain_of_, domain_offsets_, domain_atoms_;
+
+  /**
+   * @brief Try to move an atom.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param cache The energy of each atom with its neighbours.
+   * @param iatom The index of the atom.
+   * @param energies Storage for the energies of the atom's pairs.
+   * @return Whether the move was accepted.
+   */
+  bool attempt(DynamicAtomicState& state, const Cell& cell, EnergyCache& cache,
+               std::size_t iatom, std::array<std::vector<double>, 2>& energies);
+
+  /**
+   * @brief Lay out the checkerboard of domains for this sweep, and sort the
+   * atoms into them.
+   * @param state The atomic state.
+   * @param cell The cubic simulation cell.
+   * @param cache The energy of each atom with its neighbours, whose neighbour
+   * list sets the smallest width of the domains.
+   */
+  void decompose(const DynamicAtomicState& state, const CubicCell& cell,
+                 const EnergyCache& cache);
+
+  /**
+   * @brief Find the domain containing a position.
+   * @param pos The position, within the cell.
+   * @return The index of the domain.
+   */
+  std::size_t domain(const std::array<double, 3>& pos) const;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MONTECARLO_DISPLACEMENT_HPP */
@@ -0,0 +1,111 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/montecarlo/energy_cache.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+EnergyCache::EnergyCache(std::vector<std::unique_ptr<PairwiseForce>> forces,
+                         double skin, double max_displacement)
+    : forces_(std::move(forces)),
+      skin_(skin),
+      // Any two atoms close in on each other by at most twice the largest
+      // move in a sweep
+      neighbours_(max_cutoff(forces_) + 2 * std::sqrt(3.0) * max_displacement,
+                  skin, true) {}
+
+// ========================================================================== //
+
+bool EnergyCache::update(const DynamicAtomicState& state, const Cell& cell) {
+  if (neighbours_.update(state, cell)) {
+    compute(state, cell);
+    return true;
+  }
+  return false;
+}
+
+// ========================================================================== //
+
+void EnergyCache::compute(const DynamicAtomicState& state, const Cell& cell) {
+  neighbours_.update(state, cell);
+  const std::size_t num_atoms = state.num_atoms();
+  energy_.resize(num_atoms);
+  const double* pos = std::to_address(state.pos());
+#pragma omp parallel
+  {
+    std::vector<double> energies;
+#pragma omp for schedule(dynamic, 32)
+    for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+      energy_[iatom] = pair_energies(
+          state, cell, iatom,
+          {pos[3 * iatom], pos[3 * iatom + 1], pos[3 * iatom + 2]}, energies);
+    }
+  }
+}
+
+// ========================================================================== //
+
+double EnergyCache::pair_energies(const DynamicAtomicState& state,
+                                  const Cell& cell, std::size_t iatom,
+                                  const std::array<double, 3>& pos,
+                                  std::vector<double>& energies) const {
+  const auto neighbours = neighbours_.neighbours(iatom);
+  energies.assign(neighbours.size(), 0);
+  double energy = 0;
+  for (const auto& force : forces_) {
+    energy += force->pair_energies(state, cell, iatom, pos, neighbours,
+                                   energies.data());
+  }
+  return energy;
+}
+
+// ========================================================================== //
+
+void EnergyCache::move(DynamicAtomicState& state, const Cell& cell,
+                       std::size_t iatom, const std::array<double, 3>& pos,
+                       double energy, const std::vector<double>& new_energies,
+                       std::vector<double>& old_energies) {
+  double* atom_pos = std::to_address(state.pos(iatom));
+  pair_energies(state, cell, iatom, {atom_pos[0], atom_pos[1], atom_pos[2]},
+                old_energies);
+  const auto neighbours = neighbours_.neighbours(iatom);
+  for (std::size_t n = 0; n < neighbours.size(); ++n) {
+#pragma omp atomic
+    energy_[neighbours[n]] += new_energies[n] - old_energies[n];
+  }
+  energy_[iatom] = energy;
+  std::copy(pos.begin(), pos.end(), atom_pos);
+}
+
+// ========================================================================== //
+
+double EnergyCache::total() const {
+  return 0.5 * std::accumulate(energy_.begin(), energy_.end(), 0.0);
+}
+
+// ========================================================================== //
+
+double EnergyCache::max_cutoff(
+    const std::vector<std::unique_ptr<PairwiseForce>>& forces) {
+  if (forces.empty()) {
+    throw std::runtime_error("Monte Carlo needs at least one force.");
+  }
+  double cutoff = 0;
+  for (const auto& force : forces) cutoff = std::max(cutoff, force->cutoff());
+  return cutoff;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
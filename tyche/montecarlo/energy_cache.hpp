@@ -0,0 +1,156 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MONTECARLO_ENERGY_CACHE_HPP
+#define __TYCHE_MONTECARLO_ENERGY_CACHE_HPP
+
+// C++ Standard Libraries
+#include <span>
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/system/neighbour_list.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/pair_potential.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Energy of each atom with its neighbours under pairwise additive
+ * forces, so that the change in energy from moving one atom costs a pass over
+ * its neighbours rather than a full evaluation of the forces.
+ *
+ * Each atom holds the sum of the energies of the pairs it's in, so the total
+ * is half the sum over atoms. Trying a move of an atom needs only the energies
+ * of its pairs at the new position, since those at the old one sum to its
+ * cached energy. Accepting the move then updates the energy of each neighbour
+ * by the change in its pair with the moved atom.
+ *
+ * Neighbours come from a full Verlet list, whose cutoff is padded so that it
+ * stays valid through a sweep in which each atom moves at most once, by some
+ * largest displacement along each dimension. The list is brought up to date
+ * between sweeps, and the cached energies are recomputed from scratch whenever
+ * it's rebuilt, so rounding errors don't accumulate.
+ */
+class EnergyCache {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param forces The pairwise additive forces.
+   * @param skin Neighbour list skin distance.
+   * @param max_displacement The largest displacement of an atom along each
+   * dimension in a move.
+   */
+  EnergyCache(std::vector<std::unique_ptr<PairwiseForce>> forces, double skin,
+              double max_displacement);
+
+  /**
+   * @brief Bring the neighbour list up to date for the next sweep, computing
+   * the energy of every atom afresh if it's rebuilt.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @return True if the list was rebuilt, false otherwise.
+   */
+  bool update(const DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Compute the energy of every atom from scratch, bringing the
+   * neighbour list up to date first.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   */
+  void compute(const DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Compute the energies of the pairs of an atom placed at a position,
+   * with each of its neighbours.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param iatom The index of the atom.
+   * @param pos The position to place the atom at.
+   * @param energies The energy of the pair with each neighbour, in the order
+   * of neighbours(iatom), which is sized to fit.
+   * @return The energy of the atom at the position.
+   */
+  double pair_energies(const DynamicAtomicState& state, const Cell& cell,
+                       std::size_t iatom, const std::array<double, 3>& pos,
+                       std::vector<double>& energies) const;
+
+  /**
+   * @brief Move an atom to a new position, updating the energies of it and
+   * its neighbours. Neighbours' energies are updated atomically, so moves of
+   * atoms with no neighbours in common may be accepted concurrently.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param iatom The index of the atom.
+   * @param pos The new position of the atom.
+   * @param energy The energy of the atom at its new position.
+   * @param new_energies The energy of the pair with each neighbour at the new
+   * position, as from pair_energies.
+   * @param old_energies Storage for the energy of each pair at the old
+   * position.
+   */
+  void move(DynamicAtomicState& state, const Cell& cell, std::size_t iatom,
+            const std::array<double, 3>& pos, double energy,
+            const std::vector<double>& new_energies,
+            std::vector<double>& old_energies);
+
+  /**
+   * @brief Getter for the cached energy of an atom with its neighbours.
+   * @param iatom The index of the atom.
+   * @return The energy of the atom.
+   */
+  double energy(std::size_t iatom) const { return energy_[iatom]; }
+
+  /**
+   * @brief Compute the total potential energy from the cached energies.
+   * @return The potential energy.
+   */
+  double total() const;
+
+  /**
+   * @brief Getter for the neighbours of an atom.
+   * @param iatom The index of the atom.
+   * @return The indices of the atom's neighbours.
+   */
+  std::span<const std::size_t> neighbours(std::size_t iatom) const {
+    return neighbours_.neighbours(iatom);
+  }
+
+  /**
+   * @brief Getter for the distance within which atoms are listed as
+   * neighbours, at the last build of the list.
+   * @return The cutoff plus the padding and skin of the list.
+   */
+  double list_range() const { return neighbours_.cutoff() + skin_; }
+
+  /**
+   * @brief Getter for the skin distance of the neighbour list.
+   * @return The skin.
+   */
+  double skin() const { return skin_; }
+
+  /**
+   * @brief Find the largest cutoff of any of the forces, as any Monte Carlo
+   * moves over them must reach.
+   * @param forces The pairwise additive forces, of which there must be one.
+   * @return The largest cutoff.
+   */
+  static double max_cutoff(
+      const std::vector<std::unique_ptr<PairwiseForce>>& forces);
+
+ private:
+  std::vector<std::unique_ptr<PairwiseForce>> forces_;
+  double skin_;
+  NeighbourList neighbours_;
+  std::vector<double> energy_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MONTECARLO_ENERGY_CACHE_HPP */
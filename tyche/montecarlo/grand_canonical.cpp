@@ -0,0 +1,205 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/montecarlo/energy_cache.hpp"
+#include "tyche/montecarlo/grand_canonical.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+GrandCanonical::GrandCanonical(
+    std::vector<std::unique_ptr<PairwiseForce>> forces,
+    std::shared_ptr<AtomType> species, double temperature, double fugacity,
+    double step, std::uint64_t seed)
+    : forces_(std::move(forces)),
+      species_(std::move(species)),
+      kt_(constants::boltzmann * constants::joule_to_internal * temperature),
+      step_(step),
+      activity_(fugacity * constants::bar_to_internal / kt_),
+      random_(seed, RandomStream::GrandCanonical),
+      grid_(EnergyCache::max_cutoff(forces_)),
+      energy_(0),
+      current_sweep_(0),
+      num_trials_(0),
+      attempted_{},
+      accepted_{} {
+  if (temperature <= 0) {
+    throw std::runtime_error("Monte Carlo needs a positive temperature.");
+  }
+  if (fugacity <= 0) {
+    throw std::runtime_error(
+        "Grand canonical Monte Carlo needs a positive fugacity.");
+  }
+  if (step <= 0) {
+    throw std::runtime_error("Monte Carlo needs positive displacements.");
+  }
+}
+
+// ========================================================================== //
+
+void GrandCanonical::initialise(DynamicAtomicState& state, const Cell& cell) {
+  auto cubic = dynamic_cast<const CubicCell*>(&cell);
+  if (!cubic) {
+    throw std::runtime_error(
+        "Grand canonical Monte Carlo needs a cubic cell.");
+  }
+  if (2 * EnergyCache::max_cutoff(forces_) > cubic->length()) {
+    throw std::runtime_error(
+        "Cutoff exceeds half the cell length; the minimum image convention "
+        "would miss interactions.");
+  }
+  // Forces size their parameters by the atom types known when created
+  if (!state.atom_type_idx().count(species_)) {
+    throw std::runtime_error("Species " + species_->id() +
+                             " isn't an atom type of the atomic state.");
+  }
+
+  grid_.bin(state, cell);
+  const std::size_t num_atoms = state.num_atoms();
+  members_.clear();
+  slot_.assign(num_atoms, no_slot);
+  double total = 0;
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    if (state.atom_type(iatom) == species_) {
+      slot_[iatom] = members_.size();
+      members_.push_back(iatom);
+    }
+    const double* pos = std::to_address(state.pos(iatom));
+    total += atom_energy(state, cell, iatom, {pos[0], pos[1], pos[2]});
+  }
+  // Each pair is counted by both of its atoms
+  energy_ = 0.5 * total;
+}
+
+// ========================================================================== //
+
+void GrandCanonical::sweep(DynamicAtomicState& state, const Cell& cell) {
+  auto cubic = dynamic_cast<const CubicCell*>(&cell);
+  if (!cubic || slot_.size() != state.num_atoms()) {
+    throw std::runtime_error(
+        "Grand canonical Monte Carlo must be initialised with the atomic "
+        "state and a cubic cell.");
+  }
+  const std::size_t num_trials = std::max(members_.size(), min_trials);
+  for (std::size_t itrial = 0; itrial < num_trials; ++itrial) {
+    trial(state, *cubic);
+  }
+  ++current_sweep_;
+}
+
+// ========================================================================== //
+
+double GrandCanonical::atom_energy(const DynamicAtomicState& state,
+                                   const Cell& cell, std::size_t iatom,
+                                   const std::array<double, 3>& pos) {
+  candidates_.clear();
+  const std::size_t ibin = grid_.bin_index(pos[0], pos[1], pos[2]);
+  for (std::size_t jbin : grid_.neighbour_bins(ibin)) {
+    for (std::size_t jatom : grid_.atoms(jbin)) {
+      if (jatom != iatom) candidates_.push_back(jatom);
+    }
+  }
+  pairs_.assign(candidates_.size(), 0);
+  double energy = 0;
+  for (const auto& force : forces_) {
+    energy += force->pair_energies(state, cell, iatom, pos, candidates_,
+                                   pairs_.data());
+  }
+  return energy;
+}
+
+// ========================================================================== //
+
+void GrandCanonical::trial(DynamicAtomicState& state, const CubicCell& cell) {
+  const std::size_t itrial = num_trials_++;
+  const auto u = random_.uniform(itrial, 0);
+  const auto v = random_.uniform(itrial, 1);
+  const auto w = random_.uniform(itrial, 2);
+  const Move move = Move(std::min<std::size_t>(3 * u[0], Remove));
+  const std::size_t num_species = members_.size();
+  // With no atoms of the species, displacements aren't tried, and removals
+  // are rejected
+  if (move == Displace && !num_species) return;
+  ++attempted_[move];
+  if (move == Remove && !num_species) return;
+
+  const double volume = cell.volume();
+  if (move == Insert) {
+    std::array<double, 3> pos = {cell.length() * v[0], cell.length() * v[1],
+                                 cell.length() * w[0]};
+    cell.pbc(pos[0], pos[1], pos[2]);
+    const std::size_t iatom = state.insert_atom(species_, pos);
+    grid_.insert(state, iatom);
+    slot_.push_back(no_slot);
+    const double energy = atom_energy(state, cell, iatom, pos);
+    const double ratio = activity_ * volume / (num_species + 1);
+    if (w[1] < ratio * std::exp(-energy / kt_)) {
+      slot_[iatom] = num_species;
+      members_.push_back(iatom);
+      energy_ += energy;
+      ++accepted_[move];
+    } else {
+      remove(state, iatom);
+    }
+    return;
+  }
+
+  const std::size_t iatom =
+      members_[std::min<std::size_t>(u[1] * num_species, num_species - 1)];
+  const double* atom_pos = std::to_address(state.pos(iatom));
+  const std::array<double, 3> pos = {atom_pos[0], atom_pos[1], atom_pos[2]};
+  const double energy = atom_energy(state, cell, iatom, pos);
+  if (move == Remove) {
+    if (w[1] < num_species / (activity_ * volume) * std::exp(energy / kt_)) {
+      remove(state, iatom);
+      energy_ -= energy;
+      ++accepted_[move];
+    }
+    return;
+  }
+
+  std::array<double, 3> trial_pos = {pos[0] + step_ * (2 * v[0] - 1),
+                                     pos[1] + step_ * (2 * v[1] - 1),
+                                     pos[2] + step_ * (2 * w[0] - 1)};
+  cell.pbc(trial_pos[0], trial_pos[1], trial_pos[2]);
+  const double delta = atom_energy(state, cell, iatom, trial_pos) - energy;
+  if (delta > 0 && w[1] > std::exp(-delta / kt_)) return;
+  std::copy(trial_pos.begin(), trial_pos.end(), state.pos(iatom));
+  grid_.move(state, iatom);
+  energy_ += delta;
+  ++accepted_[move];
+}
+
+// ========================================================================== //
+
+void GrandCanonical::remove(DynamicAtomicState& state, std::size_t iatom) {
+  // The last atom of the species takes the removed atom's slot
+  const std::size_t islot = slot_[iatom];
+  if (islot != no_slot) {
+    members_[islot] = members_.back();
+    slot_[members_[islot]] = islot;
+    members_.pop_back();
+  }
+  // Then the last atom of all takes the removed atom's index
+  const std::size_t last = state.remove_atom(iatom);
+  grid_.remove(iatom);
+  if (iatom != last) {
+    slot_[iatom] = slot_[last];
+    if (slot_[iatom] != no_slot) members_[slot_[iatom]] = iatom;
+  }
+  slot_.pop_back();
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
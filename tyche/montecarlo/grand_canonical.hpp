@@ -0,0 +1,171 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_MONTECARLO_GRAND_CANONICAL_HPP
+#define __TYCHE_MONTECARLO_GRAND_CANONICAL_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/system/spatial_grid.hpp"
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/pair_potential.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Monte Carlo moves of one species of atom in the grand canonical
+ * (\mu VT) ensemble, e.g. for adsorption of a gas into a fixed framework.
+ *
+ * Each trial either displaces an atom of the species, by up to some half-width
+ * along each dimension, or tries to insert one at a uniformly random position
+ * or remove one at random, with equal chance. Atoms of other atom types stay
+ * put. With the chemical potential set by the fugacity f of a reservoir, an
+ * insertion into a cell of volume V holding N atoms of the species is accepted
+ * with probability
+ *
+ *      min(1, \beta f V / (N + 1) \exp(-\beta \Delta U))
+ *
+ * and a removal with probability min(1, N / (\beta f V) \exp(-\beta \Delta
+ * U)) (Frenkel and Smit, Understanding Molecular Simulation, Ch. 5.6).
+ *
+ * Atoms are inserted and removed in place through the atomic state, whose
+ * storage grows geometrically and is kept when atoms leave, and which moves
+ * its last atom into a removed one's place. A spatial grid of bins at least as
+ * wide as the cutoff follows the same changes, so the energy of an atom with
+ * the others comes from the 27 bins around it, and no trial costs more than a
+ * pass over its neighbours, whatever the number of atoms.
+ *
+ * Each sweep makes as many trials as there are atoms of the species at its
+ * start, or a handful if there are fewer. Random numbers are keyed on the
+ * trial, counted over all sweeps, so a run is reproducible from its seed.
+ */
+class GrandCanonical {
+ public:
+  /**
+   * @brief Kinds of trial move.
+   */
+  enum Move : std::size_t { Displace = 0, Insert, Remove, NumMoves };
+
+  /**
+   * @brief Class constructor.
+   * @param forces The pairwise additive forces.
+   * @param species The atom type of the atoms inserted and removed.
+   * @param temperature The temperature to sample at.
+   * @param fugacity The fugacity of the reservoir of the species, in bar.
+   * @param step The half-width of the displacements.
+   * @param seed Seed of the random numbers.
+   */
+  GrandCanonical(std::vector<std::unique_ptr<PairwiseForce>> forces,
+                 std::shared_ptr<AtomType> species, double temperature,
+                 double fugacity, double step, std::uint64_t seed);
+
+  /**
+   * @brief Bin the atoms and compute the potential energy from scratch, before
+   * the first sweep.
+   * @param state The atomic state.
+   * @param cell The simulation cell, which must be cubic.
+   */
+  void initialise(DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Make a sweep of trial moves.
+   * @param state The atomic state, whose number of atoms changes.
+   * @param cell The simulation cell, as passed to initialise.
+   */
+  void sweep(DynamicAtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Getter for the potential energy, kept up to date through accepted
+   * moves.
+   * @return The potential energy.
+   */
+  double energy() const { return energy_; }
+
+  /**
+   * @brief Getter for the number of atoms of the species.
+   * @return The number of atoms of the species.
+   */
+  std::size_t num_species() const { return members_.size(); }
+
+  /**
+   * @brief Getter for the number of sweeps taken.
+   * @return The number of sweeps.
+   */
+  std::size_t current_sweep() const { return current_sweep_; }
+
+  /**
+   * @brief Getter for the number of trials of a kind of move.
+   * @param move The kind of move.
+   * @return The number of trials.
+   */
+  std::size_t attempted(Move move) const { return attempted_[move]; }
+
+  /**
+   * @brief Getter for the number of accepted trials of a kind of move.
+   * @param move The kind of move.
+   * @return The number of accepted trials.
+   */
+  std::size_t accepted(Move move) const { return accepted_[move]; }
+
+ private:
+  std::vector<std::unique_ptr<PairwiseForce>> forces_;
+  std::shared_ptr<AtomType> species_;
+  double kt_, step_;
+  //< Fugacity over kT, i.e. the density of the species in an ideal gas
+  double activity_;
+  Philox random_;
+  SpatialGrid grid_;
+  double energy_;
+  std::size_t current_sweep_, num_trials_;
+  std::array<std::size_t, NumMoves> attempted_, accepted_;
+  //< Indices of the atoms of the species, and the slot of each atom in them
+  std::vector<std::size_t> members_, slot_;
+  //< Atoms within reach of a position, and the energies of their pairs
+  std::vector<std::size_t> candidates_;
+  std::vector<double> pairs_;
+
+  //< Fewest trials in a sweep
+  static constexpr std::size_t min_trials = 16;
+  //< Slot of atoms not of the species
+  static constexpr std::size_t no_slot = -1;
+
+  /**
+   * @brief Compute the energy of an atom placed at a position with the atoms
+   * around it.
+   * @param state The atomic state.
+   * @param cell The simulation cell for periodic boundary conditions.
+   * @param iatom The index of the atom.
+   * @param pos The position to place the atom at.
+   * @return The energy of the atom.
+   */
+  double atom_energy(const DynamicAtomicState& state, const Cell& cell,
+                     std::size_t iatom, const std::array<double, 3>& pos);
+
+  /**
+   * @brief Make one trial move.
+   * @param state The atomic state.
+   * @param cell The cubic simulation cell.
+   */
+  void trial(DynamicAtomicState& state, const CubicCell& cell);
+
+  /**
+   * @brief Remove an atom from the atomic state and the grid, along with its
+   * slot among the species, following the last atom into its place.
+   * @param state The atomic state.
+   * @param iatom The index of the atom.
+   */
+  void remove(DynamicAtomicState& state, std::size_t iatom);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_MONTECARLO_GRAND_CANONICAL_HPP */
@@ -0,0 +1,145 @@
+/**
+ * @brief
+ */
+// Standard Libraries
+#include <memory>
+#include <vector>
+#include <typeinfo>
+#include <exception>
+// Third-party Libraries
+#include <omp.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/interleaved_atomic_state.hpp"
+#include "tyche/integrate/velocity_verlet.hpp"
+#include "tyche/integrate/interleaved_velocity_verlet.hpp"
+#include "tyche/simulation/batched_molecular_dynamics.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+BatchedMolecularDynamics::BatchedMolecularDynamics(
+    std::vector<std::unique_ptr<MolecularDynamics>> replicas)
+    : replicas_(std::move(replicas)), interleaved_forces_(interleave()) {}
+
+// ========================================================================== //
+
+void BatchedMolecularDynamics::run() {
+  if (interleaved()) {
+    run_interleaved();
+  } else {
+    run_threaded();
+  }
+}
+
+// ========================================================================== //
+
+std::unique_ptr<InterleavedForces> BatchedMolecularDynamics::interleave()
+    const {
+  if (replicas_.empty()) return nullptr;
+  const MolecularDynamics& first = *replicas_.front();
+  for (const auto& replica : replicas_) {
+    const Integrate& integrator = *replica->integrator_;
+    if (typeid(integrator) != typeid(VelocityVerlet) ||
+        integrator.adaptive() ||
+        static_cast<const VelocityVerlet&>(integrator).constrained() ||
+        integrator.dt() != first.integrator_->dt() ||
+        integrator.num_steps() != first.integrator_->num_steps() ||
+        integrator.current_step() != first.integrator_->current_step()) {
+      return nullptr;
+    }
+    if (!dynamic_cast<const CubicCell*>(replica->cell_.get())) return nullptr;
+    const DynamicAtomicState& state = *replica->atomic_state_;
+    if (state.atom_type_indices() != first.atomic_state_->atom_type_indices() ||
+        state.inv_mass() != first.atomic_state_->inv_mass()) {
+      return nullptr;
+    }
+    if (replica->forces_->forces().size() != first.forces_->forces().size()) {
+      return nullptr;
+    }
+  }
+
+  auto forces = std::make_unique<InterleavedForces>();
+  for (std::size_t iforce = 0; iforce < first.forces_->forces().size();
+       ++iforce) {
+    std::vector<const Force*> replica_forces;
+    for (const auto& replica : replicas_) {
+      replica_forces.push_back(replica->forces_->forces()[iforce].get());
+    }
+    auto force = replica_forces.front()->interleave(replica_forces);
+    if (!force) return nullptr;
+    forces->add(std::move(force));
+  }
+  return forces;
+}
+
+// ========================================================================== //
+
+void BatchedMolecularDynamics::run_interleaved() {
+  spdlog::info("Running {} replicas interleaved.", replicas_.size());
+  const MolecularDynamics& first = *replicas_.front();
+  InterleavedAtomicState state(*first.atomic_state_, replicas_.size());
+  for (std::size_t ireplica = 0; ireplica < replicas_.size(); ++ireplica) {
+    const MolecularDynamics& replica = *replicas_[ireplica];
+    state.load(ireplica, *replica.atomic_state_,
+               static_cast<const CubicCell&>(*replica.cell_));
+  }
+  // Each replica's forces hold the energies of their last evaluation, so that
+  // its potential energy can be read without evaluating them again
+  auto store_energies = [&](std::size_t ireplica) {
+    Forces& forces = *replicas_[ireplica]->forces_;
+    for (std::size_t iforce = 0; iforce < forces.forces().size(); ++iforce) {
+      forces.set_energy(iforce, interleaved_forces_->energy(iforce, ireplica));
+    }
+  };
+  interleaved_forces_->evaluate(state);
+  for (std::size_t ireplica = 0; ireplica < replicas_.size(); ++ireplica) {
+    store_energies(ireplica);
+  }
+
+  InterleavedVelocityVerlet integrator(first.integrator_->dt());
+  while (!first.finished()) {
+    integrator.step(state, *interleaved_forces_);
+    for (std::size_t ireplica = 0; ireplica < replicas_.size(); ++ireplica) {
+      MolecularDynamics& replica = *replicas_[ireplica];
+      store_energies(ireplica);
+      replica.integrator_->count_step();
+      const std::size_t istep = replica.integrator_->current_step();
+      // Writers read the replica's own state, so copy it out only when due
+      if (!replica.due(istep)) continue;
+      state.store(ireplica, *replica.atomic_state_);
+      replica.write(istep, replica.integrator_->time());
+    }
+  }
+
+  for (std::size_t ireplica = 0; ireplica < replicas_.size(); ++ireplica) {
+    state.store(ireplica, *replicas_[ireplica]->atomic_state_);
+  }
+}
+
+// ========================================================================== //
+
+void BatchedMolecularDynamics::run_threaded() {
+  spdlog::info("Running {} replicas over {} thread/s.", replicas_.size(),
+               omp_get_max_threads());
+  // Exceptions can't leave a parallel region, so hold them until it's done
+  std::vector<std::exception_ptr> errors(replicas_.size());
+#pragma omp parallel for schedule(dynamic, 1)
+  for (std::size_t ireplica = 0; ireplica < replicas_.size(); ++ireplica) {
+    // Regions nested within the replica's kernels run on this thread alone
+    omp_set_num_threads(1);
+    try {
+      replicas_[ireplica]->run();
+    } catch (...) {
+      errors[ireplica] = std::current_exception();
+    }
+  }
+  for (auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
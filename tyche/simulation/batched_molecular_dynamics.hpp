@@ -0,0 +1,97 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_BATCHED_MOLECULAR_DYNAMICS_HPP
+#define __TYCHE_SIMULATION_BATCHED_MOLECULAR_DYNAMICS_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/force/interleaved_force.hpp"
+#include "tyche/simulation/simulation.hpp"
+#include "tyche/simulation/molecular_dynamics.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Batch of independent molecular dynamics replicas of the same system,
+ * e.g. for parameter sweeps or uncertainty quantification.
+ *
+ * Systems of a few hundred atoms are too small to vectorise well over their
+ * atoms, so where they can the replicas are interleaved instead, one replica
+ * per lane, and stepped together. This is the case if every replica
+ * integrates with plain VelocityVerlet, sharing the time increment and number
+ * of steps, sits in a cubic cell, and has forces which all interleave, as
+ * pair potentials do. Each replica's state, virial included, is copied back
+ * out whenever one of its writers is due, and at the end of the run, and the
+ * energy of each of its forces is written back to them every step.
+ *
+ * Otherwise each replica runs on a single thread, and the replicas are shared
+ * between threads. Either way, each keeps its own cell, random streams and
+ * writers.
+ */
+class BatchedMolecularDynamics : public Simulation {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param replicas The replicas to run.
+   */
+  explicit BatchedMolecularDynamics(
+      std::vector<std::unique_ptr<MolecularDynamics>> replicas);
+
+  /**
+   * @brief Run every replica to completion, either interleaved or one per
+   * thread at a time.
+   */
+  void run() override;
+
+  /**
+   * @brief Getter for the number of replicas.
+   * @return The number of replicas.
+   */
+  std::size_t num_replicas() const { return replicas_.size(); }
+
+  /**
+   * @brief Whether the replicas are stepped together, interleaved.
+   * @return True if the replicas are interleaved.
+   */
+  bool interleaved() const { return interleaved_forces_ != nullptr; }
+
+  /**
+   * @brief Getter for one of the replicas.
+   * @param ireplica The index of the replica.
+   * @return The replica.
+   */
+  const MolecularDynamics& replica(std::size_t ireplica) const {
+    return *replicas_[ireplica];
+  }
+
+ private:
+  std::vector<std::unique_ptr<MolecularDynamics>> replicas_;
+  //< Forces of every replica interleaved together, if the replicas interleave
+  std::unique_ptr<InterleavedForces> interleaved_forces_;
+
+  /**
+   * @brief Interleave the forces of the replicas, if the replicas can be
+   * stepped together.
+   * @return The interleaved forces, or nullptr if they can't.
+   */
+  std::unique_ptr<InterleavedForces> interleave() const;
+
+  /**
+   * @brief Step every replica together, interleaved.
+   */
+  void run_interleaved();
+
+  /**
+   * @brief Run each replica on a single thread.
+   */
+  void run_threaded();
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_BATCHED_MOLECULAR_DYNAMICS_HPP */
@@ -0,0 +1,63 @@
+/**
+ * @brief
+ */
+// Standard Libraries
+#include <memory>
+// Third-party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/simulation/grand_canonical_monte_carlo.hpp"
+#include "tyche/simulation/grand_canonical_monte_carlo_builder.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+GrandCanonicalMonteCarloBuilder GrandCanonicalMonteCarlo::create(
+    std::shared_ptr<DynamicAtomicState> atomic_state) {
+  return GrandCanonicalMonteCarloBuilder(atomic_state);
+}
+
+// ========================================================================== //
+
+void GrandCanonicalMonteCarlo::run() {
+  moves_->initialise(*atomic_state_, *cell_);
+  spdlog::info("Running {} sweeps from {} atoms of the species, energy {}.",
+               num_sweeps_, moves_->num_species(), moves_->energy());
+  sum_species_ = 0;
+  while (moves_->current_sweep() < num_sweeps_) {
+    moves_->sweep(*atomic_state_, *cell_);
+    sum_species_ += moves_->num_species();
+    write(moves_->current_sweep());
+  }
+
+  const auto& moves = *moves_;
+  const char* names[] = {"Displacements", "Insertions", "Removals"};
+  for (std::size_t move = 0; move < GrandCanonical::NumMoves; ++move) {
+    const auto kind = GrandCanonical::Move(move);
+    const double ratio =
+        moves.attempted(kind)
+            ? double(moves.accepted(kind)) / moves.attempted(kind)
+            : 0;
+    spdlog::info("{}: {} of {} accepted ({:.1f}%).", names[move],
+                 moves.accepted(kind), moves.attempted(kind), 100 * ratio);
+  }
+  spdlog::info("Mean of {} atoms of the species, final energy {}.",
+               mean_num_species(), moves.energy());
+}
+
+// ========================================================================== //
+
+void GrandCanonicalMonteCarlo::write(std::size_t isweep) {
+  std::string comment = fmt::format("Sweep {}, energy {}", isweep,
+                                    moves_->energy());
+  for (auto& writer : writers_) {
+    if (!(isweep % writer.frequency)) {
+      writer.writer->write(comment);
+    }
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
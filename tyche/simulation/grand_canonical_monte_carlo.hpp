@@ -0,0 +1,90 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_GRAND_CANONICAL_MONTE_CARLO_HPP
+#define __TYCHE_SIMULATION_GRAND_CANONICAL_MONTE_CARLO_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/writer.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/montecarlo/grand_canonical.hpp"
+#include "tyche/simulation/simulation.hpp"
+
+namespace tyche {
+
+// Forward-declaration of the builder for GrandCanonicalMonteCarlo objects
+class GrandCanonicalMonteCarloBuilder;
+
+/**
+ * @brief Grand canonical Monte Carlo sampling of the atomic state, inserting
+ * and removing atoms of one species in place, e.g. to find how much of a gas
+ * adsorbs into a framework at some temperature and fugacity.
+ */
+class GrandCanonicalMonteCarlo : public Simulation {
+ public:
+  /**
+   * @brief Run the parameterised number of sweeps, then report the mean number
+   * of atoms of the species and the acceptance of each kind of move.
+   */
+  void run() override;
+
+  /**
+   * @brief Getter for the grand canonical moves.
+   * @return The moves.
+   */
+  const GrandCanonical& moves() const { return *moves_; }
+
+  /**
+   * @brief Getter for the mean number of atoms of the species after each
+   * sweep.
+   * @return The mean number of atoms.
+   */
+  double mean_num_species() const {
+    return num_sweeps_ ? double(sum_species_) / num_sweeps_ : 0;
+  }
+
+  /**
+   * @brief Create a new instance of the GrandCanonicalMonteCarloBuilder.
+   * @return A new GrandCanonicalMonteCarloBuilder instance.
+   */
+  static GrandCanonicalMonteCarloBuilder create(
+      std::shared_ptr<DynamicAtomicState> atomic_state);
+
+  friend GrandCanonicalMonteCarloBuilder;
+
+ private:
+  /**
+   * @brief Collection of control variables and corresponding writer.
+   */
+  struct WriterConfig {
+    //< Frequency of writing; number of sweeps between writes
+    std::size_t frequency;
+    //< The writer we write to
+    std::unique_ptr<Writer> writer;
+  };
+
+  std::shared_ptr<DynamicAtomicState> atomic_state_;
+  std::unique_ptr<Cell> cell_;
+  std::unique_ptr<GrandCanonical> moves_;
+  std::size_t num_sweeps_ = 0;
+  //< Sum of the number of atoms of the species after each sweep
+  std::size_t sum_species_ = 0;
+  std::vector<WriterConfig> writers_;
+
+  /**
+   * @brief Write to all writers registered to the simulation.
+   * @param isweep The current sweep.
+   */
+  void write(std::size_t isweep);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_GRAND_CANONICAL_MONTE_CARLO_HPP */
@@ -0,0 +1,90 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <string>
+#include <stdexcept>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/must.hpp"
+#include "tyche/io/writer_factory.hpp"
+#include "tyche/system/cell_factory.hpp"
+#include "tyche/simulation/monte_carlo_builder.hpp"
+#include "tyche/simulation/grand_canonical_monte_carlo_builder.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+GrandCanonicalMonteCarloBuilder::GrandCanonicalMonteCarloBuilder(
+    std::shared_ptr<DynamicAtomicState> atomic_state) {
+  simulation_.atomic_state_ = atomic_state;
+}
+
+// ========================================================================== //
+
+GrandCanonicalMonteCarloBuilder& GrandCanonicalMonteCarloBuilder::moves(
+    Reader::Mapping map) {
+  auto name = must_find<std::string>(map, "species");
+  species_ = nullptr;
+  for (const auto& [atom_type, idx] :
+       simulation_.atomic_state_->atom_type_idx()) {
+    if (atom_type->id() == name) species_ = atom_type;
+  }
+  if (!species_) {
+    throw std::runtime_error("Unrecognised species: " + name);
+  }
+  temperature_ = must_find<double>(map, "temperature");
+  fugacity_ = must_find<double>(map, "fugacity");
+  step_ = must_find<double>(map, "step");
+  seed_ = must_find<double>(map, "seed");
+  simulation_.num_sweeps_ = must_find<double>(map, "num_sweeps");
+  spdlog::info("Grand canonical moves of {} at {} K and fugacity {} bar.", name,
+               temperature_, fugacity_);
+  return *this;
+}
+
+// ========================================================================== //
+
+GrandCanonicalMonteCarloBuilder& GrandCanonicalMonteCarloBuilder::force(
+    Reader::Mapping map) {
+  forces_.push_back(
+      MonteCarloBuilder::pairwise_force(map, *simulation_.atomic_state_));
+  return *this;
+}
+
+// ========================================================================== //
+
+GrandCanonicalMonteCarloBuilder& GrandCanonicalMonteCarloBuilder::cell(
+    Reader::Mapping map) {
+  simulation_.cell_ = CellFactory::create(map);
+  return *this;
+}
+
+// ========================================================================== //
+
+GrandCanonicalMonteCarloBuilder& GrandCanonicalMonteCarloBuilder::output(
+    Reader::Mapping map) {
+  GrandCanonicalMonteCarlo::WriterConfig writer_config;
+  writer_config.writer = WriterFactory::create(map, simulation_.atomic_state_);
+  writer_config.frequency = must_find<double>(map, "frequency");
+  simulation_.writers_.push_back(std::move(writer_config));
+  return *this;
+}
+
+// ========================================================================== //
+
+GrandCanonicalMonteCarlo GrandCanonicalMonteCarloBuilder::build() {
+  if (!species_) {
+    throw std::runtime_error(
+        "Grand canonical Monte Carlo needs its moves set.");
+  }
+  simulation_.moves_ = std::make_unique<GrandCanonical>(
+      std::move(forces_), species_, temperature_, fugacity_, step_, seed_);
+  return std::move(simulation_);
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
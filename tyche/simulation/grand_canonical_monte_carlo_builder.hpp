@@ -0,0 +1,87 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_GRAND_CANONICAL_MONTE_CARLO_BUILDER_HPP
+#define __TYCHE_SIMULATION_GRAND_CANONICAL_MONTE_CARLO_BUILDER_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/reader.hpp"
+#include "tyche/atom/atom_type.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/pair_potential.hpp"
+#include "tyche/simulation/grand_canonical_monte_carlo.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Builder for a GrandCanonicalMonteCarlo object.
+ */
+class GrandCanonicalMonteCarloBuilder {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param atomic_state The atomic state we're going to sample, which must
+   * know the species' atom type, even if it has no atoms of it.
+   */
+  GrandCanonicalMonteCarloBuilder(
+      std::shared_ptr<DynamicAtomicState> atomic_state);
+
+  /**
+   * @brief Set the moves for the GrandCanonicalMonteCarlo object, which are
+   * created once the forces are known.
+   * @param map Mapping containing the "species", the name of the atom type
+   * inserted and removed, the "temperature", the "fugacity" in bar, the
+   * half-width of displacements "step", the number of sweeps "num_sweeps" and
+   * the random "seed".
+   * @return The modified builder.
+   */
+  GrandCanonicalMonteCarloBuilder& moves(Reader::Mapping map);
+
+  /**
+   * @brief Set force evaluation object for the GrandCanonicalMonteCarlo
+   * object, which must be pairwise additive with a cutoff.
+   * @param map Mapping containing force creation parameters.
+   * @return The modified builder.
+   */
+  GrandCanonicalMonteCarloBuilder& force(Reader::Mapping map);
+
+  /**
+   * @brief Create a Cell for the GrandCanonicalMonteCarlo object.
+   * @param map Mapping containing cell creation parameters.
+   * @return The modified builder.
+   */
+  GrandCanonicalMonteCarloBuilder& cell(Reader::Mapping map);
+
+  /**
+   * @brief Create a Writer for the GrandCanonicalMonteCarlo object. Only
+   * writers of the atomic state make sense, since there's no integrator.
+   * @param map Mapping containing writer creation parameters.
+   * @return The modified builder.
+   */
+  GrandCanonicalMonteCarloBuilder& output(Reader::Mapping map);
+
+  /**
+   * @brief Return the built GrandCanonicalMonteCarlo object.
+   * @return The final GrandCanonicalMonteCarlo object.
+   */
+  GrandCanonicalMonteCarlo build();
+
+ private:
+  GrandCanonicalMonteCarlo simulation_;
+  std::vector<std::unique_ptr<PairwiseForce>> forces_;
+
+  //< Parameters of the moves, held until the forces are known
+  std::shared_ptr<AtomType> species_;
+  double temperature_, fugacity_, step_;
+  std::uint64_t seed_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_GRAND_CANONICAL_MONTE_CARLO_BUILDER_HPP */
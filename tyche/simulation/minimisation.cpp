@@ -0,0 +1,61 @@
+/**
+ * @brief
+ */
+// Standard Libraries
+#include <memory>
+// Third-party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/simulation/minimisation.hpp"
+#include "tyche/simulation/minimisation_builder.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Minimisation::Minimisation() { forces_ = std::make_unique<Forces>(); }
+
+// ========================================================================== //
+
+MinimisationBuilder Minimisation::create(
+    std::shared_ptr<DynamicAtomicState> atomic_state) {
+  return MinimisationBuilder(atomic_state);
+}
+
+// ========================================================================== //
+
+void Minimisation::run() {
+  minimiser_->initialise(*atomic_state_,
+                         forces_->evaluate(*atomic_state_, *cell_));
+  spdlog::info("Initial energy {}, largest force {}.", minimiser_->energy(),
+               minimiser_->max_force());
+  while (!minimiser_->finished()) {
+    minimiser_->step(*atomic_state_, *forces_, *cell_);
+    write(minimiser_->current_step(), minimiser_->finished());
+  }
+  if (minimiser_->converged()) {
+    spdlog::info("Converged after {} steps.", minimiser_->current_step());
+  } else {
+    spdlog::warn("Didn't converge within {} steps.",
+                 minimiser_->current_step());
+  }
+  spdlog::info("Final energy {}, largest force {}.", minimiser_->energy(),
+               minimiser_->max_force());
+}
+
+// ========================================================================== //
+
+void Minimisation::write(std::size_t istep, bool last) {
+  std::string comment =
+      fmt::format("Step {}, energy {}", istep, minimiser_->energy());
+  for (auto& writer : writers_) {
+    if (last || !(istep % writer.frequency)) {
+      writer.writer->write(comment);
+    }
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,78 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_MINIMISATION_HPP
+#define __TYCHE_SIMULATION_MINIMISATION_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/writer.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/minimise/minimise.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/simulation/simulation.hpp"
+
+namespace tyche {
+
+// Forward-declaration of the builder for Minimisation objects
+class MinimisationBuilder;
+
+/**
+ * @brief Minimisation of the potential energy of the atomic state, e.g. to
+ * relax a structure before molecular dynamics.
+ */
+class Minimisation : public Simulation {
+ public:
+  /**
+   * @brief Class constructor.
+   */
+  Minimisation();
+
+  /**
+   * @brief Run the minimiser until it converges or runs out of steps.
+   */
+  void run() override;
+
+  /**
+   * @brief Create a new instance of the MinimisationBuilder.
+   * @return A new MinimisationBuilder instance.
+   */
+  static MinimisationBuilder create(
+      std::shared_ptr<DynamicAtomicState> atomic_state);
+
+  friend MinimisationBuilder;
+
+ private:
+  /**
+   * @brief Collection of control variables and corresponding writer.
+   */
+  struct WriterConfig {
+    //< Frequency of writing; number of steps between writes
+    std::size_t frequency;
+    //< The writer we write to
+    std::unique_ptr<Writer> writer;
+  };
+
+  std::shared_ptr<DynamicAtomicState> atomic_state_;
+  std::unique_ptr<Cell> cell_;
+  std::unique_ptr<Minimise> minimiser_;
+  std::unique_ptr<Forces> forces_;
+  std::vector<WriterConfig> writers_;
+
+  /**
+   * @brief Write to all writers registered to the simulation.
+   * @param istep The current step of the minimiser.
+   * @param last Whether this is the last step, whose structure is written
+   * regardless of the frequency.
+   */
+  void write(std::size_t istep, bool last);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_MINIMISATION_HPP */
@@ -0,0 +1,64 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+//
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/must.hpp"
+#include "tyche/io/writer_factory.hpp"
+#include "tyche/system/cell_factory.hpp"
+#include "tyche/force/force_factory.hpp"
+#include "tyche/minimise/minimise_factory.hpp"
+#include "tyche/simulation/minimisation_builder.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+MinimisationBuilder::MinimisationBuilder(
+    std::shared_ptr<DynamicAtomicState> atomic_state) {
+  simulation_.atomic_state_ = atomic_state;
+}
+
+// ========================================================================== //
+
+MinimisationBuilder& MinimisationBuilder::minimiser(Reader::Mapping map) {
+  simulation_.minimiser_ = MinimiseFactory::create(map);
+  return *this;
+}
+
+// ========================================================================== //
+
+MinimisationBuilder& MinimisationBuilder::force(Reader::Mapping map) {
+  simulation_.forces_->add(
+      ForceFactory::create(map, simulation_.atomic_state_->atom_type_idx(),
+                           simulation_.atomic_state_->topology()));
+  return *this;
+}
+
+// ========================================================================== //
+
+MinimisationBuilder& MinimisationBuilder::cell(Reader::Mapping map) {
+  simulation_.cell_ = CellFactory::create(map);
+  return *this;
+}
+
+// ========================================================================== //
+
+MinimisationBuilder& MinimisationBuilder::output(Reader::Mapping map) {
+  Minimisation::WriterConfig writer_config;
+  writer_config.writer = WriterFactory::create(map, simulation_.atomic_state_);
+  writer_config.frequency = must_find<double>(map, "frequency");
+  simulation_.writers_.push_back(std::move(writer_config));
+  return *this;
+}
+
+// ========================================================================== //
+
+Minimisation MinimisationBuilder::build() { return std::move(simulation_); }
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,70 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_MINIMISATION_BUILDER_HPP
+#define __TYCHE_SIMULATION_MINIMISATION_BUILDER_HPP
+
+// C++ Standard Libraries
+#include <memory>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/simulation/minimisation.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Builder for a Minimisation object.
+ */
+class MinimisationBuilder {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param atomic_state The atomic state we're going to minimise.
+   */
+  MinimisationBuilder(std::shared_ptr<DynamicAtomicState> atomic_state);
+
+  /**
+   * @brief Set the minimiser for the Minimisation object.
+   * @param map Mapping containing minimiser creation parameters.
+   * @return The modified builder.
+   */
+  MinimisationBuilder& minimiser(Reader::Mapping map);
+
+  /**
+   * @brief Set force evaluation object for the Minimisation object.
+   * @param map Mapping containing force creation parameters.
+   * @return The modified builder.
+   */
+  MinimisationBuilder& force(Reader::Mapping map);
+
+  /**
+   * @brief Create a Cell for the Minimisation object.
+   * @param map Mapping containing cell creation parameters.
+   * @return The modified builder.
+   */
+  MinimisationBuilder& cell(Reader::Mapping map);
+
+  /**
+   * @brief Create a Writer for the Minimisation object. Only writers of the
+   * atomic state make sense, since there's no integrator.
+   * @param map Mapping containing writer creation parameters.
+   * @return The modified builder.
+   */
+  MinimisationBuilder& output(Reader::Mapping map);
+
+  /**
+   * @brief Return the built Minimisation object.
+   * @return The final Minimisation object.
+   */
+  Minimisation build();
+
+ private:
+  Minimisation simulation_;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_MINIMISATION_BUILDER_HPP */
@@ -4,7 +4,7 @@
 // Standard Libraries
 #include <memory>
 // Third-party Libraries
-//
+#include <spdlog/spdlog.h>
 // Project Inclusions
 #include "tyche/atom/dynamic_atomic_state.hpp"
 #include "tyche/simulation/molecular_dynamics.hpp"
@@ -32,17 +32,46 @@ MolecularDynamicsBuilder MolecularDynamics::create(
 // ========================================================================== //
 
 void MolecularDynamics::run() {
+  start();
+  advance(integrator_->num_steps());
+}
+
+// ========================================================================== //
+
+void MolecularDynamics::start() {
+  forces_->set_step(integrator_->current_step());
+  forces_->set_dt(integrator_->dt());
   forces_->evaluate(*atomic_state_, *cell_);
-  while (integrator_->current_step() < integrator_->num_steps()) {
+  integrator_->adapt_timestep(*atomic_state_);
+}
+
+// ========================================================================== //
+
+void MolecularDynamics::advance(std::size_t num_steps) {
+  for (std::size_t istep = 0; istep < num_steps && !finished(); ++istep) {
+    forces_->set_step(integrator_->current_step());
+    forces_->set_dt(integrator_->dt());
     integrator_->step(*atomic_state_, *forces_, *cell_);
-    write(integrator_->current_step());
+    write(integrator_->current_step(), integrator_->time());
+  }
+  integrator_->flush(*atomic_state_);
+}
+
+// ========================================================================== //
+
+bool MolecularDynamics::due(std::size_t istep) const {
+  for (const auto& writer : writers_) {
+    if (!(istep % writer.frequency)) return true;
   }
+  return false;
 }
 
 // ========================================================================== //
 
-void MolecularDynamics::write(std::size_t istep) {
-  std::string comment = "Step " + std::to_string(istep);
+void MolecularDynamics::write(std::size_t istep, double time) {
+  if (!due(istep)) return;
+  integrator_->flush(*atomic_state_);
+  std::string comment = fmt::format("Step {}, time {}fs", istep, time);
   for (auto& writer : writers_) {
     if (!(istep % writer.frequency)) {
       writer.writer->write(comment);
@@ -23,6 +23,8 @@ namespace tyche {
 
 // Forward-declaration of the builder for MolecularDynamics objects
 class MolecularDynamicsBuilder;
+// Forward-declaration of batches of MolecularDynamics objects
+class BatchedMolecularDynamics;
 
 /**
  * @brief Molecular dynamics simulation.
@@ -39,6 +41,61 @@ class MolecularDynamics : public Simulation {
    */
   void run() override;
 
+  /**
+   * @brief Evaluate the forces on the atoms ahead of the first step, and adapt
+   * the time increment to them. Needed only when stepping with advance(), as
+   * run() does this itself.
+   */
+  void start();
+
+  /**
+   * @brief Take a number of steps, writing as parameterised, but stopping
+   * early at the last step of the simulation. The atomic state is left up to
+   * date, as by Integrate::flush.
+   * @param num_steps The number of steps to take.
+   */
+  void advance(std::size_t num_steps);
+
+  /**
+   * @brief Whether the simulation has taken all of its steps.
+   * @return Whether the simulation is finished.
+   */
+  bool finished() const {
+    return integrator_->current_step() >= integrator_->num_steps();
+  }
+
+  /**
+   * @brief Getter for the potential energy of the atomic state, as the
+   * integrator last evaluated it, without evaluating the forces again.
+   * @return The potential energy.
+   */
+  double potential_energy() const {
+    return integrator_->potential(*forces_);
+  }
+
+  /**
+   * @brief Getter for the atomic state being propagated.
+   * @return The atomic state.
+   */
+  const DynamicAtomicState& atomic_state() const { return *atomic_state_; }
+
+  /**
+   * @brief Getter for the thermostat of the integrator.
+   * @return The thermostat, or nullptr if the integrator doesn't thermostat.
+   */
+  Thermostat* thermostat() {
+    return dynamic_cast<Thermostat*>(integrator_.get());
+  }
+
+  /**
+   * @brief Change the temperature of the thermostat, scaling velocities to
+   * match. The integrator must thermostat.
+   * @param temp The new temperature.
+   */
+  void set_temperature(double temp) {
+    thermostat()->set_temperature(*atomic_state_, temp);
+  }
+
   /**
    * @brief Create a new instance of the MolecularDynamicsBuilder.
    * @return A new MolecularDynamicsBuilder instance.
@@ -47,6 +104,7 @@ class MolecularDynamics : public Simulation {
       std::shared_ptr<DynamicAtomicState> atomic_state);
 
   friend MolecularDynamicsBuilder;
+  friend BatchedMolecularDynamics;
 
  private:
   /**
@@ -66,10 +124,20 @@ class MolecularDynamics : public Simulation {
   std::vector<WriterConfig> writers_;
 
   /**
-   * @brief Write to all writers registered to the simulation.
+   * @brief Whether any writer writes at a step.
+   * @param istep The step of the simulation.
+   * @return True if a writer is due.
+   */
+  bool due(std::size_t istep) const;
+
+  /**
+   * @brief Write to all writers due at the step, flushing the integrator
+   * first so that they read the atomic state up to date.
    * @param istep The current step of the simulation.
+   * @param time The simulated time, which isn't a multiple of the step when
+   * the timestep adapts.
    */
-  void write(std::size_t istep);
+  void write(std::size_t istep, double time);
 };
 
 }  // namespace tyche
@@ -2,15 +2,17 @@
  * @brief
  */
 // C++ Standard Libraries
-//
+#include <stdexcept>
 // Third-Party Libraries
 //
 // Project Inclusions
 #include "tyche/util/must.hpp"
+#include "tyche/util/maybe.hpp"
 #include "tyche/io/writer_factory.hpp"
 #include "tyche/system/cell_factory.hpp"
 #include "tyche/force/force_factory.hpp"
 #include "tyche/integrate/integrate_factory.hpp"
+#include "tyche/integrate/velocity_verlet_fourth_order.hpp"
 #include "tyche/simulation/molecular_dynamics_builder.hpp"
 
 namespace tyche {
@@ -26,15 +28,21 @@ MolecularDynamicsBuilder::MolecularDynamicsBuilder(
 
 MolecularDynamicsBuilder& MolecularDynamicsBuilder::integrator(
     Reader::Mapping map) {
-  simulation_.integrator_ = std::move(IntegrateFactory::create(map));
+  simulation_.integrator_ = std::move(
+      IntegrateFactory::create(map, simulation_.atomic_state_->topology()));
   return *this;
 }
 
 // ========================================================================== //
 
 MolecularDynamicsBuilder& MolecularDynamicsBuilder::force(Reader::Mapping map) {
+  // Forces are evaluated every step at level 0, unless they're marked as
+  // slower for a multiple time-step integrator
+  auto level = maybe_find<double>(map, "level").value_or(0);
   simulation_.forces_->add(
-      ForceFactory::create(map, simulation_.atomic_state_->atom_type_idx()));
+      ForceFactory::create(map, simulation_.atomic_state_->atom_type_idx(),
+                           simulation_.atomic_state_->topology()),
+      level);
   return *this;
 }
 
@@ -60,6 +68,15 @@ MolecularDynamicsBuilder& MolecularDynamicsBuilder::output(
 // ========================================================================== //
 
 MolecularDynamics MolecularDynamicsBuilder::build() {
+  // Fourth-order compositions take sub-steps of other increments than the
+  // step's, some of them backwards, which forces following it can't follow
+  if (dynamic_cast<const VelocityVerletFourthOrder*>(
+          simulation_.integrator_.get()) &&
+      simulation_.forces_->depends_on_dt()) {
+    throw std::runtime_error(
+        "Fourth-order Velocity Verlet can't take forces which depend on the "
+        "time increment, such as DPD.");
+  }
   // Apply any post-construction manipulations to the atomic state
   simulation_.integrator_->initialise(*simulation_.atomic_state_);
   return std::move(simulation_);
@@ -0,0 +1,55 @@
+/**
+ * @brief
+ */
+// Standard Libraries
+#include <memory>
+// Third-party Libraries
+#include <omp.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/simulation/monte_carlo.hpp"
+#include "tyche/simulation/monte_carlo_builder.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+MonteCarloBuilder MonteCarlo::create(
+    std::shared_ptr<DynamicAtomicState> atomic_state) {
+  return MonteCarloBuilder(atomic_state);
+}
+
+// ========================================================================== //
+
+void MonteCarlo::run() {
+  spdlog::info("Running {} sweeps of {} atoms over {} thread/s.", num_sweeps_,
+               atomic_state_->num_atoms(), omp_get_max_threads());
+  cache_->compute(*atomic_state_, *cell_);
+  spdlog::info("Initial energy {}.", cache_->total());
+  while (moves_->current_sweep() < num_sweeps_) {
+    moves_->sweep(*atomic_state_, *cell_, *cache_);
+    write(moves_->current_sweep());
+  }
+  const auto& moves = *moves_;
+  const double ratio =
+      moves.attempted() ? double(moves.accepted()) / moves.attempted() : 0;
+  spdlog::info("Moves of up to {}: {} of {} accepted ({:.1f}%).", moves.step(),
+               moves.accepted(), moves.attempted(), 100 * ratio);
+  spdlog::info("Final energy {}.", cache_->total());
+}
+
+// ========================================================================== //
+
+void MonteCarlo::write(std::size_t isweep) {
+  std::string comment =
+      fmt::format("Sweep {}, energy {}", isweep, cache_->total());
+  for (auto& writer : writers_) {
+    if (!(isweep % writer.frequency)) {
+      writer.writer->write(comment);
+    }
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
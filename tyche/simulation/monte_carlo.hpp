@@ -0,0 +1,87 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_MONTE_CARLO_HPP
+#define __TYCHE_SIMULATION_MONTE_CARLO_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/writer.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/force/pair_potential.hpp"
+#include "tyche/montecarlo/energy_cache.hpp"
+#include "tyche/montecarlo/displacement.hpp"
+#include "tyche/simulation/simulation.hpp"
+
+namespace tyche {
+
+// Forward-declaration of the builder for MonteCarlo objects
+class MonteCarloBuilder;
+
+/**
+ * @brief Metropolis Monte Carlo sampling of the atomic state in the NVT
+ * ensemble, by displacements of single atoms under pairwise additive forces.
+ */
+class MonteCarlo : public Simulation {
+ public:
+  /**
+   * @brief Run the parameterised number of sweeps, then report the acceptance
+   * of moves.
+   */
+  void run() override;
+
+  /**
+   * @brief Getter for the potential energy, from the energies cached by the
+   * moves.
+   * @return The potential energy.
+   */
+  double potential_energy() const { return cache_->total(); }
+
+  /**
+   * @brief Getter for the displacement moves.
+   * @return The moves.
+   */
+  const Displacement& moves() const { return *moves_; }
+
+  /**
+   * @brief Create a new instance of the MonteCarloBuilder.
+   * @return A new MonteCarloBuilder instance.
+   */
+  static MonteCarloBuilder create(
+      std::shared_ptr<DynamicAtomicState> atomic_state);
+
+  friend MonteCarloBuilder;
+
+ private:
+  /**
+   * @brief Collection of control variables and corresponding writer.
+   */
+  struct WriterConfig {
+    //< Frequency of writing; number of sweeps between writes
+    std::size_t frequency;
+    //< The writer we write to
+    std::unique_ptr<Writer> writer;
+  };
+
+  std::shared_ptr<DynamicAtomicState> atomic_state_;
+  std::unique_ptr<Cell> cell_;
+  std::unique_ptr<Displacement> moves_;
+  std::unique_ptr<EnergyCache> cache_;
+  std::size_t num_sweeps_ = 0;
+  std::vector<WriterConfig> writers_;
+
+  /**
+   * @brief Write to all writers registered to the simulation.
+   * @param isweep The current sweep.
+   */
+  void write(std::size_t isweep);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_MONTE_CARLO_HPP */
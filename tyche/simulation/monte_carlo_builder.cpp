@@ -0,0 +1,100 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <string>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/must.hpp"
+#include "tyche/util/maybe.hpp"
+#include "tyche/io/writer_factory.hpp"
+#include "tyche/system/cell_factory.hpp"
+#include "tyche/force/force_factory.hpp"
+#include "tyche/simulation/monte_carlo_builder.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+MonteCarloBuilder::MonteCarloBuilder(
+    std::shared_ptr<DynamicAtomicState> atomic_state)
+    : skin_(default_skin) {
+  simulation_.atomic_state_ = atomic_state;
+}
+
+// ========================================================================== //
+
+MonteCarloBuilder& MonteCarloBuilder::moves(Reader::Mapping map) {
+  auto temperature = must_find<double>(map, "temperature");
+  auto step = must_find<double>(map, "step");
+  auto max_step = maybe_find<double>(map, "max_step").value_or(step);
+  auto target = maybe_find<double>(map, "target_acceptance").value_or(0.5);
+  auto adjust_sweeps = maybe_find<double>(map, "adjust_sweeps").value_or(0);
+  auto order = maybe_find<std::string>(map, "sweep").value_or("Ordered");
+  if (order != "Ordered" && order != "Checkerboard") {
+    throw std::runtime_error("Unrecognised Monte Carlo sweep: " + order);
+  }
+  simulation_.moves_ = std::make_unique<Displacement>(
+      temperature, step, max_step, target, adjust_sweeps,
+      order == "Checkerboard", must_find<double>(map, "seed"));
+  simulation_.num_sweeps_ = must_find<double>(map, "num_sweeps");
+  skin_ = maybe_find<double>(map, "skin").value_or(skin_);
+  return *this;
+}
+
+// ========================================================================== //
+
+MonteCarloBuilder& MonteCarloBuilder::force(Reader::Mapping map) {
+  forces_.push_back(pairwise_force(map, *simulation_.atomic_state_));
+  return *this;
+}
+
+// ========================================================================== //
+
+MonteCarloBuilder& MonteCarloBuilder::cell(Reader::Mapping map) {
+  simulation_.cell_ = CellFactory::create(map);
+  return *this;
+}
+
+// ========================================================================== //
+
+MonteCarloBuilder& MonteCarloBuilder::output(Reader::Mapping map) {
+  MonteCarlo::WriterConfig writer_config;
+  writer_config.writer = WriterFactory::create(map, simulation_.atomic_state_);
+  writer_config.frequency = must_find<double>(map, "frequency");
+  simulation_.writers_.push_back(std::move(writer_config));
+  return *this;
+}
+
+// ========================================================================== //
+
+MonteCarlo MonteCarloBuilder::build() {
+  if (!simulation_.moves_) {
+    throw std::runtime_error("Monte Carlo needs its moves set.");
+  }
+  simulation_.cache_ = std::make_unique<EnergyCache>(
+      std::move(forces_), skin_, simulation_.moves_->max_step());
+  return std::move(simulation_);
+}
+
+// ========================================================================== //
+
+std::unique_ptr<PairwiseForce> MonteCarloBuilder::pairwise_force(
+    Reader::Mapping map, const DynamicAtomicState& atomic_state) {
+  auto force = ForceFactory::create(map, atomic_state.atom_type_idx(),
+                                    atomic_state.topology());
+  auto pairwise = dynamic_cast<PairwiseForce*>(force.get());
+  if (!pairwise) {
+    throw std::runtime_error(
+        "Monte Carlo needs pairwise additive forces with a cutoff, not " +
+        must_find<std::string>(map, "type") + ".");
+  }
+  force.release();
+  return std::unique_ptr<PairwiseForce>(pairwise);
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
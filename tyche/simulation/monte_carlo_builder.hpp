@@ -0,0 +1,92 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_MONTE_CARLO_BUILDER_HPP
+#define __TYCHE_SIMULATION_MONTE_CARLO_BUILDER_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/reader.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+#include "tyche/force/pair_potential.hpp"
+#include "tyche/simulation/monte_carlo.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Builder for a MonteCarlo object.
+ */
+class MonteCarloBuilder {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param atomic_state The atomic state we're going to sample.
+   */
+  MonteCarloBuilder(std::shared_ptr<DynamicAtomicState> atomic_state);
+
+  /**
+   * @brief Set the moves for the MonteCarlo object.
+   * @param map Mapping containing the "temperature", the number of sweeps
+   * "num_sweeps", the initial and largest half-widths of displacements "step"
+   * and "max_step", the "target_acceptance" and number of "adjust_sweeps" over
+   * which the half-width adjusts, the order of the "sweep", either "Ordered" or
+   * "Checkerboard", the neighbour list "skin" and the random "seed".
+   * @return The modified builder.
+   */
+  MonteCarloBuilder& moves(Reader::Mapping map);
+
+  /**
+   * @brief Set force evaluation object for the MonteCarlo object, which must
+   * be pairwise additive with a cutoff.
+   * @param map Mapping containing force creation parameters.
+   * @return The modified builder.
+   */
+  MonteCarloBuilder& force(Reader::Mapping map);
+
+  /**
+   * @brief Create a Cell for the MonteCarlo object.
+   * @param map Mapping containing cell creation parameters.
+   * @return The modified builder.
+   */
+  MonteCarloBuilder& cell(Reader::Mapping map);
+
+  /**
+   * @brief Create a Writer for the MonteCarlo object. Only writers of the
+   * atomic state make sense, since there's no integrator.
+   * @param map Mapping containing writer creation parameters.
+   * @return The modified builder.
+   */
+  MonteCarloBuilder& output(Reader::Mapping map);
+
+  /**
+   * @brief Return the built MonteCarlo object.
+   * @return The final MonteCarlo object.
+   */
+  MonteCarlo build();
+
+  /**
+   * @brief Create a force which must be pairwise additive with a cutoff, as
+   * any Monte Carlo moves over single atoms need.
+   * @param map Mapping containing force creation parameters.
+   * @param atomic_state The atomic state the force acts on.
+   * @return The pairwise additive force.
+   */
+  static std::unique_ptr<PairwiseForce> pairwise_force(
+      Reader::Mapping map, const DynamicAtomicState& atomic_state);
+
+ private:
+  MonteCarlo simulation_;
+  std::vector<std::unique_ptr<PairwiseForce>> forces_;
+  double skin_;
+
+  //< Default neighbour list skin distance, as for the forces
+  static constexpr double default_skin = 1.0;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_MONTE_CARLO_BUILDER_HPP */
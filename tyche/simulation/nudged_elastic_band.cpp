@@ -0,0 +1,99 @@
+/**
+ * @brief
+ */
+// Standard Libraries
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+// Third-party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/simulation/nudged_elastic_band.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+NudgedElasticBand::NudgedElasticBand(std::unique_ptr<ElasticBand> band,
+                                     std::unique_ptr<Cell> cell,
+                                     std::unique_ptr<Minimise> minimiser,
+                                     std::optional<std::size_t> climb_after)
+    : band_(band.get()),
+      cell_(std::move(cell)),
+      minimiser_(std::move(minimiser)),
+      climb_after_(climb_after) {
+  forces_.add(std::move(band));
+}
+
+// ========================================================================== //
+
+void NudgedElasticBand::add_writer(std::size_t image, std::size_t frequency,
+                                   std::unique_ptr<Writer> writer) {
+  if (image >= band_->images().size()) {
+    throw std::runtime_error("Nudged elastic band has no image " +
+                             std::to_string(image) + " to write.");
+  }
+  writers_.push_back({image, frequency, std::move(writer)});
+}
+
+// ========================================================================== //
+
+void NudgedElasticBand::run() {
+  auto& state = *band_->band();
+  minimiser_->initialise(state, forces_.evaluate(state, *cell_));
+  spdlog::info("Initial band of {} images, largest force {}.",
+               band_->images().size(), minimiser_->max_force());
+  while (true) {
+    // Climbing changes the forces, so the minimiser restarts from rest
+    if (climb_after_ && !band_->climbing() &&
+        (minimiser_->current_step() >= *climb_after_ ||
+         minimiser_->converged())) {
+      band_->set_climbing(true);
+      minimiser_->initialise(state, forces_.evaluate(state, *cell_));
+      spdlog::info("Image {} climbing after {} steps.", band_->highest_image(),
+                   minimiser_->current_step());
+    }
+    if (minimiser_->finished()) break;
+    minimiser_->step(state, forces_, *cell_);
+    write(minimiser_->current_step(), false);
+  }
+  write(minimiser_->current_step(), true);
+  if (minimiser_->converged()) {
+    spdlog::info("Converged after {} steps.", minimiser_->current_step());
+  } else {
+    spdlog::warn("Didn't converge within {} steps.",
+                 minimiser_->current_step());
+  }
+  report();
+}
+
+// ========================================================================== //
+
+void NudgedElasticBand::write(std::size_t istep, bool last) {
+  const auto& energies = band_->energies();
+  for (auto& writer : writers_) {
+    // The last step was written already if it fell on the frequency
+    if (last == bool(istep % writer.frequency)) {
+      writer.writer->write(fmt::format("Step {}, image {}, energy {}", istep,
+                                       writer.image,
+                                       energies[writer.image]));
+    }
+  }
+}
+
+// ========================================================================== //
+
+void NudgedElasticBand::report() const {
+  const auto& energies = band_->energies();
+  for (std::size_t image = 0; image < energies.size(); ++image) {
+    spdlog::info("Image {} energy {} relative to the initial state.", image,
+                 energies[image] - energies.front());
+  }
+  const double highest = *std::max_element(energies.begin(), energies.end());
+  spdlog::info("Forward barrier {}, reverse barrier {}.",
+               highest - energies.front(), highest - energies.back());
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,116 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_NUDGED_ELASTIC_BAND_HPP
+#define __TYCHE_SIMULATION_NUDGED_ELASTIC_BAND_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <optional>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/io/writer.hpp"
+#include "tyche/system/cell.hpp"
+#include "tyche/force/force.hpp"
+#include "tyche/minimise/minimise.hpp"
+#include "tyche/minimise/elastic_band.hpp"
+#include "tyche/simulation/simulation.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Minimum energy path between two atomic states by the nudged elastic
+ * band method, with optional climbing image.
+ *
+ * The band of images between the fixed end points is minimised as one atomic
+ * state, with the forces on the images evaluated concurrently by ElasticBand.
+ * If climbing is enabled, the highest image starts to climb once the
+ * minimiser has taken the given number of steps, or once it's converged
+ * without climbing, whichever is sooner; the minimiser is then restarted from
+ * rest. Once minimised, the energy of each image along the path, and the
+ * barriers either way, are logged.
+ */
+class NudgedElasticBand : public Simulation {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param band The elastic band of images along the path.
+   * @param cell The simulation cell, which every image shares.
+   * @param minimiser The minimiser of the band, preferably FIRE.
+   * @param climb_after The number of steps after which the highest image
+   * climbs. Optional; if this isn't provided, no image climbs.
+   */
+  NudgedElasticBand(std::unique_ptr<ElasticBand> band,
+                    std::unique_ptr<Cell> cell,
+                    std::unique_ptr<Minimise> minimiser,
+                    std::optional<std::size_t> climb_after);
+
+  /**
+   * @brief Register a writer of one image along the path.
+   * @param image The index of the image, counting the end points.
+   * @param frequency The number of steps between writes.
+   * @param writer The writer, which writes the image's atomic state.
+   */
+  void add_writer(std::size_t image, std::size_t frequency,
+                  std::unique_ptr<Writer> writer);
+
+  /**
+   * @brief Minimise the band until it converges or runs out of steps, then
+   * report the energies along the path.
+   */
+  void run() override;
+
+  /**
+   * @brief Getter for the elastic band of images along the path.
+   * @return The elastic band.
+   */
+  const ElasticBand& band() const { return *band_; }
+
+  /**
+   * @brief Getter for the minimiser of the band.
+   * @return The minimiser.
+   */
+  const Minimise& minimiser() const { return *minimiser_; }
+
+ private:
+  /**
+   * @brief Collection of control variables and corresponding writer.
+   */
+  struct WriterConfig {
+    //< Index of the image written
+    std::size_t image;
+    //< Frequency of writing; number of steps between writes
+    std::size_t frequency;
+    //< The writer we write to
+    std::unique_ptr<Writer> writer;
+  };
+
+  //< The band is the only force on the band state, and is owned by forces_
+  ElasticBand* band_;
+  Forces forces_;
+  std::unique_ptr<Cell> cell_;
+  std::unique_ptr<Minimise> minimiser_;
+  std::optional<std::size_t> climb_after_;
+  std::vector<WriterConfig> writers_;
+
+  /**
+   * @brief Write to all writers registered to the simulation.
+   * @param istep The current step of the minimiser.
+   * @param last Whether this is the last step, whose images are written if
+   * they weren't already.
+   */
+  void write(std::size_t istep, bool last);
+
+  /**
+   * @brief Log the energy of each image relative to the initial state, and
+   * the barriers either way along the path.
+   */
+  void report() const;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_NUDGED_ELASTIC_BAND_HPP */
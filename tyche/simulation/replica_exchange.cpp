@@ -0,0 +1,156 @@
+/**
+ * @brief
+ */
+// Standard Libraries
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+// Third-party Libraries
+#include <omp.h>
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/simulation/replica_exchange.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+ReplicaExchange::ReplicaExchange(
+    std::vector<std::unique_ptr<MolecularDynamics>> replicas,
+    std::size_t exchange_frequency, std::uint64_t seed)
+    : replicas_(std::move(replicas)),
+      exchange_frequency_(exchange_frequency),
+      random_(seed, RandomStream::ReplicaExchange),
+      energy_(replicas_.size()),
+      num_exchanges_(0) {
+  if (replicas_.size() < 2) {
+    throw std::runtime_error("Replica exchange needs at least two replicas.");
+  }
+  if (exchange_frequency_ == 0) {
+    throw std::runtime_error("Replica exchange needs a positive frequency.");
+  }
+  for (std::size_t irung = 0; irung < replicas_.size(); ++irung) {
+    auto thermostat = replicas_[irung]->thermostat();
+    if (!thermostat) {
+      throw std::runtime_error(
+          "Replica exchange needs every replica to have a thermostat.");
+    }
+    temperatures_.push_back(thermostat->target_temperature());
+    replica_at_.push_back(irung);
+    if (irung > 0 && temperatures_[irung] <= temperatures_[irung - 1]) {
+      throw std::runtime_error(
+          "Replica exchange needs temperatures in increasing order.");
+    }
+  }
+  attempted_.assign(replicas_.size() - 1, 0);
+  accepted_.assign(replicas_.size() - 1, 0);
+}
+
+// ========================================================================== //
+
+void ReplicaExchange::run() {
+  spdlog::info(
+      "Running {} replicas from {}K to {}K over {} thread/s, exchanging every "
+      "{} steps.",
+      replicas_.size(), temperatures_.front(), temperatures_.back(),
+      omp_get_max_threads(), exchange_frequency_);
+  // Exceptions can't leave a parallel region, so hold them until it's done,
+  // stopping every thread at the next exchange
+  std::vector<std::exception_ptr> errors(replicas_.size());
+  auto any_failed = [&errors]() {
+    return std::any_of(errors.begin(), errors.end(),
+                       [](const auto& error) { return bool(error); });
+  };
+  // Whether to take another block of steps, which is only decided by a single
+  // thread between blocks, as threads that have finished theirs are already
+  // stepping replicas of the next
+  bool running;
+
+#pragma omp parallel
+  {
+    // Regions nested within each replica's kernels run on its thread alone
+    omp_set_num_threads(1);
+#pragma omp for schedule(dynamic, 1)
+    for (std::size_t ireplica = 0; ireplica < replicas_.size(); ++ireplica) {
+      try {
+        replicas_[ireplica]->start();
+      } catch (...) {
+        errors[ireplica] = std::current_exception();
+      }
+    }
+#pragma omp single
+    running = !any_failed();
+
+    while (running) {
+#pragma omp for schedule(dynamic, 1)
+      for (std::size_t ireplica = 0; ireplica < replicas_.size(); ++ireplica) {
+        try {
+          auto& replica = *replicas_[ireplica];
+          replica.advance(exchange_frequency_);
+          if (!replica.finished()) {
+            energy_[ireplica] = replica.potential_energy();
+          }
+        } catch (...) {
+          errors[ireplica] = std::current_exception();
+        }
+      }
+      // Every replica takes the same steps, so they all finish together
+#pragma omp single
+      {
+        running = !any_failed() && !replicas_[0]->finished();
+        if (running) exchange();
+      }
+    }
+  }
+
+  for (auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+  report();
+}
+
+// ========================================================================== //
+
+void ReplicaExchange::exchange() {
+  const double kb = constants::boltzmann * constants::joule_to_internal;
+  for (std::size_t irung = num_exchanges_ % 2; irung + 1 < replicas_.size();
+       irung += 2) {
+    const std::size_t ireplica = replica_at_[irung];
+    const std::size_t jreplica = replica_at_[irung + 1];
+    const double beta_i = 1 / (kb * temperatures_[irung]);
+    const double beta_j = 1 / (kb * temperatures_[irung + 1]);
+    const double delta =
+        (beta_i - beta_j) * (energy_[ireplica] - energy_[jreplica]);
+    ++attempted_[irung];
+    if (delta < 0 &&
+        random_.uniform(num_exchanges_, irung)[0] > std::exp(delta)) {
+      continue;
+    }
+    ++accepted_[irung];
+    std::swap(replica_at_[irung], replica_at_[irung + 1]);
+    replicas_[ireplica]->set_temperature(temperatures_[irung + 1]);
+    replicas_[jreplica]->set_temperature(temperatures_[irung]);
+  }
+  ++num_exchanges_;
+}
+
+// ========================================================================== //
+
+void ReplicaExchange::report() const {
+  for (std::size_t irung = 0; irung + 1 < replicas_.size(); ++irung) {
+    const double ratio =
+        attempted_[irung] ? double(accepted_[irung]) / attempted_[irung] : 0;
+    spdlog::info("Exchanges between {}K and {}K: {} of {} accepted ({:.1f}%).",
+                 temperatures_[irung], temperatures_[irung + 1],
+                 accepted_[irung], attempted_[irung], 100 * ratio);
+  }
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,117 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SIMULATION_REPLICA_EXCHANGE_HPP
+#define __TYCHE_SIMULATION_REPLICA_EXCHANGE_HPP
+
+// C++ Standard Libraries
+#include <memory>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/random.hpp"
+#include "tyche/simulation/simulation.hpp"
+#include "tyche/simulation/molecular_dynamics.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Parallel tempering, i.e. replica exchange molecular dynamics in the
+ * NVT ensemble (Sugita and Okamoto, Chem. Phys. Lett. 314, 141 (1999)).
+ *
+ * Replicas of the same system run at a ladder of temperatures, and every so
+ * many steps, replicas at neighbouring temperatures i and j attempt to swap
+ * them, which is accepted with probability
+ *
+ *      min(1, \exp[(1 / kT_i - 1 / kT_j) (U_i - U_j)])
+ *
+ * where U_i is the potential energy of the replica at T_i. Temperatures are
+ * exchanged rather than coordinates, with velocities scaled to match, so each
+ * replica keeps its own atoms, cell and writers. Attempts alternate between
+ * the pairs starting at even and odd rungs of the ladder, so that no replica
+ * is in two pairs at once.
+ *
+ * The replicas run one per thread, as with BatchedMolecularDynamics, in a
+ * single team of threads kept for the whole run. Between exchanges, one thread
+ * attempts them, which costs little next to the steps.
+ */
+class ReplicaExchange : public Simulation {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param replicas The replicas to run, each with a thermostat, in order of
+   * increasing temperature.
+   * @param exchange_frequency The number of steps between exchanges.
+   * @param seed Seed of the random numbers of the exchanges.
+   */
+  ReplicaExchange(std::vector<std::unique_ptr<MolecularDynamics>> replicas,
+                  std::size_t exchange_frequency, std::uint64_t seed);
+
+  /**
+   * @brief Run every replica to completion, exchanging temperatures as
+   * parameterised, then report the acceptance of exchanges.
+   */
+  void run() override;
+
+  /**
+   * @brief Getter for the number of replicas.
+   * @return The number of replicas.
+   */
+  std::size_t num_replicas() const { return replicas_.size(); }
+
+  /**
+   * @brief Getter for the ladder of temperatures.
+   * @return The temperature of each rung, in increasing order.
+   */
+  const std::vector<double>& temperatures() const { return temperatures_; }
+
+  /**
+   * @brief Getter for the replica at each rung of the ladder.
+   * @return The index of the replica at each temperature.
+   */
+  const std::vector<std::size_t>& replica_at() const { return replica_at_; }
+
+  /**
+   * @brief Getter for the number of exchanges attempted between each rung and
+   * the next.
+   * @return The number of attempts of each pair of rungs.
+   */
+  const std::vector<std::size_t>& attempted() const { return attempted_; }
+
+  /**
+   * @brief Getter for the number of exchanges accepted between each rung and
+   * the next.
+   * @return The number of acceptances of each pair of rungs.
+   */
+  const std::vector<std::size_t>& accepted() const { return accepted_; }
+
+ private:
+  std::vector<std::unique_ptr<MolecularDynamics>> replicas_;
+  std::size_t exchange_frequency_;
+  Philox random_;
+  //< Temperature of each rung, and the replica currently there
+  std::vector<double> temperatures_;
+  std::vector<std::size_t> replica_at_;
+  //< Potential energy of each replica at the last exchange
+  std::vector<double> energy_;
+  //< Exchanges attempted and accepted between each rung and the next
+  std::vector<std::size_t> attempted_, accepted_;
+  std::size_t num_exchanges_;
+
+  /**
+   * @brief Attempt exchanges between each pair of neighbouring rungs starting
+   * at an even or odd rung, alternating between calls.
+   */
+  void exchange();
+
+  /**
+   * @brief Log the acceptance of exchanges between each pair of rungs.
+   */
+  void report() const;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SIMULATION_REPLICA_EXCHANGE_HPP */
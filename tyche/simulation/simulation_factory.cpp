@@ -2,15 +2,33 @@
  * @brief
  */
 // C++ Standard Libraries
+#include <string>
 #include <vector>
+#include <cstdint>
 #include <stdexcept>
+#include <filesystem>
 // Third-Party Libraries
-//
+#include <spdlog/spdlog.h>
 // Project Inclusions
+#include "tyche/util/must.hpp"
+#include "tyche/util/maybe.hpp"
+#include "tyche/util/seed.hpp"
+#include "tyche/util/random.hpp"
 #include "tyche/io/reader.hpp"
+#include "tyche/io/writer_factory.hpp"
+#include "tyche/system/cell_factory.hpp"
+#include "tyche/force/force_factory.hpp"
+#include "tyche/minimise/minimise_factory.hpp"
+#include "tyche/minimise/elastic_band.hpp"
 #include "tyche/atom/dynamic_atomic_state.hpp"
 #include "tyche/simulation/simulation_factory.hpp"
 #include "tyche/simulation/molecular_dynamics_builder.hpp"
+#include "tyche/simulation/minimisation_builder.hpp"
+#include "tyche/simulation/monte_carlo_builder.hpp"
+#include "tyche/simulation/batched_molecular_dynamics.hpp"
+#include "tyche/simulation/replica_exchange.hpp"
+#include "tyche/simulation/nudged_elastic_band.hpp"
+#include "tyche/simulation/grand_canonical_monte_carlo_builder.hpp"
 
 namespace tyche {
 
@@ -28,7 +46,14 @@ std::unique_ptr<MolecularDynamics> create_molecular_dynamics(
     Reader::Mapping& config, std::shared_ptr<DynamicAtomicState> atomic_state) {
   auto builder = MolecularDynamics::create(atomic_state);
 
+  // Every stochastic component draws its own stream from one global seed, so a
+  // single number reproduces the whole run
+  auto key = resolve_seed(config, "seed");
+
   auto integrator_config = Reader::remove_prefix(config, "Integrator.");
+  if (!integrator_config.count("Control.seed")) {
+    integrator_config["Control.seed"] = double(key);
+  }
   builder.integrator(integrator_config);
 
   auto cell_config = Reader::remove_prefix(config, "Cell.");
@@ -36,7 +61,9 @@ std::unique_ptr<MolecularDynamics> create_molecular_dynamics(
 
   auto forces_config = std::any_cast<std::vector<std::any>>(config["Forces"]);
   for (auto&& force_config : forces_config) {
-    builder.force(std::any_cast<Reader::Mapping>(force_config));
+    auto force_map = std::any_cast<Reader::Mapping>(force_config);
+    if (!force_map.count("seed")) force_map["seed"] = double(key);
+    builder.force(force_map);
   }
 
   auto outputs_config = std::any_cast<std::vector<std::any>>(config["Outputs"]);
@@ -49,6 +76,285 @@ std::unique_ptr<MolecularDynamics> create_molecular_dynamics(
 
 // ========================================================================== //
 
+/**
+ * @brief Create a Minimisation instance from configuration.
+ * @param config Mapping from Minimisation parameter keys to values.
+ * @param atomic_state The atomic state we're minimising.
+ * @return The instantiated Minimisation instance.
+ */
+std::unique_ptr<Minimisation> create_minimisation(
+    Reader::Mapping& config, std::shared_ptr<DynamicAtomicState> atomic_state) {
+  auto builder = Minimisation::create(atomic_state);
+  builder.minimiser(Reader::remove_prefix(config, "Minimiser."));
+  builder.cell(Reader::remove_prefix(config, "Cell."));
+
+  auto forces_config = std::any_cast<std::vector<std::any>>(config["Forces"]);
+  for (auto&& force_config : forces_config) {
+    builder.force(std::any_cast<Reader::Mapping>(force_config));
+  }
+
+  auto outputs = maybe_find<std::vector<std::any>>(config, "Outputs");
+  for (auto&& output_config : outputs.value_or(std::vector<std::any>())) {
+    builder.output(std::any_cast<Reader::Mapping>(output_config));
+  }
+
+  return std::make_unique<Minimisation>(builder.build());
+}
+
+// ========================================================================== //
+
+/**
+ * @brief Create a MonteCarlo instance from configuration.
+ * @param config Mapping from MonteCarlo parameter keys to values.
+ * @param atomic_state The atomic state we're sampling.
+ * @return The instantiated MonteCarlo instance.
+ */
+std::unique_ptr<MonteCarlo> create_monte_carlo(
+    Reader::Mapping& config, std::shared_ptr<DynamicAtomicState> atomic_state) {
+  auto builder = MonteCarlo::create(atomic_state);
+
+  auto key = resolve_seed(config, "seed");
+
+  auto moves_config = Reader::remove_prefix(config, "Moves.");
+  if (!moves_config.count("seed")) moves_config["seed"] = double(key);
+  builder.moves(moves_config);
+  builder.cell(Reader::remove_prefix(config, "Cell."));
+
+  auto forces_config = std::any_cast<std::vector<std::any>>(config["Forces"]);
+  for (auto&& force_config : forces_config) {
+    builder.force(std::any_cast<Reader::Mapping>(force_config));
+  }
+
+  auto outputs = maybe_find<std::vector<std::any>>(config, "Outputs");
+  for (auto&& output_config : outputs.value_or(std::vector<std::any>())) {
+    builder.output(std::any_cast<Reader::Mapping>(output_config));
+  }
+
+  return std::make_unique<MonteCarlo>(builder.build());
+}
+
+// ========================================================================== //
+
+/**
+ * @brief Create a GrandCanonicalMonteCarlo instance from configuration.
+ * @param config Mapping from GrandCanonicalMonteCarlo parameter keys to
+ * values, with the moves under "Moves.", including "species", the name of the
+ * atom type inserted and removed, and "fugacity" in bar.
+ * @param atomic_state The atomic state we're sampling, which must know the
+ * species' atom type, even if it has no atoms of it.
+ * @return The instantiated GrandCanonicalMonteCarlo instance.
+ */
+std::unique_ptr<GrandCanonicalMonteCarlo> create_grand_canonical_monte_carlo(
+    Reader::Mapping& config, std::shared_ptr<DynamicAtomicState> atomic_state) {
+  auto builder = GrandCanonicalMonteCarlo::create(atomic_state);
+
+  auto key = resolve_seed(config, "seed");
+
+  auto moves_config = Reader::remove_prefix(config, "Moves.");
+  if (!moves_config.count("seed")) moves_config["seed"] = double(key);
+  builder.moves(moves_config);
+  builder.cell(Reader::remove_prefix(config, "Cell."));
+
+  auto forces_config = std::any_cast<std::vector<std::any>>(config["Forces"]);
+  for (auto&& force_config : forces_config) {
+    builder.force(std::any_cast<Reader::Mapping>(force_config));
+  }
+
+  auto outputs = maybe_find<std::vector<std::any>>(config, "Outputs");
+  for (auto&& output_config : outputs.value_or(std::vector<std::any>())) {
+    builder.output(std::any_cast<Reader::Mapping>(output_config));
+  }
+
+  return std::make_unique<GrandCanonicalMonteCarlo>(builder.build());
+}
+
+// ========================================================================== //
+
+/**
+ * @brief Insert an index before the extension of a path, e.g. to tell apart
+ * the outputs of replicas or images.
+ * @param path The path.
+ * @param index The index.
+ * @return The path with the index inserted.
+ */
+std::string indexed_path(std::filesystem::path path, std::size_t index) {
+  path.replace_filename(path.stem().string() + "." + std::to_string(index) +
+                        path.extension().string());
+  return path.string();
+}
+
+// ========================================================================== //
+
+/**
+ * @brief Configure one of several replicas of a MolecularDynamics instance,
+ * with its own seed drawn from the replicas stream of a shared seed, and the
+ * index of the replica inserted before the extension of each output path.
+ * @param config Mapping from MolecularDynamics parameter keys to values, which
+ * every replica shares.
+ * @param key The shared seed.
+ * @param ireplica The index of the replica.
+ * @return Mapping from the replica's parameter keys to values.
+ */
+Reader::Mapping configure_replica(const Reader::Mapping& config,
+                                  std::uint64_t key, std::size_t ireplica) {
+  Reader::Mapping replica_config = config;
+  // Keep to 53 bits so the seed survives being held as a double
+  auto bits = Philox(key, RandomStream::Replicas)(ireplica, 0);
+  replica_config["seed"] =
+      double((std::uint64_t(bits[0]) << 32 | bits[1]) >> 11);
+
+  auto outputs_config =
+      std::any_cast<std::vector<std::any>>(config.at("Outputs"));
+  std::vector<std::any> replica_outputs;
+  for (auto&& output_config : outputs_config) {
+    auto output_map = std::any_cast<Reader::Mapping>(output_config);
+    output_map["path"] =
+        indexed_path(must_find<std::string>(output_map, "path"), ireplica);
+    replica_outputs.push_back(output_map);
+  }
+  replica_config["Outputs"] = replica_outputs;
+  return replica_config;
+}
+
+// ========================================================================== //
+
+/**
+ * @brief Create a BatchedMolecularDynamics instance from configuration. Each
+ * replica is configured as a MolecularDynamics instance, as by
+ * configure_replica, with any swept parameters taking its value.
+ * @param config Mapping from BatchedMolecularDynamics parameter keys to
+ * values. Keys under "Sweep." are arrays of a value for each replica, of the
+ * parameter they name, e.g. "Sweep.Integrator.Control.temperature".
+ * @param atomic_state The atomic state we're simulating, which each replica
+ * starts from a copy of.
+ * @return The instantiated BatchedMolecularDynamics instance.
+ */
+std::unique_ptr<BatchedMolecularDynamics> create_batched_molecular_dynamics(
+    Reader::Mapping& config, std::shared_ptr<DynamicAtomicState> atomic_state) {
+  std::size_t num_replicas = must_find<double>(config, "replicas");
+  auto key = resolve_seed(config, "seed");
+  spdlog::info("Batch of {} replicas.", num_replicas);
+
+  auto sweep = Reader::remove_prefix(config, "Sweep.");
+  std::vector<std::unique_ptr<MolecularDynamics>> replicas;
+  for (std::size_t ireplica = 0; ireplica < num_replicas; ++ireplica) {
+    auto replica_config = configure_replica(config, key, ireplica);
+    for (auto& [name, values] : sweep) {
+      auto replica_values = std::any_cast<std::vector<std::any>>(values);
+      if (replica_values.size() != num_replicas) {
+        throw std::runtime_error("Swept parameter " + name +
+                                 " needs a value for every replica.");
+      }
+      replica_config[name] = replica_values[ireplica];
+      replica_config.erase("Sweep." + name);
+    }
+    replicas.push_back(create_molecular_dynamics(
+        replica_config, std::make_shared<DynamicAtomicState>(*atomic_state)));
+  }
+  return std::make_unique<BatchedMolecularDynamics>(std::move(replicas));
+}
+
+// ========================================================================== //
+
+/**
+ * @brief Create a ReplicaExchange instance from configuration. Each replica is
+ * configured as a MolecularDynamics instance, as by configure_replica, with
+ * the temperature of its thermostat taken from the ladder.
+ * @param config Mapping from ReplicaExchange parameter keys to values, with
+ * "temperatures" the ladder of temperatures in increasing order, and
+ * "exchange_frequency" the number of steps between exchanges.
+ * @param atomic_state The atomic state we're simulating, which each replica
+ * starts from a copy of.
+ * @return The instantiated ReplicaExchange instance.
+ */
+std::unique_ptr<ReplicaExchange> create_replica_exchange(
+    Reader::Mapping& config, std::shared_ptr<DynamicAtomicState> atomic_state) {
+  auto temperatures = must_find<std::vector<std::any>>(config, "temperatures");
+  std::size_t exchange_frequency =
+      must_find<double>(config, "exchange_frequency");
+  auto key = resolve_seed(config, "seed");
+  spdlog::info("Replica exchange of {} replicas.", temperatures.size());
+
+  std::vector<std::unique_ptr<MolecularDynamics>> replicas;
+  for (std::size_t ireplica = 0; ireplica < temperatures.size(); ++ireplica) {
+    auto replica_config = configure_replica(config, key, ireplica);
+    replica_config["Integrator.Control.temperature"] = temperatures[ireplica];
+    replicas.push_back(create_molecular_dynamics(
+        replica_config, std::make_shared<DynamicAtomicState>(*atomic_state)));
+  }
+  return std::make_unique<ReplicaExchange>(std::move(replicas),
+                                           exchange_frequency, key);
+}
+
+// ========================================================================== //
+
+/**
+ * @brief Create a NudgedElasticBand instance from configuration. Images are
+ * interpolated linearly from the atomic state to the final positions, each
+ * with its own forces, and the index of the image is inserted before the
+ * extension of each output path, which is written for every image.
+ * @param config Mapping from NudgedElasticBand parameter keys to values, with
+ * "images" the number of images including the end points, "final_positions"
+ * the flattened positions of every atom in the final state, "spring" the
+ * spring constant between images and, optionally, "climb_after" the number of
+ * steps after which the highest image climbs.
+ * @param atomic_state The initial atomic state of the path.
+ * @return The instantiated NudgedElasticBand instance.
+ */
+std::unique_ptr<NudgedElasticBand> create_nudged_elastic_band(
+    Reader::Mapping& config, std::shared_ptr<DynamicAtomicState> atomic_state) {
+  std::size_t num_images = must_find<double>(config, "images");
+  auto spring = must_find<double>(config, "spring");
+  auto climb_after = maybe_find<double>(config, "climb_after");
+  std::vector<double> final_pos;
+  for (auto&& value :
+       must_find<std::vector<std::any>>(config, "final_positions")) {
+    final_pos.push_back(std::any_cast<double>(value));
+  }
+
+  // The projected forces aren't a gradient, so line searches can't be trusted
+  auto minimiser_config = Reader::remove_prefix(config, "Minimiser.");
+  if (must_find<std::string>(minimiser_config, "type") != "FIRE") {
+    throw std::runtime_error("Nudged elastic band needs the FIRE minimiser.");
+  }
+  auto minimiser = MinimiseFactory::create(minimiser_config);
+  auto cell = CellFactory::create(Reader::remove_prefix(config, "Cell."));
+  spdlog::info("Nudged elastic band of {} images with spring constant {}.",
+               num_images, spring);
+
+  auto images =
+      ElasticBand::interpolate(*atomic_state, final_pos, num_images, *cell);
+  auto forces_config = std::any_cast<std::vector<std::any>>(config["Forces"]);
+  std::vector<std::unique_ptr<Forces>> forces;
+  for (auto& image : images) {
+    forces.push_back(std::make_unique<Forces>());
+    for (auto&& force_config : forces_config) {
+      forces.back()->add(ForceFactory::create(
+          std::any_cast<Reader::Mapping>(force_config),
+          image->atom_type_idx(), image->topology()));
+    }
+  }
+  auto band = std::make_unique<ElasticBand>(images, std::move(forces), spring);
+  auto simulation = std::make_unique<NudgedElasticBand>(
+      std::move(band), std::move(cell), std::move(minimiser),
+      climb_after ? std::optional<std::size_t>(*climb_after) : std::nullopt);
+
+  auto outputs = maybe_find<std::vector<std::any>>(config, "Outputs");
+  for (auto&& output_config : outputs.value_or(std::vector<std::any>())) {
+    for (std::size_t image = 0; image < num_images; ++image) {
+      auto output_map = std::any_cast<Reader::Mapping>(output_config);
+      output_map["path"] =
+          indexed_path(must_find<std::string>(output_map, "path"), image);
+      std::size_t frequency = must_find<double>(output_map, "frequency");
+      simulation->add_writer(image, frequency,
+                             WriterFactory::create(output_map, images[image]));
+    }
+  }
+  return simulation;
+}
+
+// ========================================================================== //
+
 }  // namespace
 
 // ========================================================================== //
@@ -60,6 +366,24 @@ std::unique_ptr<Simulation> SimulationFactory::create(
   if (type == "MolecularDynamics") {
     simulation = create_molecular_dynamics(
         config, std::static_pointer_cast<DynamicAtomicState>(atomic_state));
+  } else if (type == "BatchedMolecularDynamics") {
+    simulation = create_batched_molecular_dynamics(
+        config, std::static_pointer_cast<DynamicAtomicState>(atomic_state));
+  } else if (type == "ReplicaExchange") {
+    simulation = create_replica_exchange(
+        config, std::static_pointer_cast<DynamicAtomicState>(atomic_state));
+  } else if (type == "Minimisation") {
+    simulation = create_minimisation(
+        config, std::static_pointer_cast<DynamicAtomicState>(atomic_state));
+  } else if (type == "NudgedElasticBand") {
+    simulation = create_nudged_elastic_band(
+        config, std::static_pointer_cast<DynamicAtomicState>(atomic_state));
+  } else if (type == "MonteCarlo") {
+    simulation = create_monte_carlo(
+        config, std::static_pointer_cast<DynamicAtomicState>(atomic_state));
+  } else if (type == "GrandCanonicalMonteCarlo") {
+    simulation = create_grand_canonical_monte_carlo(
+        config, std::static_pointer_cast<DynamicAtomicState>(atomic_state));
   } else {
     throw std::runtime_error("Unrecognised Simulation type: " + type);
   }
@@ -0,0 +1,37 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/constants.hpp"
+#include "tyche/system/barostat.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+Barostat::Barostat(double pressure)
+    : pressure_(pressure * constants::bar_to_internal) {}
+
+// ========================================================================== //
+
+double Barostat::pressure(const DynamicAtomicState& state, const Cell& cell) {
+  return pressure(state.kinetic(), state.virial(), cell.volume()) /
+         constants::bar_to_internal;
+}
+
+// ========================================================================== //
+
+CubicCell& Barostat::cubic(Cell& cell) {
+  auto cubic = dynamic_cast<CubicCell*>(&cell);
+  if (!cubic)
+    throw std::runtime_error("Barostats require a cubic simulation cell.");
+  return *cubic;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
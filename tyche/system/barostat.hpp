@@ -0,0 +1,63 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_BAROSTAT_HPP
+#define __TYCHE_BAROSTAT_HPP
+
+// C++ Standard Libraries
+//
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/dynamic_atomic_state.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Abstract base barostat class.
+ */
+class Barostat {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param pressure The desired pressure to maintain, in bar.
+   */
+  Barostat(double pressure);
+
+  /**
+   * @brief Compute the instantaneous pressure associated with the atomic state
+   * from its kinetic energy and the virial of the last force evaluation.
+   * @param state The atomic state to compute the pressure of.
+   * @param cell The simulation cell the atomic state resides in.
+   * @return The pressure, in bar.
+   */
+  static double pressure(const DynamicAtomicState& state, const Cell& cell);
+
+ protected:
+  //< Desired pressure, in internal units
+  double pressure_;
+
+  /**
+   * @brief Compute the instantaneous pressure, P = (2K + W) / 3V.
+   * @param kinetic The kinetic energy of the atoms.
+   * @param virial The virial, \sum_i r_i . f_i.
+   * @param volume The volume of the cell.
+   * @return The pressure, in internal units.
+   */
+  static double pressure(double kinetic, double virial, double volume) {
+    return (2 * kinetic + virial) / (3 * volume);
+  }
+
+  /**
+   * @brief Check that the simulation cell can change volume, which is only
+   * true of cubic cells.
+   * @param cell The simulation cell.
+   * @return The cubic simulation cell.
+   */
+  static CubicCell& cubic(Cell& cell);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_BAROSTAT_HPP */
@@ -2,7 +2,6 @@
  * @brief
  */
 // C++ Standard Libraries
-#include <cmath>
 #include <stdexcept>
 // Third-Party Libraries
 //
@@ -29,18 +28,13 @@ double CubicCell::length() const { return length_; }
 
 // ========================================================================== //
 
-void CubicCell::pbc(double &x, double &y, double &z) const {
-  x -= std::floor(x / length()) * length();
-  y -= std::floor(y / length()) * length();
-  z -= std::floor(z / length()) * length();
+void CubicCell::scale(double factor) {
+  if (factor <= 0)
+    throw std::runtime_error(
+        "Cubic cell can only be scaled by a strictly positive factor.");
+  length_ *= factor;
 }
 
 // ========================================================================== //
 
-void CubicCell::min_image(double &x, double &y, double &z) const {
-  x -= std::round(x / length()) * length();
-  y -= std::round(y / length()) * length();
-  z -= std::round(z / length()) * length();
-}
-
 }  // namespace tyche
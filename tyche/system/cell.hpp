@@ -5,6 +5,7 @@
 #define __TYCHE_CELL_HPP
 
 // C++ Standard Libraries
+#include <cmath>
 #include <optional>
 // Third-Party Libraries
 //
@@ -97,14 +98,26 @@ class CubicCell : public Cell {
    */
   double length() const;
 
+  /**
+   * @brief Scale the length of the cell's side, e.g. when a barostat changes
+   * its volume. Positions within the cell aren't touched.
+   * @param factor The factor to scale the length by.
+   */
+  void scale(double factor);
+
   /**
    * @brief Apply periodic-boundary conditions to a position vector. Origin is
    * at (0,0,0) and the cell is in the positive octant of the coordinate system.
+   * Defined here so that it's inlined into kernels given the concrete cell.
    * @param x x-coordinate of the input position vector.
    * @param y y-coordinate of the input position vector.
    * @param z z-coordinate of the input position vector.
    */
-  void pbc(double &x, double &y, double &z) const override final;
+  void pbc(double &x, double &y, double &z) const override final {
+    x -= std::floor(x / length_) * length_;
+    y -= std::floor(y / length_) * length_;
+    z -= std::floor(z / length_) * length_;
+  }
 
   /**
    * @brief Apply the minimum image convention to vector.
@@ -112,12 +125,36 @@ class CubicCell : public Cell {
    * @param y y-coordinate of the input vector.
    * @param z z-coordinate of the input vector.
    */
-  void min_image(double &x, double &y, double &z) const override final;
+  void min_image(double &x, double &y, double &z) const override final {
+    x -= std::round(x / length_) * length_;
+    y -= std::round(y / length_) * length_;
+    z -= std::round(z / length_) * length_;
+  }
 
  private:
   double length_;
 };
 
+/**
+ * @brief Call a kernel with the cell cast to its concrete type, so that
+ * periodic boundary conditions within the kernel's loops are inlined rather
+ * than being a virtual call for every atom. Cells of any other type are passed
+ * as the base class.
+ * @tparam Kernel Callable taking a constant reference to the cell.
+ * @param cell The simulation cell.
+ * @param kernel The kernel to call.
+ */
+template <class Kernel>
+void with_cell_type(const Cell &cell, Kernel &&kernel) {
+  if (auto cubic = dynamic_cast<const CubicCell *>(&cell)) {
+    kernel(*cubic);
+  } else if (auto unbounded = dynamic_cast<const UnboundedCell *>(&cell)) {
+    kernel(*unbounded);
+  } else {
+    kernel(cell);
+  }
+}
+
 }  // namespace tyche
 
 #endif /* #ifndef __TYCHE_CELL_HPP */
@@ -0,0 +1,127 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <stdexcept>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/util/tensor.hpp"
+#include "tyche/system/neighbour_list.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+NeighbourList::NeighbourList(double cutoff, double skin, bool full)
+    : cutoff_(cutoff),
+      skin_(skin),
+      full_(full),
+      num_builds_(0),
+      grid_(cutoff + skin),
+      ref_length_(0) {
+  if (cutoff_ <= 0 || skin_ < 0)
+    throw std::runtime_error(
+        "Neighbour list cutoff must be strictly positive and skin must be "
+        "non-negative.");
+}
+
+// ========================================================================== //
+
+bool NeighbourList::update(const AtomicState& state, const Cell& cell) {
+  if (ref_pos_.size() != 3 * state.num_atoms() || invalidated(state, cell)) {
+    build(state, cell);
+    return true;
+  }
+  return false;
+}
+
+// ========================================================================== //
+
+void NeighbourList::build(const AtomicState& state, const Cell& cell) {
+  const double range = cutoff_ + skin_;
+  auto cubic = dynamic_cast<const CubicCell*>(&cell);
+  if (cubic && 2 * range > cubic->length())
+    throw std::runtime_error(
+        "Neighbour list cutoff plus skin exceeds half the cell length; the "
+        "minimum image convention would miss interactions.");
+
+  grid_.bin(state, cell);
+
+  const std::size_t num_atoms = state.num_atoms();
+  const double range_sq = range * range;
+  const bool full = full_;
+  Tensor<double, 2>::const_iterator pos = state.pos();
+
+  // Visit every candidate neighbour of an atom within range
+  auto visit = [&](std::size_t iatom, auto&& func) {
+    for (std::size_t jbin : grid_.neighbour_bins(grid_.bin_of(iatom))) {
+      for (std::size_t jatom : grid_.atoms(jbin)) {
+        if (full ? jatom == iatom : jatom <= iatom) continue;
+        double dx = pos[3 * jatom] - pos[3 * iatom];
+        double dy = pos[3 * jatom + 1] - pos[3 * iatom + 1];
+        double dz = pos[3 * jatom + 2] - pos[3 * iatom + 2];
+        cell.min_image(dx, dy, dz);
+        if (dx * dx + dy * dy + dz * dz < range_sq) func(jatom);
+      }
+    }
+  };
+
+  // First pass counts the neighbours of each atom so that we can lay the list
+  // out contiguously, second pass fills it in
+  offsets_.resize(num_atoms + 1);
+  offsets_[0] = 0;
+#pragma omp parallel for schedule(dynamic, 64)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    std::size_t count = 0;
+    visit(iatom, [&](std::size_t) { ++count; });
+    offsets_[iatom + 1] = count;
+  }
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    offsets_[iatom + 1] += offsets_[iatom];
+  }
+
+  neighbours_.resize(offsets_[num_atoms]);
+#pragma omp parallel for schedule(dynamic, 64)
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    std::size_t idx = offsets_[iatom];
+    visit(iatom, [&](std::size_t jatom) { neighbours_[idx++] = jatom; });
+  }
+
+  ref_pos_.assign(state.pos(), state.pos() + 3 * num_atoms);
+  ref_length_ = cubic ? cubic->length() : 0;
+  ++num_builds_;
+}
+
+// ========================================================================== //
+
+bool NeighbourList::invalidated(const AtomicState& state,
+                                const Cell& cell) const {
+  // A rescaling of the cell by s scales every listed distance by s too, so a
+  // pair outside the list can come within the cutoff once the atoms have each
+  // moved by half of s * (cutoff + skin) - cutoff relative to the scaled
+  // reference positions
+  auto cubic = dynamic_cast<const CubicCell*>(&cell);
+  const double scale = cubic && ref_length_ > 0 ? cubic->length() / ref_length_
+                                                : 1;
+  const double max_disp = 0.5 * (scale * (cutoff_ + skin_) - cutoff_);
+  if (max_disp <= 0) return true;
+  const double max_disp_sq = max_disp * max_disp;
+  Tensor<double, 2>::const_iterator pos = state.pos();
+  bool moved = false;
+#pragma omp parallel for reduction(|| : moved)
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    double dx = pos[3 * iatom] - scale * ref_pos_[3 * iatom];
+    double dy = pos[3 * iatom + 1] - scale * ref_pos_[3 * iatom + 1];
+    double dz = pos[3 * iatom + 2] - scale * ref_pos_[3 * iatom + 2];
+    // Periodic boundary conditions may have wrapped the atom in the meantime
+    cell.min_image(dx, dy, dz);
+    moved = moved || (dx * dx + dy * dy + dz * dz > max_disp_sq);
+  }
+  return moved;
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
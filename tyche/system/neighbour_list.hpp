@@ -0,0 +1,112 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SYSTEM_NEIGHBOUR_LIST_HPP
+#define __TYCHE_SYSTEM_NEIGHBOUR_LIST_HPP
+
+// C++ Standard Libraries
+#include <span>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/system/spatial_grid.hpp"
+#include "tyche/atom/atomic_state.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Verlet neighbour list, built from a SpatialGrid.
+ *
+ * Each atom is listed with all other atoms within the cutoff plus a skin
+ * distance. The list only needs rebuilding once some atom has moved further
+ * than half the skin since the last build, so the cost of the build is
+ * amortised over many force evaluations. If a cubic cell has been rescaled in
+ * the meantime, motion is measured relative to the reference positions scaled
+ * along with the cell, and the skin is reduced by any compression of the
+ * listed distances.
+ *
+ * A half list only stores each pair once, against the lower-indexed atom, and
+ * suits pairwise forces where Newton's third law can be exploited. A full list
+ * stores each pair against both atoms, which suits many-body forces and allows
+ * threading over atoms without any two threads writing to the same atom.
+ */
+class NeighbourList {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param cutoff The interaction cutoff distance.
+   * @param skin Additional distance beyond the cutoff to list neighbours for.
+   * @param full Whether to store each pair against both atoms.
+   */
+  NeighbourList(double cutoff, double skin, bool full = false);
+
+  /**
+   * @brief Rebuild the neighbour list if it's been invalidated by atomic
+   * motion, or if the number of atoms has changed since it was last built.
+   * @param state The atomic state to list neighbours for.
+   * @param cell The simulation cell the atomic state resides in.
+   * @return True if the list was rebuilt, false otherwise.
+   */
+  bool update(const AtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Unconditionally rebuild the neighbour list.
+   * @param state The atomic state to list neighbours for.
+   * @param cell The simulation cell the atomic state resides in.
+   */
+  void build(const AtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Getter for the neighbours of an atom.
+   * @param iatom The index of the atom.
+   * @return The indices of the atom's neighbours.
+   */
+  std::span<const std::size_t> neighbours(std::size_t iatom) const {
+    return {neighbours_.data() + offsets_[iatom],
+            offsets_[iatom + 1] - offsets_[iatom]};
+  }
+
+  /**
+   * @brief Getter for the interaction cutoff distance.
+   * @return The cutoff.
+   */
+  double cutoff() const { return cutoff_; }
+
+  /**
+   * @brief Getter for the skin distance beyond the cutoff.
+   * @return The skin.
+   */
+  double skin() const { return skin_; }
+
+  /**
+   * @brief Getter for the number of times the list has been built.
+   * @return The number of builds.
+   */
+  std::size_t num_builds() const { return num_builds_; }
+
+ protected:
+  double cutoff_, skin_;
+  bool full_;
+  std::size_t num_builds_;
+  SpatialGrid grid_;
+  std::vector<std::size_t> offsets_, neighbours_;
+  std::vector<double> ref_pos_;
+  //< Length of the cell at the last build, or zero if it wasn't cubic
+  double ref_length_;
+
+  /**
+   * @brief Check whether any atom has moved further than half the skin since
+   * the last build.
+   * @param state The atomic state to list neighbours for.
+   * @param cell The simulation cell the atomic state resides in.
+   * @return True if the list needs rebuilding.
+   */
+  bool invalidated(const AtomicState& state, const Cell& cell) const;
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SYSTEM_NEIGHBOUR_LIST_HPP */
@@ -0,0 +1,201 @@
+/**
+ * @brief
+ */
+// C++ Standard Libraries
+#include <cmath>
+#include <limits>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/spatial_grid.hpp"
+
+namespace tyche {
+
+// ========================================================================== //
+
+SpatialGrid::SpatialGrid(double min_width)
+    : min_width_(min_width), periodic_(false), dims_{0, 0, 0} {}
+
+// ========================================================================== //
+
+void SpatialGrid::bin(const AtomicState& state, const Cell& cell) {
+  if (!fit(state, cell) && atom_bin_.size() == state.num_atoms()) {
+    rebin(state);
+    return;
+  }
+
+  for (auto& atoms : bins_) {
+    atoms.clear();
+  }
+  atom_bin_.resize(state.num_atoms());
+
+  Tensor<double, 2>::const_iterator pos = state.pos();
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    std::size_t ibin = bin_index(pos[0], pos[1], pos[2]);
+    atom_bin_[iatom] = ibin;
+    bins_[ibin].push_back(iatom);
+    pos += 3;
+  }
+}
+
+// ========================================================================== //
+
+void SpatialGrid::rebin(const AtomicState& state) {
+  Tensor<double, 2>::const_iterator pos = state.pos();
+  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+    std::size_t ibin = bin_index(pos[0], pos[1], pos[2]);
+    pos += 3;
+    if (ibin != atom_bin_[iatom]) relocate(iatom, ibin);
+  }
+}
+
+// ========================================================================== //
+
+void SpatialGrid::insert(const AtomicState& state, std::size_t iatom) {
+  Tensor<double, 2>::const_iterator pos = state.pos(iatom);
+  std::size_t ibin = bin_index(pos[0], pos[1], pos[2]);
+  atom_bin_.push_back(ibin);
+  bins_[ibin].push_back(iatom);
+}
+
+// ========================================================================== //
+
+void SpatialGrid::remove(std::size_t iatom) {
+  // Order within a bin doesn't matter, so swap the atom out with the last
+  auto& atoms = bins_[atom_bin_[iatom]];
+  *std::find(atoms.begin(), atoms.end(), iatom) = atoms.back();
+  atoms.pop_back();
+
+  // The last atom takes the removed atom's index
+  const std::size_t last = atom_bin_.size() - 1;
+  if (iatom != last) {
+    auto& moved = bins_[atom_bin_[last]];
+    *std::find(moved.begin(), moved.end(), last) = iatom;
+    atom_bin_[iatom] = atom_bin_[last];
+  }
+  atom_bin_.pop_back();
+}
+
+// ========================================================================== //
+
+void SpatialGrid::move(const AtomicState& state, std::size_t iatom) {
+  Tensor<double, 2>::const_iterator pos = state.pos(iatom);
+  std::size_t ibin = bin_index(pos[0], pos[1], pos[2]);
+  if (ibin != atom_bin_[iatom]) relocate(iatom, ibin);
+}
+
+// ========================================================================== //
+
+void SpatialGrid::relocate(std::size_t iatom, std::size_t ibin) {
+  // Order within a bin doesn't matter, so swap the atom out with the last
+  auto& atoms = bins_[atom_bin_[iatom]];
+  *std::find(atoms.begin(), atoms.end(), iatom) = atoms.back();
+  atoms.pop_back();
+  bins_[ibin].push_back(iatom);
+  atom_bin_[iatom] = ibin;
+}
+
+// ========================================================================== //
+
+bool SpatialGrid::fit(const AtomicState& state, const Cell& cell) {
+  std::array<double, 3> extent;
+  auto cubic = dynamic_cast<const CubicCell*>(&cell);
+  bool periodic = (cubic != nullptr);
+  if (periodic) {
+    origin_ = {0, 0, 0};
+    extent = {cubic->length(), cubic->length(), cubic->length()};
+  } else {
+    // No periodicity, so just bound the atoms
+    std::array<double, 3> upper;
+    origin_.fill(std::numeric_limits<double>::max());
+    upper.fill(std::numeric_limits<double>::lowest());
+    Tensor<double, 2>::const_iterator pos = state.pos();
+    for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+      for (std::size_t idim = 0; idim < 3; ++idim) {
+        origin_[idim] = std::min(origin_[idim], pos[idim]);
+        upper[idim] = std::max(upper[idim], pos[idim]);
+      }
+      pos += 3;
+    }
+    for (std::size_t idim = 0; idim < 3; ++idim) {
+      extent[idim] = std::max(upper[idim] - origin_[idim], 0.0);
+    }
+  }
+
+  std::array<std::size_t, 3> dims;
+  for (std::size_t idim = 0; idim < 3; ++idim) {
+    dims[idim] = std::max<std::size_t>(
+        1, static_cast<std::size_t>(std::floor(extent[idim] / min_width_)));
+    // Guard against a zero extent, i.e. all atoms in a plane
+    inv_width_[idim] = extent[idim] > 0 ? dims[idim] / extent[idim] : 0;
+  }
+
+  // Only need to recompute the stencils when the shape of the grid changes
+  if (dims == dims_ && periodic == periodic_ && !bins_.empty()) return false;
+  dims_ = dims;
+  periodic_ = periodic;
+  bins_.resize(dims_[0] * dims_[1] * dims_[2]);
+  stencils_.resize(bins_.size());
+
+  for (std::size_t ix = 0; ix < dims_[0]; ++ix) {
+    for (std::size_t iy = 0; iy < dims_[1]; ++iy) {
+      for (std::size_t iz = 0; iz < dims_[2]; ++iz) {
+        auto& stencil = stencils_[(ix * dims_[1] + iy) * dims_[2] + iz];
+        stencil.clear();
+        for (int dx = -1; dx <= 1; ++dx) {
+          for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+              std::array<long, 3> jdx{static_cast<long>(ix) + dx,
+                                      static_cast<long>(iy) + dy,
+                                      static_cast<long>(iz) + dz};
+              bool valid = true;
+              for (std::size_t idim = 0; idim < 3; ++idim) {
+                long dim = static_cast<long>(dims_[idim]);
+                if (periodic_) {
+                  jdx[idim] = (jdx[idim] + dim) % dim;
+                } else if (jdx[idim] < 0 || jdx[idim] >= dim) {
+                  valid = false;
+                }
+              }
+              if (!valid) continue;
+              stencil.push_back((jdx[0] * dims_[1] + jdx[1]) * dims_[2] +
+                                jdx[2]);
+            }
+          }
+        }
+        // With fewer than three bins along a periodic dimension, several
+        // offsets map onto the same bin; only keep one of them
+        std::sort(stencil.begin(), stencil.end());
+        stencil.erase(std::unique(stencil.begin(), stencil.end()),
+                      stencil.end());
+      }
+    }
+  }
+  return true;
+}
+
+// ========================================================================== //
+
+std::size_t SpatialGrid::bin_index(double x, double y, double z) const {
+  std::array<double, 3> r{x, y, z};
+  std::array<std::size_t, 3> idx;
+  for (std::size_t idim = 0; idim < 3; ++idim) {
+    double s = std::floor((r[idim] - origin_[idim]) * inv_width_[idim]);
+    if (periodic_) {
+      // Positions needn't have been wrapped into the cell yet
+      long dim = static_cast<long>(dims_[idim]);
+      idx[idim] = ((static_cast<long>(s) % dim) + dim) % dim;
+    } else {
+      // Positions sitting exactly on the upper boundary are clamped onto the
+      // grid
+      idx[idim] = static_cast<std::size_t>(
+          std::clamp(s, 0.0, static_cast<double>(dims_[idim] - 1)));
+    }
+  }
+  return (idx[0] * dims_[1] + idx[1]) * dims_[2] + idx[2];
+}
+
+// ========================================================================== //
+
+}  // namespace tyche
@@ -0,0 +1,154 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_SYSTEM_SPATIAL_GRID_HPP
+#define __TYCHE_SYSTEM_SPATIAL_GRID_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <vector>
+#include <cstdint>
+// Third-Party Libraries
+//
+// Project Inclusions
+#include "tyche/system/cell.hpp"
+#include "tyche/atom/atomic_state.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Decomposition of the simulation cell into a regular grid of bins,
+ * each holding the indices of the atoms whose positions lie within it.
+ *
+ * Bins are at least as wide as some minimum width, so all atoms within that
+ * distance of an atom are found in the 27 bins surrounding (and including) the
+ * atom's bin. For a CubicCell the grid spans the cell and wraps periodically;
+ * for any other cell it spans the bounding box of the atoms.
+ *
+ * Between calls to bin, single atoms can be inserted, removed or moved in
+ * constant time, following the same changes to the atomic state, so that the
+ * grid keeps up with a state whose number of atoms fluctuates.
+ */
+class SpatialGrid {
+ public:
+  /**
+   * @brief Class constructor.
+   * @param min_width The minimum width of a bin along each dimension.
+   */
+  SpatialGrid(double min_width);
+
+  /**
+   * @brief Bin all atoms in the atomic state. The storage of the grid is reused
+   * between calls, so this doesn't allocate once warmed up.
+   *
+   * If the number of bins along each dimension and the number of atoms are
+   * unchanged since the last call, only atoms that have crossed into another
+   * bin are moved. Most atoms stay put between neighbour list builds, and a
+   * uniform rescaling of a cubic cell, as by a barostat, moves none of them.
+   * Otherwise all atoms are binned from scratch.
+   * @param state The atomic state to bin.
+   * @param cell The simulation cell the atomic state resides in.
+   */
+  void bin(const AtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Bin an atom just inserted after the last in the atomic state. The
+   * grid isn't refitted, so the atom must lie within the cell if it's periodic,
+   * or within the bounding box of the atoms at the last call to bin otherwise.
+   * @param state The atomic state.
+   * @param iatom The index of the atom, which must be the last.
+   */
+  void insert(const AtomicState& state, std::size_t iatom);
+
+  /**
+   * @brief Unbin an atom removed from the atomic state, following it in moving
+   * the last atom into the removed atom's place.
+   * @param iatom The index of the atom.
+   */
+  void remove(std::size_t iatom);
+
+  /**
+   * @brief Move an atom into the bin it now lies within, after it's moved.
+   * @param state The atomic state.
+   * @param iatom The index of the atom.
+   */
+  void move(const AtomicState& state, std::size_t iatom);
+
+  /**
+   * @brief Compute the index of the bin that a position lies within.
+   * @param x x-coordinate of the position.
+   * @param y y-coordinate of the position.
+   * @param z z-coordinate of the position.
+   * @return The index of the bin.
+   */
+  std::size_t bin_index(double x, double y, double z) const;
+
+  /**
+   * @brief Getter for the total number of bins in the grid.
+   * @return The number of bins.
+   */
+  std::size_t num_bins() const { return bins_.size(); }
+
+  /**
+   * @brief Getter for the index of the bin an atom was placed in.
+   * @param iatom The index of the atom.
+   * @return The index of the bin containing the atom.
+   */
+  std::size_t bin_of(std::size_t iatom) const { return atom_bin_[iatom]; }
+
+  /**
+   * @brief Getter for the atoms contained within a bin.
+   * @param ibin The index of the bin.
+   * @return The indices of the atoms within the bin.
+   */
+  const std::vector<std::size_t>& atoms(std::size_t ibin) const {
+    return bins_[ibin];
+  }
+
+  /**
+   * @brief Getter for the bins neighbouring a bin, including the bin itself.
+   * Each neighbouring bin appears exactly once, even when the grid is so
+   * small that periodic images of a bin coincide.
+   * @param ibin The index of the bin.
+   * @return The indices of the neighbouring bins.
+   */
+  const std::vector<std::size_t>& neighbour_bins(std::size_t ibin) const {
+    return stencils_[ibin];
+  }
+
+ protected:
+  double min_width_;
+  bool periodic_;
+  std::array<double, 3> origin_, inv_width_;
+  std::array<std::size_t, 3> dims_;
+  std::vector<std::vector<std::size_t>> bins_, stencils_;
+  std::vector<std::size_t> atom_bin_;
+
+  /**
+   * @brief Fit the grid geometry to the cell (or the atoms, for cells that
+   * aren't periodic), and rebuild the bin stencils if the number of bins along
+   * any dimension has changed.
+   * @param state The atomic state to bin.
+   * @param cell The simulation cell the atomic state resides in.
+   * @return True if the shape of the grid has changed.
+   */
+  bool fit(const AtomicState& state, const Cell& cell);
+
+  /**
+   * @brief Move atoms which have left the bin they were last placed in to the
+   * one they now lie within.
+   * @param state The atomic state to bin.
+   */
+  void rebin(const AtomicState& state);
+
+  /**
+   * @brief Move an atom from the bin it was last placed in to another.
+   * @param iatom The index of the atom.
+   * @param ibin The index of the bin to move it to.
+   */
+  void relocate(std::size_t iatom, std::size_t ibin);
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_SYSTEM_SPATIAL_GRID_HPP */
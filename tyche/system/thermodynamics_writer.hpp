@@ -31,7 +31,10 @@ class ThermodynamicsWriter : public AtomicStateWriter<DynamicAtomicState> {
                        std::shared_ptr<DynamicAtomicState> atomic_state,
                        std::shared_ptr<Integrate> integrator)
       : AtomicStateWriter(filename, atomic_state), integrator_(integrator) {
-    output() << "Timestep"
+    // The width only holds for the next field, so each but the last column
+    // is written through output()
+    output() << "Timestep";
+    output() << "Time / fs"
              << "Temperature / K" << std::endl;
   }
 
@@ -40,7 +43,8 @@ class ThermodynamicsWriter : public AtomicStateWriter<DynamicAtomicState> {
    * @param comment Unused -- abstract base method requires is.
    */
   void write(std::optional<std::string> comment = std::nullopt) override {
-    output() << integrator_->current_step()
+    output() << integrator_->current_step();
+    output() << integrator_->time()
              << Thermostat::temperature(*atomic_state_) << std::endl;
   }
 
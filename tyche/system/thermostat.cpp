@@ -3,11 +3,13 @@
  */
 // C++ Standard Libraries
 #include <cmath>
-#include <random>
+#include <memory>
+#include <vector>
 // Third-Party Libraries
 #include <spdlog/spdlog.h>
 // Project Inclusions
 #include "tyche/util/tensor.hpp"
+#include "tyche/util/random.hpp"
 #include "tyche/util/constants.hpp"
 #include "tyche/system/thermostat.hpp"
 
@@ -15,7 +17,8 @@ namespace tyche {
 
 // ========================================================================== //
 
-Thermostat::Thermostat(double temp) : temp_(temp) {}
+Thermostat::Thermostat(double temp, std::uint64_t seed)
+    : temp_(temp), seed_(seed) {}
 
 // ========================================================================== //
 
@@ -24,33 +27,39 @@ void Thermostat::initialise_velocities(DynamicAtomicState& state) {
       "Initialising atomic state velocities from Maxwell-Boltzmann "
       "distribution at {}K.",
       temp_);
-  std::vector<double> vel_com(3);
+  const std::size_t num_atoms = state.num_atoms();
+  if (num_atoms == 0) return;
 
-  std::random_device rd;
-  std::mt19937 generator(rd());
-  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
-
-  // Randomly initialise velocities from uniform distribution
+  // Draw velocities from the Maxwell-Boltzmann distribution, accumulating the
+  // momentum and mass of the system
+  Philox random(seed_, RandomStream::Velocities);
   Tensor<double, 2>::iterator vel = state.vel();
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+  random.fill_normal(0, std::to_address(vel), 3 * num_atoms);
+  const double kt = constants::boltzmann * constants::joule_to_internal * temp_;
+  std::vector<double> momentum(3);
+  double total_mass = 0;
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
+    double mass = state.atom_type(iatom)->mass();
+    double vscale = std::sqrt(kt / mass);
     for (std::size_t idim = 0; idim < 3; ++idim) {
-      *vel = distribution(generator);
-      vel_com[idim] += *vel++;
+      *vel *= vscale;
+      momentum[idim] += mass * *vel++;
     }
+    total_mass += mass;
   }
 
   // Remove velocity of centre-of-mass of system
   vel = state.vel();
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
     for (std::size_t idim = 0; idim < 3; ++idim) {
-      *vel++ -= vel_com[idim] / state.num_atoms();
+      *vel++ -= momentum[idim] / total_mass;
     }
   }
 
   // Rescale velocities to match desired temperature
   double scale = std::sqrt(temp_ / temperature(state));
   vel = state.vel();
-  for (std::size_t iatom = 0; iatom < state.num_atoms(); ++iatom) {
+  for (std::size_t iatom = 0; iatom < num_atoms; ++iatom) {
     for (std::size_t idim = 0; idim < 3; ++idim) {
       *vel++ *= scale;
     }
@@ -68,4 +77,15 @@ double Thermostat::temperature(DynamicAtomicState& state) {
 
 // ========================================================================== //
 
+void Thermostat::set_temperature(DynamicAtomicState& state, double temp) {
+  const std::size_t num_values = 3 * state.num_atoms();
+  const double scale = std::sqrt(temp / temp_);
+  double* vel = std::to_address(state.vel());
+#pragma omp parallel for simd schedule(static)
+  for (std::size_t idx = 0; idx < num_values; ++idx) vel[idx] *= scale;
+  temp_ = temp;
+}
+
+// ========================================================================== //
+
 }  // namespace tyche
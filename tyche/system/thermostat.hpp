@@ -5,7 +5,7 @@
 #define __TYCHE_THERMOSTAT_HPP
 
 // C++ Standard Libraries
-//
+#include <cstdint>
 // Third-Party Libraries
 //
 // Project Inclusions
@@ -21,12 +21,20 @@ class Thermostat {
   /**
    * @brief Class constructor.
    * @param temp The desired temperature to maintain.
+   * @param seed Seed of the random numbers of the simulation.
    */
-  Thermostat(double temp);
+  Thermostat(double temp, std::uint64_t seed);
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~Thermostat() = default;
 
   /**
    * @brief Initialise atomic velocities from Maxwell-Boltzmann distribution at
-   * parameterised temperatures.
+   * parameterised temperatures. Each velocity is drawn from the velocities
+   * stream, keyed on its index, then the centre of mass motion is removed and
+   * the temperature made exact.
    * @param state The atomic state to initialise velocities of.
    */
   void initialise_velocities(DynamicAtomicState& state);
@@ -38,8 +46,26 @@ class Thermostat {
    */
   static double temperature(DynamicAtomicState& state);
 
+  /**
+   * @brief Getter for the temperature of the heat bath.
+   * @return The temperature to maintain.
+   */
+  double target_temperature() const { return temp_; }
+
+  /**
+   * @brief Change the temperature of the heat bath mid-simulation, e.g. on an
+   * exchange between replicas. Velocities are scaled by \sqrt{T_new / T_old}
+   * so the atoms start out in equilibrium with it. Thermostats holding
+   * anything derived from the temperature or the kinetic energy override this
+   * to update it too.
+   * @param state The atomic state being thermostatted.
+   * @param temp The new temperature to maintain.
+   */
+  virtual void set_temperature(DynamicAtomicState& state, double temp);
+
  protected:
   double temp_;
+  std::uint64_t seed_;
 };
 
 }  // namespace tyche
@@ -30,6 +30,9 @@ static constexpr double ev_to_joule = 1.602176565E-19;
 static constexpr double joule_to_internal =
     kg_to_dalton * (m_to_angstrom * m_to_angstrom) / (sec_to_fs * sec_to_fs);
 static constexpr double ev_to_internal = ev_to_joule * joule_to_internal;
+// Units: Energy / Distance^3
+static constexpr double bar_to_internal =
+    1E5 * joule_to_internal / (m_to_angstrom * m_to_angstrom * m_to_angstrom);
 
 }  // namespace tyche::constants
 
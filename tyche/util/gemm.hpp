@@ -0,0 +1,77 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_UTIL_GEMM_HPP
+#define __TYCHE_UTIL_GEMM_HPP
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+//
+
+namespace tyche {
+
+/**
+ * @brief Dense row-major matrix multiply, C = A B, threaded over blocks of
+ * rows of C and vectorised along its columns.
+ *
+ * Intended for batches of many rows (e.g. atoms) against a narrow matrix
+ * (e.g. network weights), so B stays in cache whilst each block of rows of A
+ * streams past it.
+ * @param m The number of rows of A and C.
+ * @param n The number of columns of B and C.
+ * @param k The number of columns of A and rows of B.
+ * @param a The m x k matrix A.
+ * @param b The k x n matrix B.
+ * @param c The m x n matrix C, which is overwritten.
+ */
+inline void gemm(std::size_t m, std::size_t n, std::size_t k, const double* a,
+                 const double* b, double* c) {
+#pragma omp parallel for schedule(static)
+  for (std::size_t i = 0; i < m; ++i) {
+    double* ci = c + i * n;
+    std::fill(ci, ci + n, 0.0);
+    for (std::size_t p = 0; p < k; ++p) {
+      const double aip = a[i * k + p];
+      const double* bp = b + p * n;
+#pragma omp simd
+      for (std::size_t j = 0; j < n; ++j) {
+        ci[j] += aip * bp[j];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Dense row-major matrix multiply with the second matrix transposed,
+ * C = A B^T, threaded over rows of C and vectorised along the inner dimension.
+ * @param m The number of rows of A and C.
+ * @param n The number of rows of B and columns of C.
+ * @param k The number of columns of A and B.
+ * @param a The m x k matrix A.
+ * @param b The n x k matrix B.
+ * @param c The m x n matrix C, which is overwritten.
+ */
+inline void gemm_nt(std::size_t m, std::size_t n, std::size_t k,
+                    const double* a, const double* b, double* c) {
+#pragma omp parallel for schedule(static)
+  for (std::size_t i = 0; i < m; ++i) {
+    const double* ai = a + i * k;
+    for (std::size_t j = 0; j < n; ++j) {
+      const double* bj = b + j * k;
+      double sum = 0;
+#pragma omp simd reduction(+ : sum)
+      for (std::size_t p = 0; p < k; ++p) {
+        sum += ai[p] * bj[p];
+      }
+      c[i * n + j] = sum;
+    }
+  }
+}
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_UTIL_GEMM_HPP */
@@ -0,0 +1,99 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_UTIL_QUATERNION_HPP
+#define __TYCHE_UTIL_QUATERNION_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <cmath>
+// Third-Party Libraries
+//
+// Project Inclusions
+//
+
+namespace tyche {
+
+/**
+ * @brief Unit quaternion representing a rotation, q = w + xi + yj + zk.
+ */
+struct Quaternion {
+  double w = 1, x = 0, y = 0, z = 0;
+
+  /**
+   * @brief Hamilton product; the rotation of the argument followed by that of
+   * this quaternion.
+   * @param other The right-hand quaternion.
+   * @return The product.
+   */
+  Quaternion operator*(const Quaternion& other) const {
+    return {w * other.w - x * other.x - y * other.y - z * other.z,
+            w * other.x + x * other.w + y * other.z - z * other.y,
+            w * other.y - x * other.z + y * other.w + z * other.x,
+            w * other.z + x * other.y - y * other.x + z * other.w};
+  }
+
+  /**
+   * @brief Rescale to unit length, to remove accumulated round-off.
+   */
+  void normalise() {
+    double inv_norm = 1 / std::sqrt(w * w + x * x + y * y + z * z);
+    w *= inv_norm;
+    x *= inv_norm;
+    y *= inv_norm;
+    z *= inv_norm;
+  }
+
+  /**
+   * @brief Quaternion for a rotation about a Cartesian axis.
+   * @param axis The axis, on [0,3).
+   * @param angle The angle of rotation.
+   * @return The quaternion.
+   */
+  static Quaternion about_axis(std::size_t axis, double angle) {
+    Quaternion q{std::cos(angle / 2), 0, 0, 0};
+    double s = std::sin(angle / 2);
+    (axis == 0 ? q.x : axis == 1 ? q.y : q.z) = s;
+    return q;
+  }
+
+  /**
+   * @brief Rotation matrix of the quaternion.
+   * @return The row-major rotation matrix.
+   */
+  std::array<double, 9> matrix() const {
+    return {1 - 2 * (y * y + z * z), 2 * (x * y - w * z), 2 * (x * z + w * y),
+            2 * (x * y + w * z), 1 - 2 * (x * x + z * z), 2 * (y * z - w * x),
+            2 * (x * z - w * y), 2 * (y * z + w * x), 1 - 2 * (x * x + y * y)};
+  }
+
+  /**
+   * @brief Quaternion of a rotation matrix, using Shepperd's method to avoid
+   * dividing by a small number.
+   * @param m The row-major rotation matrix, which must be proper.
+   * @return The unit quaternion.
+   */
+  static Quaternion from_matrix(const std::array<double, 9>& m) {
+    double trace = m[0] + m[4] + m[8];
+    Quaternion q;
+    if (trace > m[0] && trace > m[4] && trace > m[8]) {
+      double s = 2 * std::sqrt(1 + trace);
+      q = {s / 4, (m[7] - m[5]) / s, (m[2] - m[6]) / s, (m[3] - m[1]) / s};
+    } else if (m[0] > m[4] && m[0] > m[8]) {
+      double s = 2 * std::sqrt(1 + m[0] - m[4] - m[8]);
+      q = {(m[7] - m[5]) / s, s / 4, (m[1] + m[3]) / s, (m[2] + m[6]) / s};
+    } else if (m[4] > m[8]) {
+      double s = 2 * std::sqrt(1 + m[4] - m[0] - m[8]);
+      q = {(m[2] - m[6]) / s, (m[1] + m[3]) / s, s / 4, (m[5] + m[7]) / s};
+    } else {
+      double s = 2 * std::sqrt(1 + m[8] - m[0] - m[4]);
+      q = {(m[3] - m[1]) / s, (m[2] + m[6]) / s, (m[5] + m[7]) / s, s / 4};
+    }
+    q.normalise();
+    return q;
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_UTIL_QUATERNION_HPP */
@@ -0,0 +1,235 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_UTIL_RANDOM_HPP
+#define __TYCHE_UTIL_RANDOM_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+// Third-Party Libraries
+//
+// Project Inclusions
+//
+
+namespace tyche {
+
+/**
+ * @brief Independent streams of random numbers drawn from one seed, one for
+ * each stochastic component of a simulation.
+ */
+enum class RandomStream : std::uint64_t {
+  Default = 0,
+  Velocities,
+  Andersen,
+  Langevin,
+  Bussi,
+  DissipativeParticleDynamics,
+  Replicas,
+  ReplicaExchange,
+  MonteCarlo,
+  HybridMonteCarlo,
+  GrandCanonical,
+};
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator (Salmon et al.,
+ * SC '11).
+ *
+ * Rather than advancing a hidden state, each draw is a pure function of a
+ * 128-bit counter and a 64-bit key. The key is made from the seed of the
+ * simulation and the stream of the component drawing, and by convention the
+ * first word of the counter is the step and the second the atom (or pair of
+ * atoms) the number is for. That gives the same number regardless of which
+ * thread draws it or in what order, so runs are reproducible under any number
+ * of threads.
+ */
+class Philox {
+ public:
+  using Counter = std::array<std::uint32_t, 4>;
+
+  /**
+   * @brief Class constructor.
+   * @param seed The seed.
+   * @param stream The stream to draw from. The default stream is keyed on the
+   * seed alone.
+   */
+  explicit Philox(std::uint64_t seed,
+                  RandomStream stream = RandomStream::Default)
+      : Philox(key(seed, stream)) {}
+
+  /**
+   * @brief Generate the random bits for a counter.
+   * @param counter The counter.
+   * @return 128 random bits.
+   */
+  Counter operator()(Counter counter) const {
+    std::uint32_t k0 = key_[0], k1 = key_[1];
+    for (std::size_t round = 0; round < 10; ++round) {
+      std::uint64_t p0 = std::uint64_t(m0) * counter[0];
+      std::uint64_t p1 = std::uint64_t(m1) * counter[2];
+      counter = {static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ k0,
+                 static_cast<std::uint32_t>(p1),
+                 static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ k1,
+                 static_cast<std::uint32_t>(p0)};
+      k0 += w0;
+      k1 += w1;
+    }
+    return counter;
+  }
+
+  /**
+   * @brief Generate the random bits for a counter made of two 64-bit words.
+   * @param c0 The first word of the counter.
+   * @param c1 The second word of the counter.
+   * @return 128 random bits.
+   */
+  Counter operator()(std::uint64_t c0, std::uint64_t c1) const {
+    return (*this)({static_cast<std::uint32_t>(c0),
+                    static_cast<std::uint32_t>(c0 >> 32),
+                    static_cast<std::uint32_t>(c1),
+                    static_cast<std::uint32_t>(c1 >> 32)});
+  }
+
+  /**
+   * @brief Pair of uniform random numbers for a counter.
+   * @param c0 The first word of the counter.
+   * @param c1 The second word of the counter.
+   * @return Two uniform random numbers on (0,1], with 53 bits of precision.
+   */
+  std::array<double, 2> uniform(std::uint64_t c0, std::uint64_t c1) const {
+    auto bits = (*this)(c0, c1);
+    return {to_double(bits[0], bits[1]), to_double(bits[2], bits[3])};
+  }
+
+  /**
+   * @brief Pair of independent standard normal random numbers for a counter,
+   * using the Box-Muller transform.
+   * @param c0 The first word of the counter.
+   * @param c1 The second word of the counter.
+   * @return Two standard normal random numbers.
+   */
+  std::array<double, 2> normal(std::uint64_t c0, std::uint64_t c1) const {
+    auto u = uniform(c0, c1);
+    double r = std::sqrt(-2 * std::log(u[0]));
+    double theta = 2 * std::numbers::pi * u[1];
+    return {r * std::cos(theta), r * std::sin(theta)};
+  }
+
+  /**
+   * @brief Fill an array with uniform random numbers in bulk, threaded and
+   * vectorised over the array. Values 2p and 2p+1 are those of uniform(c0, p).
+   * @param c0 The first word of the counter of every draw, e.g. the step.
+   * @param values The array to fill.
+   * @param num_values The number of values in the array.
+   */
+  void fill_uniform(std::uint64_t c0, double* values,
+                    std::size_t num_values) const {
+    const std::size_t num_pairs = num_values / 2;
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t p = 0; p < num_pairs; ++p) {
+      auto u = uniform(c0, p);
+      values[2 * p] = u[0];
+      values[2 * p + 1] = u[1];
+    }
+    if (num_values % 2) values[num_values - 1] = uniform(c0, num_pairs)[0];
+  }
+
+  /**
+   * @brief Fill an array with standard normal random numbers in bulk. Uniform
+   * pairs are drawn threaded over the array, then transformed by Box-Muller in
+   * a separate vectorised loop. Values 2p and 2p+1 are those of normal(c0, p).
+   * @param c0 The first word of the counter of every draw, e.g. the step.
+   * @param values The array to fill.
+   * @param num_values The number of values in the array.
+   */
+  void fill_normal(std::uint64_t c0, double* values,
+                   std::size_t num_values) const {
+    const std::size_t num_pairs = num_values / 2;
+#pragma omp parallel
+    {
+#pragma omp for schedule(static)
+      for (std::size_t p = 0; p < num_pairs; ++p) {
+        auto u = uniform(c0, p);
+        values[2 * p] = u[0];
+        values[2 * p + 1] = u[1];
+      }
+#pragma omp for simd schedule(static)
+      for (std::size_t p = 0; p < num_pairs; ++p) {
+        double r = std::sqrt(-2 * std::log(values[2 * p]));
+        double theta = 2 * std::numbers::pi * values[2 * p + 1];
+        values[2 * p] = r * std::cos(theta);
+        values[2 * p + 1] = r * std::sin(theta);
+      }
+    }
+    if (num_values % 2) values[num_values - 1] = normal(c0, num_pairs)[0];
+  }
+
+  /**
+   * @brief Gamma-distributed random number with unit scale, using the
+   * rejection method of Marsaglia and Tsang (ACM Trans. Math. Softw. 26, 363
+   * (2000)). Attempt n draws on the counters (c0, 2n) and (c0, 2n+1).
+   * @param shape The shape of the distribution, which must be positive.
+   * @param c0 The first word of the counter of every draw, e.g. the step.
+   * @return The random number.
+   */
+  double gamma(double shape, std::uint64_t c0) const {
+    // Shapes below one are boosted by one, then scaled back down by u^{1/a}
+    const double d = (shape < 1 ? shape + 1 : shape) - 1.0 / 3;
+    const double c = 1 / std::sqrt(9 * d);
+    for (std::uint64_t n = 0;; ++n) {
+      double x = normal(c0, 2 * n)[0];
+      double v = 1 + c * x;
+      if (v <= 0) continue;
+      v = v * v * v;
+      auto u = uniform(c0, 2 * n + 1);
+      if (std::log(u[0]) < 0.5 * x * x + d - d * v + d * std::log(v)) {
+        return shape < 1 ? d * v * std::pow(u[1], 1 / shape) : d * v;
+      }
+    }
+  }
+
+ private:
+  //< Round multipliers and Weyl sequence key increments
+  static constexpr std::uint32_t m0 = 0xD2511F53, m1 = 0xCD9E8D57;
+  static constexpr std::uint32_t w0 = 0x9E3779B9, w1 = 0xBB67AE85;
+
+  std::array<std::uint32_t, 2> key_;
+
+  /**
+   * @brief Private constructor from the key itself.
+   * @param key The key of the generator.
+   */
+  explicit Philox(std::array<std::uint32_t, 2> key) : key_(key) {}
+
+  /**
+   * @brief Make the key of a stream. Streams are separated by a multiple of
+   * the golden ratio, so the default stream's key is the seed itself.
+   * @param seed The seed.
+   * @param stream The stream.
+   * @return The key.
+   */
+  static std::array<std::uint32_t, 2> key(std::uint64_t seed,
+                                          RandomStream stream) {
+    seed ^= static_cast<std::uint64_t>(stream) * 0x9E3779B97F4A7C15;
+    return {static_cast<std::uint32_t>(seed),
+            static_cast<std::uint32_t>(seed >> 32)};
+  }
+
+  /**
+   * @brief Convert two 32-bit words into a double on (0,1].
+   * @param hi The high word.
+   * @param lo The low word.
+   * @return The double.
+   */
+  static double to_double(std::uint32_t hi, std::uint32_t lo) {
+    std::uint64_t bits = (std::uint64_t(hi) << 32 | lo) >> 11;
+    return (bits + 1) * 0x1.0p-53;
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_UTIL_RANDOM_HPP */
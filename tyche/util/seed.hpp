@@ -0,0 +1,38 @@
+/**
+ * @brief
+ */
+#ifndef __TYCHE_UTIL_SEED_HPP
+#define __TYCHE_UTIL_SEED_HPP
+
+// C++ Standard Libraries
+#include <any>
+#include <map>
+#include <random>
+#include <string>
+#include <cstdint>
+// Third-Party Libraries
+#include <spdlog/spdlog.h>
+// Project Inclusions
+#include "tyche/util/maybe.hpp"
+
+namespace tyche {
+
+/**
+ * @brief Return the seed of some random numbers from a map, or draw one if it
+ * wasn't given. Either way it's logged, as without it the run couldn't be
+ * reproduced.
+ * @param map The map potentially containing the seed.
+ * @param key The name of the seed parameter.
+ * @return The seed.
+ */
+static std::uint64_t resolve_seed(std::map<std::string, std::any>& map,
+                                  std::string key) {
+  auto seed = maybe_find<double>(map, key);
+  std::uint64_t value = seed ? std::uint64_t(*seed) : std::random_device()();
+  spdlog::info("Random seed {} is {}.", key, value);
+  return value;
+}
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_UTIL_SEED_HPP */
@@ -0,0 +1,121 @@
+/**
+ * @brief Cubic spline interpolation of tabulated functions.
+ */
+#ifndef __TYCHE_UTIL_SPLINE_HPP
+#define __TYCHE_UTIL_SPLINE_HPP
+
+// C++ Standard Libraries
+#include <array>
+#include <cmath>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+// Third-Party Libraries
+//
+// Project Inclusions
+//
+
+namespace tyche {
+
+/**
+ * @brief Natural cubic spline through function values tabulated on a uniform
+ * grid.
+ *
+ * The polynomial coefficients of each interval are stored contiguously so that
+ * an evaluation touches a single cache line, and both the value and the
+ * derivative can be retrieved from the same lookup. Arguments outside of the
+ * tabulated range are evaluated with the polynomial of the nearest interval.
+ */
+class CubicSpline {
+ public:
+  /**
+   * @brief Empty constructor; defer meaningful creation for being moved to at
+   * a later point.
+   */
+  CubicSpline() : x0_{0}, dx_{1}, inv_dx_{1} {}
+
+  /**
+   * @brief Class constructor.
+   * @param y Function values at x0, x0 + dx, ..., x0 + (n - 1) * dx. Must
+   * contain at least two values.
+   * @param x0 The abscissa of the first tabulated value.
+   * @param dx The spacing between tabulated values.
+   */
+  CubicSpline(const std::vector<double>& y, double x0, double dx)
+      : x0_{x0}, dx_{dx}, inv_dx_{1 / dx}, coeffs_(y.size() - 1) {
+    assert(y.size() > 1);
+    const std::size_t n = y.size();
+
+    // Solve the tridiagonal system for the second derivatives (scaled by
+    // dx^2) at each knot, with natural boundary conditions at either end
+    std::vector<double> m(n, 0), c_prime(n, 0), d_prime(n, 0);
+    for (std::size_t i = 1; i < n - 1; ++i) {
+      double rhs = 6 * (y[i + 1] - 2 * y[i] + y[i - 1]);
+      double denom = 4 - c_prime[i - 1];
+      c_prime[i] = 1 / denom;
+      d_prime[i] = (rhs - d_prime[i - 1]) / denom;
+    }
+    for (std::size_t i = n - 2; i > 0; --i) {
+      m[i] = d_prime[i] - c_prime[i] * m[i + 1];
+    }
+
+    // Polynomial in the local coordinate t = (x - x_i) / dx on [0, 1)
+    for (std::size_t i = 0; i < n - 1; ++i) {
+      coeffs_[i] = {y[i], (y[i + 1] - y[i]) - (2 * m[i] + m[i + 1]) / 6,
+                    m[i] / 2, (m[i + 1] - m[i]) / 6};
+    }
+  }
+
+  /**
+   * @brief Evaluate the spline.
+   * @param x The argument to evaluate the spline at.
+   * @return The interpolated function value.
+   */
+  inline double operator()(double x) const {
+    double t;
+    const auto& c = coeffs_[interval(x, t)];
+    return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+  }
+
+  /**
+   * @brief Evaluate both the spline and its first derivative.
+   * @param x The argument to evaluate the spline at.
+   * @param value The interpolated function value.
+   * @param deriv The interpolated first derivative of the function.
+   */
+  inline void evaluate(double x, double& value, double& deriv) const {
+    double t;
+    const auto& c = coeffs_[interval(x, t)];
+    value = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    deriv = (c[1] + t * (2 * c[2] + t * 3 * c[3])) * inv_dx_;
+  }
+
+  /**
+   * @brief Getter for the upper bound of the tabulated range.
+   * @return The abscissa of the last tabulated value.
+   */
+  double x_max() const { return x0_ + coeffs_.size() * dx_; }
+
+ private:
+  double x0_, dx_, inv_dx_;
+  std::vector<std::array<double, 4>> coeffs_;
+
+  /**
+   * @brief Find the interval containing an argument, clamped to the tabulated
+   * range.
+   * @param x The argument to locate.
+   * @param t Set to the local coordinate of the argument within the interval.
+   * @return The index of the interval.
+   */
+  inline std::size_t interval(double x, double& t) const {
+    double s = (x - x0_) * inv_dx_;
+    double idx =
+        std::clamp(std::floor(s), 0.0, static_cast<double>(coeffs_.size() - 1));
+    t = s - idx;
+    return static_cast<std::size_t>(idx);
+  }
+};
+
+}  // namespace tyche
+
+#endif /* #ifndef __TYCHE_UTIL_SPLINE_HPP */
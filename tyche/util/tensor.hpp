@@ -171,6 +171,19 @@ class Tensor {
     return dim_size_[idim];
   }
 
+  /**
+   * @brief Reserve storage for a number of elements, so that resizing the
+   * tensor up to that many elements doesn't reallocate.
+   * @param num_elements The number of elements to reserve storage for.
+   */
+  void reserve(std::size_t num_elements) { data_.reserve(num_elements); }
+
+  /**
+   * @brief Get the number of elements storage is reserved for.
+   * @return The number of elements the tensor can hold without reallocating.
+   */
+  std::size_t capacity() const { return data_.capacity(); }
+
   /**
    * @brief Resize each of the tensor's dimensions; if the tensor ends up larger
    * than before, zeros will be used as fill elements.